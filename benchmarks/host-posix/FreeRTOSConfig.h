@@ -0,0 +1,62 @@
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*!
+ * \file        FreeRTOSConfig.h
+ * \brief       FreeRTOS configuration of the host benchmark (GCC_POSIX port)
+ * \details     Kept close to the ESP32 defaults the library is used with (1 kHz tick, preemption, time slicing)
+ */
+#include <limits.h>
+
+#define configUSE_PREEMPTION                        1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION     0
+#define configUSE_TIME_SLICING                      1
+#define configIDLE_SHOULD_YIELD                     1
+#define configTICK_RATE_HZ                          ((TickType_t)1000)
+#define configTICK_TYPE_WIDTH_IN_BITS               TICK_TYPE_WIDTH_32_BITS
+#define configMAX_PRIORITIES                        (10)
+#define configMINIMAL_STACK_SIZE                    ((unsigned short)PTHREAD_STACK_MIN)
+/* The workers get 4 * PTHREAD_STACK_MIN words, more than the uint16_t some kernel versions use by default */
+#define configSTACK_DEPTH_TYPE                      size_t
+#define configMAX_TASK_NAME_LEN                     (16)
+#define configTOTAL_HEAP_SIZE                       ((size_t)(4 * 1024 * 1024))
+
+#define configUSE_IDLE_HOOK                         0
+#define configUSE_TICK_HOOK                         0
+#define configUSE_MALLOC_FAILED_HOOK                0
+#define configCHECK_FOR_STACK_OVERFLOW              0
+#define configUSE_TRACE_FACILITY                    0
+#define configGENERATE_RUN_TIME_STATS               0
+#define configUSE_CO_ROUTINES                       0
+#define configUSE_TIMERS                            0
+
+#define configUSE_MUTEXES                           1
+#define configUSE_RECURSIVE_MUTEXES                 1
+#define configUSE_COUNTING_SEMAPHORES               1
+#define configUSE_QUEUE_SETS                        1
+#define configUSE_TASK_NOTIFICATIONS                1
+#define configQUEUE_REGISTRY_SIZE                   0
+
+#define configSUPPORT_DYNAMIC_ALLOCATION            1
+#define configSUPPORT_STATIC_ALLOCATION             0
+
+#define INCLUDE_vTaskDelete                         1
+#define INCLUDE_vTaskDelay                          1
+#define INCLUDE_vTaskDelayUntil                     1
+#define INCLUDE_vTaskSuspend                        1
+#define INCLUDE_vTaskPrioritySet                    1
+#define INCLUDE_uxTaskPriorityGet                   1
+#define INCLUDE_xTaskGetSchedulerState              1
+#define INCLUDE_xTaskGetCurrentTaskHandle           1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void vAssertCalled(const char * const pcFileName,unsigned long ulLine);
+#ifdef __cplusplus
+}
+#endif
+
+#define configASSERT(x) if((x) == 0) vAssertCalled(__FILE__,__LINE__)
+
+#endif
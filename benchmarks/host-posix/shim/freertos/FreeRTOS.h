@@ -0,0 +1,10 @@
+#ifndef FRTT_BENCHMARK_SHIM_FREERTOS_H
+#define FRTT_BENCHMARK_SHIM_FREERTOS_H
+
+/*!
+ * \file        FreeRTOS.h
+ * \brief       Maps the ESP-IDF include path (freertos/FreeRTOS.h) to the FreeRTOS-Kernel headers
+ */
+#include <FreeRTOS.h>
+
+#endif
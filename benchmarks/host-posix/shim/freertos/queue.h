@@ -0,0 +1,11 @@
+#ifndef FRTT_BENCHMARK_SHIM_QUEUE_H
+#define FRTT_BENCHMARK_SHIM_QUEUE_H
+
+/*!
+ * \file        queue.h
+ * \brief       Maps the ESP-IDF include path (freertos/queue.h) to the FreeRTOS-Kernel headers
+ */
+#include <FreeRTOS.h>
+#include <queue.h>
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef FRTT_BENCHMARK_SHIM_SEMPHR_H
+#define FRTT_BENCHMARK_SHIM_SEMPHR_H
+
+/*!
+ * \file        semphr.h
+ * \brief       Maps the ESP-IDF include path (freertos/semphr.h) to the FreeRTOS-Kernel headers
+ */
+#include <FreeRTOS.h>
+#include <semphr.h>
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef FRTT_BENCHMARK_SHIM_TASK_H
+#define FRTT_BENCHMARK_SHIM_TASK_H
+
+/*!
+ * \file        task.h
+ * \brief       Maps the ESP-IDF include path (freertos/task.h) to the FreeRTOS-Kernel headers
+ * \details     Adds the ESP-IDF only API the library uses. The POSIX port has a single core, so the core is ignored
+ */
+#include <FreeRTOS.h>
+#include <task.h>
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t taskCode,const char * const taskName,const uint32_t stackbytes,
+                                                 void * const taskParameter,UBaseType_t taskPriority,TaskHandle_t * const taskHandle,const BaseType_t core)
+{
+    (void)core;
+    return xTaskCreate(taskCode,taskName,(configSTACK_DEPTH_TYPE)(stackbytes / sizeof(StackType_t)),taskParameter,taskPriority,taskHandle);
+}
+
+#endif
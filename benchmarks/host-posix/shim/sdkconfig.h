@@ -0,0 +1,10 @@
+#ifndef FRTT_BENCHMARK_SDKCONFIG_H
+#define FRTT_BENCHMARK_SDKCONFIG_H
+
+/*!
+ * \file        sdkconfig.h
+ * \brief       Stand-in for the ESP-IDF sdkconfig.h. The library is built like on an ESP32 (single core FreeRTOS POSIX port)
+ */
+#define CONFIG_IDF_TARGET_ESP32 1
+
+#endif
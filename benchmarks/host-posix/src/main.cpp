@@ -0,0 +1,609 @@
+/*!
+ * \file        main.cpp
+ * \brief       Throughput and latency scenarios for the FreeRTOS-Transceiver hot path (FreeRTOS POSIX port)
+ * \details     All scenarios run inside one scheduler run. Every memory the tasks touch is allocated before the
+ *              scheduler starts, the results are written as JSON after the scheduler ended.
+ *
+ *              Usage: frtt_benchmark [--messages N] [--output FILE]
+ */
+
+#include "FRTTransceiver.h"
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+using namespace FRTT;
+
+#define BENCH_MAXCONSUMERS          (8u)
+#define BENCH_MULTISENDERS          (4u)
+#define BENCH_MAXRESULTS            (24u)
+#define BENCH_QUEUELENGTH           (FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE)
+#define BENCH_WORKERPRIORITY        (tskIDLE_PRIORITY + 2)
+#define BENCH_RUNNERPRIORITY        (tskIDLE_PRIORITY + 1)
+#define BENCH_STACKSIZE             (configMINIMAL_STACK_SIZE * 4)
+
+/*! \brief Summary of one scenario */
+struct BenchResult
+{
+    const char * pcScenario;
+    const char * pcTransport;
+    uint32_t u32Partners;
+    uint32_t u32Messages;
+    uint64_t u64DurationNs;
+    double dMeanNs;
+    uint32_t u32P50Ns;
+    uint32_t u32P99Ns;
+    uint32_t u32MaxNs;
+};
+
+/*! \brief State shared between the runner and the worker tasks of the current scenario */
+struct BenchScenario
+{
+    uint32_t u32Messages = 0;
+    uint32_t u32Consumers = 0;
+    bool bUseRing = false;
+    bool bFanOut = false;
+    bool bFireAndForget = false;
+
+    TaskHandle_t producers[BENCH_MULTISENDERS] = {};
+    TaskHandle_t consumers[BENCH_MAXCONSUMERS] = {};
+    FRTTQueueHandle queues[BENCH_MAXCONSUMERS] = {};
+    FRTTSemaphoreHandle semaphores[BENCH_MAXCONSUMERS] = {};
+    FRTTSpscRingHandle rings[BENCH_MAXCONSUMERS] = {};
+
+    std::vector<uint64_t> sendTimes;
+    std::vector<uint32_t> latencies[BENCH_MAXCONSUMERS];
+    std::vector<uint32_t> merged;
+
+    uint64_t u64Start = 0;
+    uint64_t u64End = 0;
+    SemaphoreHandle_t done = nullptr;
+};
+
+static BenchScenario g;
+static BenchResult results[BENCH_MAXRESULTS];
+static uint32_t u32Results = 0;
+static int iPayload = 42;
+
+static uint64_t nowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t sequenceOf(const FRTTTempDataContainer * container)
+{
+    #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+    return container->u32AdditionalData;
+    #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+    return (uint32_t)container->u64AdditionalData;
+    #endif
+}
+
+/* Benchmarks measure the library, not the copy of the user: plain pointer copy, nothing to free */
+static void benchAllocator(const FRTTDataContainerOnQueue & orig,FRTTTempDataContainer & temp)
+{
+    temp = orig;
+}
+
+static void benchDestroyer(FRTTTempDataContainer &)
+{
+}
+
+static void addCallbacks(FRTTransceiver & comm)
+{
+    comm.addDataAllocateCallback(benchAllocator);
+    comm.addDataFreeCallback(benchDestroyer);
+}
+
+/* Queue writes of the current scenario skip the tx mirror and the tx semaphore (FRTT::FRTTransceiver::setFireAndForget()) */
+static void applyWriteMode(FRTTransceiver & comm,FRTTTaskHandle partner)
+{
+    if(g.bFireAndForget) comm.setFireAndForget(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true,true);
+}
+
+static const char * transportName(bool bUseRing)
+{
+    if(bUseRing) return "ring";
+    return (g.bFireAndForget ? "queue_fireandforget" : "queue");
+}
+
+/*! \brief Sorts the first u32Count samples and stores the summary */
+static void addResult(const char * pcScenario,const char * pcTransport,uint32_t u32Partners,uint32_t u32Messages,
+                        uint64_t u64DurationNs,uint32_t * pu32Samples,uint32_t u32Count)
+{
+    if(u32Results >= BENCH_MAXRESULTS || u32Count == 0) return;
+
+    std::sort(pu32Samples,pu32Samples + u32Count);
+
+    double dSum = 0;
+    for(uint32_t u32I = 0; u32I < u32Count; u32I++) dSum += pu32Samples[u32I];
+
+    BenchResult & r = results[u32Results++];
+    r.pcScenario = pcScenario;
+    r.pcTransport = pcTransport;
+    r.u32Partners = u32Partners;
+    r.u32Messages = u32Messages;
+    r.u64DurationNs = u64DurationNs;
+    r.dMeanNs = dSum / u32Count;
+    r.u32P50Ns = pu32Samples[u32Count / 2];
+    r.u32P99Ns = pu32Samples[(uint32_t)((uint64_t)u32Count * 99 / 100)];
+    r.u32MaxNs = pu32Samples[u32Count - 1];
+}
+
+/*! \brief Records the latency of one received data package and releases it */
+static void consume(FRTTransceiver & comm,FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,
+                        uint32_t u32Consumer,uint32_t u32Index)
+{
+    const FRTTTempDataContainer * container = comm.getOldestBufferedDataFrom(partner,multiSenderQueue,bUseTaskHandleVar);
+
+    g.latencies[u32Consumer][u32Index] = (uint32_t)(nowNs() - g.sendTimes[sequenceOf(container)]);
+
+    if(bUseTaskHandleVar)
+    {
+        comm.delOldestDatabuffForLine(partner);
+    }
+    else
+    {
+        comm.delOldestDatabuffForLine(multiSenderQueue);
+    }
+}
+
+static void finishWorker(bool bConsumer)
+{
+    if(bConsumer) g.u64End = nowNs();
+    xSemaphoreGive(g.done);
+    vTaskDelete(NULL);
+}
+
+/* ---------------------------------------------------------------- 1:1 ---------------------------------------------------------------- */
+
+static void oneToOneProducer(void *)
+{
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    addCallbacks(comm);
+
+    if(g.bUseRing) comm.addCommPartner(g.consumers[0],nullptr,g.rings[0],"CONSUMER");
+    else comm.addCommPartner(g.consumers[0],nullptr,0,nullptr,g.queues[0],BENCH_QUEUELENGTH,g.semaphores[0],"CONSUMER");
+
+    applyWriteMode(comm,g.consumers[0]);
+    FRTTLine line = comm.getLine(g.consumers[0]);
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        g.sendTimes[u32I] = nowNs();
+        comm.writeToQueue(line,0,&iPayload,FRTTRANSCEIVER_WAITMAX,FRTTRANSCEIVER_WAITMAX,u32I);
+    }
+
+    finishWorker(false);
+}
+
+static void oneToOneConsumer(void *)
+{
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    addCallbacks(comm);
+
+    if(g.bUseRing) comm.addCommPartner(g.producers[0],g.rings[0],nullptr,"PRODUCER");
+    else comm.addCommPartner(g.producers[0],g.queues[0],BENCH_QUEUELENGTH,g.semaphores[0],nullptr,0,nullptr,"PRODUCER");
+
+    FRTTLine line = comm.getLine(g.producers[0]);
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        comm.readFromQueue(line,FRTTRANSCEIVER_WAITMAX,FRTTRANSCEIVER_WAITMAX);
+        consume(comm,g.producers[0],eMultiSenderQueue::eNOMULTIQSELECTED,true,0,u32I);
+    }
+
+    finishWorker(true);
+}
+
+/* ----------------------------------------------------------- multi-sender ------------------------------------------------------------ */
+
+static void multiSenderProducer(void * parameter)
+{
+    uint32_t u32Producer = (uint32_t)(uintptr_t)parameter;
+    uint32_t u32PerProducer = g.u32Messages / BENCH_MULTISENDERS;
+
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    addCallbacks(comm);
+    comm.addCommPartner(g.consumers[0],nullptr,0,nullptr,g.queues[0],BENCH_QUEUELENGTH,g.semaphores[0],"MULTI");
+
+    applyWriteMode(comm,g.consumers[0]);
+    FRTTLine line = comm.getLine(g.consumers[0]);
+
+    for(uint32_t u32I = 0; u32I < u32PerProducer; u32I++)
+    {
+        uint32_t u32Sequence = u32Producer * u32PerProducer + u32I;
+
+        g.sendTimes[u32Sequence] = nowNs();
+        comm.writeToQueue(line,0,&iPayload,FRTTRANSCEIVER_WAITMAX,FRTTRANSCEIVER_WAITMAX,u32Sequence);
+    }
+
+    finishWorker(false);
+}
+
+static void multiSenderConsumer(void *)
+{
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    addCallbacks(comm);
+    comm.addMultiSenderPartner(g.queues[0],BENCH_QUEUELENGTH,g.semaphores[0],"MULTI");
+
+    FRTTLine line = comm.getLine(eMultiSenderQueue::eMULTISENDERQ0);
+    uint32_t u32Total = (g.u32Messages / BENCH_MULTISENDERS) * BENCH_MULTISENDERS;
+
+    for(uint32_t u32I = 0; u32I < u32Total; u32I++)
+    {
+        comm.readFromQueue(line,FRTTRANSCEIVER_WAITMAX,FRTTRANSCEIVER_WAITMAX);
+        consume(comm,nullptr,eMultiSenderQueue::eMULTISENDERQ0,false,0,u32I);
+    }
+
+    finishWorker(true);
+}
+
+/* ------------------------------------------------------------ broadcast ------------------------------------------------------------- */
+
+static void broadcastProducer(void *)
+{
+    FRTTCommunicationPartner partner[BENCH_MAXCONSUMERS];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],BENCH_MAXCONSUMERS);
+    addCallbacks(comm);
+
+    for(uint32_t u32C = 0; u32C < g.u32Consumers; u32C++)
+    {
+        comm.addCommPartner(g.consumers[u32C],nullptr,0,nullptr,g.queues[u32C],BENCH_QUEUELENGTH,g.semaphores[u32C],"CONSUMER");
+    }
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        g.sendTimes[u32I] = nowNs();
+
+        if(g.bFanOut) comm.databroadcastFanOut(0,&iPayload,FRTTRANSCEIVER_WAITMAX,u32I);
+        else comm.databroadcast(0,&iPayload,FRTTRANSCEIVER_WAITMAX,FRTTRANSCEIVER_WAITMAX,u32I);
+    }
+
+    finishWorker(false);
+}
+
+static void broadcastConsumer(void * parameter)
+{
+    uint32_t u32Consumer = (uint32_t)(uintptr_t)parameter;
+
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    addCallbacks(comm);
+    comm.addCommPartner(g.producers[0],g.queues[u32Consumer],BENCH_QUEUELENGTH,g.semaphores[u32Consumer],nullptr,0,nullptr,"PRODUCER");
+
+    FRTTLine line = comm.getLine(g.producers[0]);
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        comm.readFromQueue(line,FRTTRANSCEIVER_WAITMAX,FRTTRANSCEIVER_WAITMAX);
+        consume(comm,g.producers[0],eMultiSenderQueue::eNOMULTIQSELECTED,true,u32Consumer,u32I);
+    }
+
+    finishWorker(true);
+}
+
+/* -------------------------------------------------------- notification ping-pong ---------------------------------------------------- */
+
+static void pingTask(void *)
+{
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    comm.addCommPartner(g.consumers[0],nullptr,0,nullptr,nullptr,0,nullptr,"PONG");
+
+    FRTTLine line = comm.getLine(g.consumers[0]);
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        uint64_t u64Start = nowNs();
+
+        comm.NotifyBasic(line);
+        comm.NotifyReceiveBasic(eFRTTNotifyActions::e_CLEARCOUNTONEXIT,FRTTRANSCEIVER_WAITMAX);
+
+        g.latencies[0][u32I] = (uint32_t)(nowNs() - u64Start);
+    }
+
+    finishWorker(true);
+}
+
+static void pongTask(void *)
+{
+    FRTTCommunicationPartner partner[1];
+    FRTTransceiver comm(xTaskGetCurrentTaskHandle(),&partner[0],1);
+    comm.addCommPartner(g.producers[0],nullptr,0,nullptr,nullptr,0,nullptr,"PING");
+
+    FRTTLine line = comm.getLine(g.producers[0]);
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        comm.NotifyReceiveBasic(eFRTTNotifyActions::e_CLEARCOUNTONEXIT,FRTTRANSCEIVER_WAITMAX);
+        comm.NotifyBasic(line);
+    }
+
+    finishWorker(false);
+}
+
+/* -------------------------------------------------------------- runner -------------------------------------------------------------- */
+
+/*! \brief Creates the worker tasks of one scenario (all at once, so that every handle is known before the first one runs) and waits for them */
+static uint64_t runWorkers(TaskFunction_t producer,uint32_t u32Producers,TaskFunction_t consumer,uint32_t u32Consumers)
+{
+    vTaskSuspendAll();
+    for(uint32_t u32I = 0; u32I < u32Consumers; u32I++)
+    {
+        xTaskCreate(consumer,"consumer",BENCH_STACKSIZE,(void *)(uintptr_t)u32I,BENCH_WORKERPRIORITY,&g.consumers[u32I]);
+    }
+    for(uint32_t u32I = 0; u32I < u32Producers; u32I++)
+    {
+        xTaskCreate(producer,"producer",BENCH_STACKSIZE,(void *)(uintptr_t)u32I,BENCH_WORKERPRIORITY,&g.producers[u32I]);
+    }
+    g.u64Start = nowNs();
+    xTaskResumeAll();
+
+    for(uint32_t u32I = 0; u32I < u32Producers + u32Consumers; u32I++)
+    {
+        xSemaphoreTake(g.done,portMAX_DELAY);
+    }
+
+    /* Let the idle task clean up the deleted workers */
+    vTaskDelay(2);
+    return g.u64End - g.u64Start;
+}
+
+/* Rings come from new/delete, not from the FreeRTOS heap. Like heap_3 does for malloc, the scheduler is suspended around the call */
+static void createLines(uint32_t u32Lines,bool bUseRing)
+{
+    for(uint32_t u32I = 0; u32I < u32Lines; u32I++)
+    {
+        if(bUseRing)
+        {
+            vTaskSuspendAll();
+            g.rings[u32I] = FRTTCreateSpscRing(BENCH_QUEUELENGTH);
+            xTaskResumeAll();
+        }
+        else
+        {
+            g.queues[u32I] = FRTTCreateQueue(BENCH_QUEUELENGTH);
+            g.semaphores[u32I] = FRTTCreateSemaphore();
+        }
+    }
+}
+
+static void deleteLines()
+{
+    for(uint32_t u32I = 0; u32I < BENCH_MAXCONSUMERS; u32I++)
+    {
+        if(g.rings[u32I])
+        {
+            vTaskSuspendAll();
+            FRTTDeleteSpscRing(g.rings[u32I]);
+            xTaskResumeAll();
+        }
+        if(g.queues[u32I]) vQueueDelete(g.queues[u32I]);
+        if(g.semaphores[u32I]) vSemaphoreDelete(g.semaphores[u32I]);
+
+        g.rings[u32I] = nullptr;
+        g.queues[u32I] = nullptr;
+        g.semaphores[u32I] = nullptr;
+    }
+}
+
+/*! \brief Cost of single calls without any task switch (the runner is writer and reader of the same line) */
+static void benchCallCost(bool bUseRing)
+{
+    const char * pcTransport = transportName(bUseRing);
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+
+    createLines(1,bUseRing);
+
+    FRTTCommunicationPartner writerPartner[1];
+    FRTTCommunicationPartner readerPartner[1];
+    FRTTransceiver writer(self,&writerPartner[0],1);
+    FRTTransceiver reader(self,&readerPartner[0],1);
+    addCallbacks(writer);
+    addCallbacks(reader);
+
+    if(bUseRing)
+    {
+        writer.addCommPartner(self,nullptr,g.rings[0],"SELF");
+        reader.addCommPartner(self,g.rings[0],nullptr,"SELF");
+    }
+    else
+    {
+        writer.addCommPartner(self,nullptr,0,nullptr,g.queues[0],BENCH_QUEUELENGTH,g.semaphores[0],"SELF");
+        reader.addCommPartner(self,g.queues[0],BENCH_QUEUELENGTH,g.semaphores[0],nullptr,0,nullptr,"SELF");
+        applyWriteMode(writer,self);
+    }
+
+    FRTTLine writerLine = writer.getLine(self);
+    FRTTLine readerLine = reader.getLine(self);
+    uint64_t u64Start = nowNs();
+
+    for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+    {
+        uint64_t u64T0 = nowNs();
+        writer.writeToQueue(writerLine,0,&iPayload,0,0,u32I);
+        uint64_t u64T1 = nowNs();
+        reader.readFromQueue(readerLine,0,0);
+        uint64_t u64T2 = nowNs();
+        reader.delOldestDatabuffForLine(self);
+
+        g.latencies[0][u32I] = (uint32_t)(u64T1 - u64T0);
+        g.latencies[1][u32I] = (uint32_t)(u64T2 - u64T1);
+    }
+
+    uint64_t u64Duration = nowNs() - u64Start;
+
+    addResult("call_writeToQueue",pcTransport,1,g.u32Messages,u64Duration,&g.latencies[0][0],g.u32Messages);
+    addResult("call_readFromQueue",pcTransport,1,g.u32Messages,u64Duration,&g.latencies[1][0],g.u32Messages);
+
+    if(!bUseRing && !g.bFireAndForget)
+    {
+        /* Notifying ourselves: the cost of the call without a context switch */
+        u64Start = nowNs();
+        for(uint32_t u32I = 0; u32I < g.u32Messages; u32I++)
+        {
+            uint64_t u64T0 = nowNs();
+            writer.NotifyBasic(writerLine);
+            g.latencies[0][u32I] = (uint32_t)(nowNs() - u64T0);
+            writer.NotifyReceiveBasic(eFRTTNotifyActions::e_CLEARCOUNTONEXIT,0);
+        }
+        addResult("call_NotifyBasic","notification",1,g.u32Messages,nowNs() - u64Start,&g.latencies[0][0],g.u32Messages);
+    }
+
+    deleteLines();
+}
+
+static void benchOneToOne(bool bUseRing)
+{
+    g.bUseRing = bUseRing;
+    createLines(1,bUseRing);
+
+    uint64_t u64Duration = runWorkers(oneToOneProducer,1,oneToOneConsumer,1);
+    addResult("one_to_one",transportName(bUseRing),1,g.u32Messages,u64Duration,&g.latencies[0][0],g.u32Messages);
+
+    deleteLines();
+    g.bUseRing = false;
+}
+
+static void benchMultiSender()
+{
+    createLines(1,false);
+
+    uint32_t u32Total = (g.u32Messages / BENCH_MULTISENDERS) * BENCH_MULTISENDERS;
+    uint64_t u64Duration = runWorkers(multiSenderProducer,BENCH_MULTISENDERS,multiSenderConsumer,1);
+    addResult("multi_sender",transportName(false),BENCH_MULTISENDERS,u32Total,u64Duration,&g.latencies[0][0],u32Total);
+
+    deleteLines();
+}
+
+static void benchBroadcast(uint32_t u32Consumers,bool bFanOut)
+{
+    g.u32Consumers = u32Consumers;
+    g.bFanOut = bFanOut;
+    createLines(u32Consumers,false);
+
+    uint64_t u64Duration = runWorkers(broadcastProducer,1,broadcastConsumer,u32Consumers);
+
+    /* one latency sample per consumer and data package */
+    for(uint32_t u32C = 0; u32C < u32Consumers; u32C++)
+    {
+        std::copy(g.latencies[u32C].begin(),g.latencies[u32C].begin() + g.u32Messages,g.merged.begin() + u32C * g.u32Messages);
+    }
+    addResult((bFanOut ? "broadcast_fanout" : "broadcast"),"queue",u32Consumers,g.u32Messages,u64Duration,&g.merged[0],u32Consumers * g.u32Messages);
+
+    deleteLines();
+    g.bFanOut = false;
+    g.u32Consumers = 0;
+}
+
+static void benchPingPong()
+{
+    uint64_t u64Duration = runWorkers(pingTask,1,pongTask,1);
+    addResult("notify_pingpong","notification",1,g.u32Messages,u64Duration,&g.latencies[0][0],g.u32Messages);
+}
+
+static void runnerTask(void *)
+{
+    benchCallCost(false);
+    benchCallCost(true);
+
+    benchOneToOne(false);
+    benchOneToOne(true);
+
+    benchMultiSender();
+
+    /* The queue scenarios again, without the tx mirror and the tx semaphore */
+    g.bFireAndForget = true;
+    benchCallCost(false);
+    benchOneToOne(false);
+    benchMultiSender();
+    g.bFireAndForget = false;
+
+    benchBroadcast(1,false);
+    benchBroadcast(4,false);
+    benchBroadcast(BENCH_MAXCONSUMERS,false);
+    benchBroadcast(BENCH_MAXCONSUMERS,true);
+
+    benchPingPong();
+
+    vTaskEndScheduler();
+    vTaskDelete(NULL);
+}
+
+/* --------------------------------------------------------------- main --------------------------------------------------------------- */
+
+extern "C" void vAssertCalled(const char * const pcFileName,unsigned long ulLine)
+{
+    fprintf(stderr,"ASSERT %s:%lu\n",pcFileName,ulLine);
+    abort();
+}
+
+static void writeJson(FILE * out)
+{
+    fprintf(out,"{\n  \"benchmark\": \"FreeRTOS-Transceiver host-posix\",\n");
+    fprintf(out,"  \"queue_length\": %u,\n  \"package_size\": %u,\n  \"tick_rate_hz\": %u,\n  \"messages\": %u,\n  \"results\": [\n",
+                (unsigned)BENCH_QUEUELENGTH,(unsigned)sizeof(FRTTDataContainerOnQueue),(unsigned)configTICK_RATE_HZ,(unsigned)g.u32Messages);
+
+    for(uint32_t u32I = 0; u32I < u32Results; u32I++)
+    {
+        const BenchResult & r = results[u32I];
+        double dThroughput = (r.u64DurationNs ? (double)r.u32Messages * 1e9 / (double)r.u64DurationNs : 0.0);
+
+        fprintf(out,"    {\"scenario\": \"%s\", \"transport\": \"%s\", \"partners\": %u, \"messages\": %u, \"duration_ns\": %llu, "
+                    "\"throughput_msgs_per_s\": %.1f, \"latency_ns\": {\"mean\": %.1f, \"p50\": %u, \"p99\": %u, \"max\": %u}}%s\n",
+                    r.pcScenario,r.pcTransport,r.u32Partners,r.u32Messages,(unsigned long long)r.u64DurationNs,
+                    dThroughput,r.dMeanNs,r.u32P50Ns,r.u32P99Ns,r.u32MaxNs,(u32I + 1 < u32Results ? "," : ""));
+    }
+
+    fprintf(out,"  ]\n}\n");
+}
+
+int main(int argc,char ** argv)
+{
+    uint32_t u32Messages = 20000;
+    const char * pcOutput = nullptr;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i],"--messages") == 0 && i + 1 < argc) u32Messages = (uint32_t)strtoul(argv[++i],nullptr,10);
+        else if(strcmp(argv[i],"--output") == 0 && i + 1 < argc) pcOutput = argv[++i];
+        else
+        {
+            fprintf(stderr,"usage: %s [--messages N] [--output FILE]\n",argv[0]);
+            return 1;
+        }
+    }
+
+    if(u32Messages < BENCH_MULTISENDERS) u32Messages = BENCH_MULTISENDERS;
+
+    /* Tasks must not allocate with malloc directly on the POSIX port, so everything is sized up front */
+    g.u32Messages = u32Messages;
+    g.sendTimes.assign(u32Messages,0);
+    for(uint32_t u32I = 0; u32I < BENCH_MAXCONSUMERS; u32I++) g.latencies[u32I].assign(u32Messages,0);
+    g.merged.assign((size_t)BENCH_MAXCONSUMERS * u32Messages,0);
+    g.done = xSemaphoreCreateCounting(BENCH_MAXCONSUMERS + BENCH_MULTISENDERS,0);
+
+    xTaskCreate(runnerTask,"runner",BENCH_STACKSIZE,nullptr,BENCH_RUNNERPRIORITY,nullptr);
+    vTaskStartScheduler();
+
+    FILE * out = (pcOutput ? fopen(pcOutput,"w") : stdout);
+    if(!out)
+    {
+        fprintf(stderr,"cannot open %s\n",pcOutput);
+        return 1;
+    }
+
+    writeJson(out);
+    if(out != stdout) fclose(out);
+    return 0;
+}
@@ -1,43 +1,43 @@
-/*!
- * \file        Additions.h
- * \brief       Additional data for the examples
- * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
- */
-
-#ifndef ADDITIONS_H
-#define ADDITIONS_H
-
-#include "FRTTransceiver.h"
-
-using namespace FRTT;
-
-
-#define DYNAMIC_STRUCTARRAY 1
-
-/* datatypes recognized throughout the example */
-typedef enum
-{
-   eUINT8BUFF = 0,
-   eCHARSTR,
-   eINTBUFF,
-}eDataTypes;
-
-
-extern FRTTTaskHandle TASK_SENDER;
-extern FRTTTaskHandle TASK_RECEIVER;
-
-extern FRTTQueueHandle QUEUE_TO_RECEIVER;
-
-extern FRTTSemaphoreHandle SEMAPHORE1;
-
-
-#define QUEUELENGTH  (1u)
-
-#define STOP_COMM_AT (5u)
-
-void dataDestroyer(FRTTTempDataContainer & internalBuffer);
-void dataAllocator (const FRTTDataContainerOnQueue & origingalContainer_onQueue ,FRTTTempDataContainer & internalBuffer);
-void SENDER(void *);
-void RECEIVER(void *);
-
+/*!
+ * \file        Additions.h
+ * \brief       Additional data for the examples
+ * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
+ */
+
+#ifndef ADDITIONS_H
+#define ADDITIONS_H
+
+#include "FRTTransceiver.h"
+
+using namespace FRTT;
+
+
+#define DYNAMIC_STRUCTARRAY 1
+
+/* datatypes recognized throughout the example */
+typedef enum
+{
+   eUINT8BUFF = 0,
+   eCHARSTR,
+   eINTBUFF,
+}eDataTypes;
+
+
+extern FRTTTaskHandle TASK_SENDER;
+extern FRTTTaskHandle TASK_RECEIVER;
+
+extern FRTTQueueHandle QUEUE_TO_RECEIVER;
+
+extern FRTTSemaphoreHandle SEMAPHORE1;
+
+
+#define QUEUELENGTH  (1u)
+
+#define STOP_COMM_AT (5u)
+
+void dataDestroyer(FRTTTempDataContainer & internalBuffer);
+void dataAllocator (const FRTTDataContainerOnQueue & origingalContainer_onQueue ,FRTTTempDataContainer & internalBuffer);
+void SENDER(void *);
+void RECEIVER(void *);
+
 #endif
\ No newline at end of file
@@ -1,597 +1,1603 @@
-#ifndef FRTTRANSCEIVER_H
-#define FRTTRANSCEIVER_H
-
-/*!
- * \file        FRTTransceiver.h
- * \brief       Class definition headerfile
- * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
- * \version     v1.2.0
- * \copyright   Copyright 2022 Xhemail Ramabaja
- */
-
-#include "sdkconfig.h"
-
-#if !(ESP32 || ESP8266 || CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP8266)
-#error "FreeRTOS-Transceiver is not usable with this MCU."
-#endif 
-
-#include "FRTTransceiverNotify.h"
-#include "FRTTransceiverExtension.h"
-#include <string>
-#include <chrono>
-
-using namespace std;
-
-namespace FRTT {
-    #if defined(ESP32) || defined (CONFIG_IDF_TARGET_ESP32)
-        /*! 
-        * \brief                         Function for task-creation (ESP32)
-        * \param    taskName             Name of the task
-        * \param    stackbytes           Stack size in BYTES
-        * \param    taskParameter        Pointer to data that is being passed to the task
-        * \param    taskPriority         Priority of the task (Max priority for the ESP32 == configMAX_PRIORITIES)
-        * \param    taskHandle           Address of FRTT::FRTTTaskhandle, which is holding the address to the task control block
-		* \param 	core				 CPU CORE (possible values: 0 and 1)
-        * \return   void                                      
-        */
-        void FRTTCreateTask(FRTTTaskFunction taskCode,
-                            const char * const taskName,
-                            const uint32_t stackbytes,
-                            void * const taskParameter,
-                            FRTTBaseType taskPriority,
-                            FRTTTaskHandle * taskHandle,
-                            const FRTTBaseType core);
-    #elif defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP8266)
-        /*! 
-        * \brief                         Function for Task-Creation (ESP8266)
-        * \param    taskName             Name of the task
-        * \param    stackbytes           Stack size in BYTES
-        * \param    taskParameter        Pointer to data that is being passed to the task
-        * \param    taskPriority         Priority of the task (Max priority for the ESP8266 == configMAX_PRIORITIES)
-        * \param    taskHandle           Address to the task control block
-        * \return   void                                      
-        */
-        void FRTTCreateTask(FRTTTaskFunction taskCode,
-                            const char * const taskName,
-                            const uint16_t stackbytes,
-                            void * const taskParameter,
-                            FRTTBaseType taskPriority,
-                            FRTTTaskHandle * taskHandle);
-    #endif
-
-    /*! 
-    * \brief                       Creates a queue
-    * \param   lengthOfQueue       Holds the desired queuelength
-    * \return                      FRTT::FRTTQueueHandle or nullptr                                      
-    */
-    FRTTQueueHandle FRTTCreateQueue(FRTTBaseType lengthOfQueue);
-    /*! 
-    * \brief                       Creates a semaphore
-    * \return                      Address to the semaphore or nullptr
-    * \note                        The user needs to create one for the tx-line and one for the rx-line                                   
-    */
-    FRTTSemaphoreHandle FRTTCreateSemaphore();
-
-    /*!
-    * \brief   Class definition
-    */
-    class FRTTransceiver
-    {
-        private:                                                                 
-            FRTTTaskHandle _ownerAddress = nullptr;                                 /*!< Address of the task owning this object     */                                           
-            struct FRTTCommunicationPartner * _structCommPartners = nullptr;        /*!< Array of all connections                   */
-            uint8_t _u8CurrCommPartners = 0;                                        /*!< Amount of communications connected to      */
-            uint8_t _u8MaxPartners = 0;                                             /*!< Max amount of possible connections         */
-            uint8_t _u8MultiSenderQueues = 0;                                       /*!< Amount of multi-sender-queues (multiple tasks write on the tx line)            */
-			uint32_t _u32NotificationValue = 0;										/*!< Holds future notification values of the owner task 							*/
-            bool _bHasNotification = false;                                         /*!< Signals whether a notfication was received or not                              */
-            bool _bDelete = false;                                                  /*!< Signals whether delete [] is needed in the destructor                          */
-            bool _bHasValidStruct = false;                                          /*!< Signals whether ::_structCommPartners is NOT nullptr || _u8MaxPartners != 0    */
-
-            #ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-            int _broadcastCount = 0;                                                /*!< Amount of broadcasts made. Important for FRTT::FRTTransceiver::printCommunicationsSummary()          */
-            int _notificationsReceived = 0;                                         /*!< Amount of notifications received. Important for FRTT::FRTTransceiver::printCommunicationsSummary()   */
-            int _tasksNotified = 0;                                                 /*!< Amount of tasks notified. Important for FRTT::FRTTransceiver::printCommunicationsSummary()           */
-            std::chrono::high_resolution_clock::time_point _runtimeStart;           /*!< Starttime taken inside constructor. Important for FRTT::FRTTransceiver::printCommunicationsSummary() */
-            #endif
-
-            fP_dataAllocateCallback _dataAllocator = nullptr;                       /*!< Function pointer to the data allocator callback supplied by the user       */
-            fP_dataFreeCallback _dataDestroyer = nullptr;                           /*!< Function pointer to the data de-allocator callback supplied by the user    */
-
-            /*! 
-            * \brief                        Returns the amount of queues (rx or tx)
-            * \param bTxQueue               Signals whether to return the amount of rx or tx queues          
-            * \return                       The amount of queues (rx or tx) or -1 (if no communication struct available)                          
-            */
-            int _getAmountOfQueues(bool bTxQueue);
-
-            /*! 
-            * \brief                        Checks if the supplied length of one queue is valid
-            * \param u8QueueLength          Length of the queue
-            * \return                       True if the length is valid                           
-            */
-            bool _checkValidQueueLength(uint8_t u8QueueLength);
-            /*! 
-            * \brief                        Checks if the supplied wait-time for read/write operations is valid
-            * \param time_ms                Wait-time in milliseconds
-            * \return                       Wait-time in milliseconds or -2 (-2 because #FRTTRANSCEIVER_WAITMAX is set to -1)                           
-            */
-            int _checkWaitTime(int time_ms);
-            /*! 
-            * \brief                        Rearranges elements inside the internal buffers around (after one element was removed)
-            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners, holding the buffer that needs rearrangement
-            * \param u8PosRemoved           Position in buffer that was removed
-            * \return                       void                           
-            */
-            void _rearrangeTempContainerArray(uint8_t u8CommStructPos,uint8_t u8PosRemoved);
-            /*! 
-            * \brief                        Returns the position of the FRTT::FRTTCommunicationPartner structure
-            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
-            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
-            * \param bUseTaskHandleVar      Signals whether to use the partner parameter or the Multi-Sender-Queue parameter
-            * \return                       Position or -1  
-            * \note                         Here either FRTTTaskHandle or an FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
-            *                               If multiSenderQueue is used, bUseTaskHandleVar is set to false
-            */
-            int _getCommStruct(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-            /*! 
-            * \brief                        Checks if a semaphore is available for the selected line (rx/tx)
-            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
-            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
-            * \param bUseTaskHandleVar      Signals whether to use the partner parameter or the Multi-Sender-Queue parameter
-            * \param txLine                 Signals for which semaphore to check
-            * \return                       True if semaphore available  
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
-            *                               If multiSenderQueue is used, bUseTaskHandleVar is set to false
-            */
-            bool _hasSemaphore(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar, bool bTxLine);
-            /*! 
-            * \brief                        Checks if there are messages on the queue
-            * \param queue                  Address of the queue to check
-            * \return                       True if at least one message on the queue                         
-            */
-            bool _checkForMessages(FRTTQueueHandle queue);
-            /*! 
-            * \brief                        Checks if 'queue' has already been added to a communication line
-            * \param queue                  Address of the queue to look for
-            * \param bTxQueue               Signals what type of queue 'queue' is (rx|tx)
-            * \return                       Returns 1 if queue has already been added<br>
-            *                               Returns 0 if queue has not been added yet<br>
-            *                               Returns -1 if 'queue' is nullptr                        
-            */
-            int _queueExists(FRTTQueueHandle queue,bool bTxQueue);
-            /*! 
-            * \brief                        Checks if 'smph' has already been added to a communication line
-            * \param queue                  Address of the semaphore to look for
-            * \param bTxQueue               Signals what type of semaphore 'smph' is (rx|tx)
-            * \return                       Returns 1 if semaphore has already been added<br>
-            *                               Returns 0 if semaphore has not been added yet<br>
-            *                               Returns -1 if 'smph' is nullptr                        
-            */
-            int _semaphoreExists(FRTTSemaphoreHandle smph,bool bTxSemaphore);
-            /*! 
-            * \brief                        Returns the amount of messages on the queue
-            * \param queue                  Address of the queue to check
-            * \return                       Amount of messages or -1                         
-            */
-            int _getAmountOfMessages(FRTTQueueHandle queue);
-            /*! 
-            * \brief                        Checks if user supplied neccessary callback functions
-            * \return                       True if callbacks available                           
-            */
-            bool _hasDataInterpreters();
-            /*! 
-            * \brief                        Returns the partners name
-            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
-            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
-            * \param bUseTaskHandleVar      Signals whether to use the partner parameter or the Multi-Sender-Queue parameter
-            * \return                       Partners name or empty string  
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
-            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false
-            */
-            string _getPartnersName(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-        public:
-            /*! 
-            * \brief                        FRTTransceiver Constructor (Deleted)
-            * \note                         Will be removed since there are currently no options to add crucial data with class-methods at a later time after instantiation<br>
-            *                               So the user is therefore promted to use the other constructors instead and supply important data right away.                      
-            */
-            FRTTransceiver() = delete;
-            /*! 
-            * \brief                        FRTTransceiver Constructor (1)
-            * \details                      Allocates memory for FRTT::FRTTCommunicationPartner structure (memory will be automatically released when instance<br> 
-            *                               goes out of scope or implicit FRTT::FRTTransceiver::~FRTTransceiver() called)
-            * \param ownerAddress           Address of the task owning this object (can be nullptr, other tasks wont know who the source of messages is)
-            * \param u8MaxPartners          Max possible connections
-			* \note      				    Owner address will only be used to decorate tx packages with a source address (Task notification will know the address of this object)
-            * \attention                    If u8MaxPartners is 0, then the constructor will internally increment it to 1 (min 1 partner)!             
-            */
-            FRTTransceiver(FRTTTaskHandle ownerAddress,uint8_t u8MaxPartners);
-            /*! 
-            * \brief                        FRTTransceiver Constructor (2)
-            * \details                      Receives a pre-declared array of FRTT::FRTTCommunicationPartner
-            * \param ownerAddress           Address of the task owning this object (can be null, other tasks wont know who the source of messages is)
-            * \param u8MaxPartners          Max possible connections
-            * \param commStructs            Pointer to the pre-declared array of FRTT::FRTTCommunicationPartner.
-			* \note      				    Owner address will only be used to decorate tx packages with a source address (Task notification will know the address of this object)   
-            * \attention                    If commStructs is a nullptr OR u8MaxPartners is 0, then all class methods wont work<br>
-            *                               Supplying the wrong u8MaxPartners to the commStruct will result in undefined library behaviour (so make sure array size and u8MaxPartners match!)                  
-            */
-            FRTTransceiver(FRTTTaskHandle ownerAddress,FRTTCommunicationPartner * commStructs,uint8_t u8MaxPartners):   _ownerAddress(ownerAddress),
-                                                                                                                        _structCommPartners(commStructs),
-                                                                                                                        _u8MaxPartners(u8MaxPartners),
-                                                                                                                        _bDelete(false),
-                                                                                                                        _bHasValidStruct(commStructs && u8MaxPartners ? true:false)
-                                                                                                                        {};
-            /*! 
-            * \brief                        Destructor
-            * \details                      Will free memory previously allocated by the constructor (If needed)
-            */
-            ~FRTTransceiver();
-            /*! 
-            * \brief                        Adds a new communication to the list
-            * \param partner                Address of the partner task
-            * \param queueRX                Rx queue to the partner (reading messages from partner)
-            * \param u8QueueLengthRx        Rx queue length
-            * \param semaphoreRx            Rx semaphore
-            * \param queueTX                Tx queue to the partner (writing to the partner)
-            * \param u8QueueLengthTx        Tx queue length
-            * \param semaphoreTx            Tx semaphore
-            * \param partnersName           Partners name
-			* \attention 					If you choose to provide some random invalid address as the partner task, please make sure not to call for any task-notification 'notify task' methods!<br>
-            *                               There is currently no solution available to check if a FRTT::FRTTTaskhandle is valid so the correct execution of this method is in your hands<br>
-            *                               An invalid FRTT::FRTTTaskhandle will result in a FreeRTOS crash!
-            *                                 
-            * \return                       True if communication was added
-            */
-            bool addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,FRTTQueueHandle queueTX,
-                                                       uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,const string partnersName = string());
-        
-            /*! 
-            * \brief                        Adds a new Multi-Sender-Queue connection (multiple tasks write on the tx line)
-            * \param queueRX                Rx queue to the x tasks writing on it
-            * \param u8QueueLengthRx        Rx queue length
-            * \param semaphoreRx            Rx semaphore
-            * \param multiSenderQueueName   Multi-sender-queue name
-            * \return                       True if communication was added
-            * \note                         You can not add a tx queue to this communication, since there is no Multi-Reader-Queue feature.<br>
-            *                               This communication line will therefore be read-only
-            *                               
-            */
-            bool addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
-                        const string multiSenderQueueName = string());
-
-            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-            /*! 
-            * \brief                            Writes to a selected tx queue
-            * \param destination                Destination queue (partner address)
-            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
-            * \param data                       Pointer to the original data
-            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
-            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
-            * \param u32AdditionalInfo          32 Bit additional payload along with void pointer 'data'       
-            * \return                           True if it was successfully written to the tx queue
-            * \note                             Here you can pass a 32 bit variable along with the data pointer. <br>
-            *                                   You can have the same functionality but with an additional 64 bit payload instead, by uncommenting FRTTRANSCEIVER_64BITADDITIONALDATA
-            *                                   in FRTTransceiverSettings.h
-            */
-            bool writeToQueue(FRTTTaskHandle destination,uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
-            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-            /*! 
-            * \brief                            Writes to a selected tx queue
-            * \param destination                Destination queue (partner address)
-            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
-            * \param data                       Pointer to the original data
-            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
-            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
-            * \param u64AdditionalInfo          64 Bit additional payload along with void pointer 'data'       
-            * \return                           True if it was successfully written to the tx queue
-            * \note                             Here you can pass a 64 bit variable along with the data pointer. <br>
-            *                                   You can have the same functionality but with an additional 32 bit payload instead, by uncommenting FRTTRANSCEIVER_32BITADDITIONALDATA
-            *                                   in FRTTransceiverSettings.h
-            */
-            bool writeToQueue(FRTTTaskHandle destination,uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
-            #endif
-
-            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-            /*! 
-            * \brief                            Broadcasts data to all communication lines with a tx connection
-            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
-            * \param data                       Pointer to the original data
-            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to ONE of the queues (milliseconds)
-            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire ONE of the semaphores for the operation (milliseconds)
-            * \param u32AdditionalInfo          32 Bit additional payload along with void pointer 'data'
-            * \return                           True if it was successfully written to ALL tx connections. <br>
-            *                                   False if at least one write operation failed
-            * \note                             Supplied block-time's will be used for each write operation!
-            * \note                             Databroadcast will proceed even if a write operation failed <br>
-            *                                   Here you can pass a 32 bit variable along with the data pointer. <br>
-            *                                   You can have the same functionality but with an additional 64 bit payload instead, by uncommenting FRTTRANSCEIVER_64BITADDITIONALDATA
-            *                                   in FRTTransceiverSettings.h
-            * \attention                        Do not use this feature when you have a lot of tx connections
-            *                                   and it's particularly hard to get instant permission to write on at least one of them<br>
-            *                                   However, if you still need to, at least keep  blockTimeWrite_Ms and blockTimeTakeSemaphore_Ms very low                   
-            */
-            bool databroadcast(uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
-            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-            /*! 
-            * \brief                            Broadcasts data to all communication lines with a tx connection
-            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
-            * \param data                       Pointer to the original data
-            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to ONE of the queues (milliseconds)
-            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire ONE of the semaphores for the operation (milliseconds)
-            * \param u64AdditionalInfo          64 Bit additional payload along with void pointer 'data'
-            * \return                           True if it was successfully written to ALL tx connections. <br>
-            *                                   False if at least one write operation failed
-            * \note                             Supplied block-time's will be used for each write operation!
-            * \note                             Databroadcast will proceed even if a write operation failed <br>
-            *                                   Here you can pass a 64 bit variable along with the data pointer. <br>
-            *                                   You can have the same functionality but with an additional 32 bit payload instead, by uncommenting FRTTRANSCEIVER_32BITADDITIONALDATA
-            *                                   in FRTTransceiverSettings.h
-            * \attention                        Do not use this feature when you have a lot of tx connections
-            *                                   and it's particularly hard to get instant permission to write on at least one of them<br>
-            *                                   However, if you still need to, at least keep  blockTimeWrite_Ms and blockTimeTakeSemaphore_Ms very low                   
-            */
-            bool databroadcast(uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
-            #endif
-            /*! 
-            * \brief                            Reads from a selected queue (either normal queue or multi-sender-queue)
-            * \param partner                    To select the queue to read from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue           To select the Multi-Sender-Queue to read from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar          Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \param blockTimeRead_Ms           How long the task calling this method should be put into a blocked state (max) until it is allowed to read from the queue (milliseconds)
-            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
-            * \return                           True if data read
-            * \note                             Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                                   If 'partner' is used, bUseTaskHandleVar is set to true.<br>
-            *                                   If multiSenderQueue is used, bUseTaskHandleVar is set to false                         
-            */
-            bool readFromQueue(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms);
-            /*! 
-            * \brief                            Flushes rx/tx queue                      
-            * \param partner                    To select the queue to flush (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue           To select the Multi-Sender-Queue to flush (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar          Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
-            * \param bTxQueue                   Signals whether to use the tx line of the connection or the rx line
-            * \return                           True if queue flushed 
-            * \note                             Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enum is supplied. <br>
-            *                                   If 'partner' is used, bUseTaskHandleVar is set to true.<br>
-            *                                   If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                 
-            */
-            bool queueFlush(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,int blockTimeTakeSemaphore_Ms,bool bTxQueue);
-
-            /*! 
-            * \brief                        Deletes an entry in the internal rx buffer                      
-            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \param u8PositionInBuffer     Position in rx buffer to clear
-            * \return                       True if data "deleted"
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If 'partner' is used, bUseTaskHandleVar is set to true.<br>
-            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                               
-            */
-            bool delDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8PositionInBuffer);
-            /*! 
-            * \brief                        Flushes the rx buffer for a specific communication line                    
-            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \return                       True if buffer flushed 
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If 'partner' is used, bUseTaskHandleVar is set to true.<br>
-            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                 
-            */
-            bool delAllDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-
-            /*! 
-            * \brief                        Deletes oldest entry in the internal rx buffer (of a normal communication line)
-            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \return                       True if oldest data deleted
-            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                   
-            */                                          
-            bool delOldestDatabuffForLine(FRTTTaskHandle partner);
-            /*! 
-            * \brief                        Deletes oldest entry in the internal rx buffer of a Multi-Sender-Queue
-            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \return                       True if oldest data deleted
-            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                         
-            */ 
-            bool delOldestDatabuffForLine(eMultiSenderQueue multiSenderQueue);
-            /*! 
-            * \brief                        Deletes latest entry in the rx buffer for a specific communication line                  
-            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \return                       True if newest data deleted
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
-            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                              
-            */
-            bool delNewestDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-            /*! 
-            * \brief                        Returns the amount of messages on a selected queue
-            * \param partner                To select the queue to check the amount of messages from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bCheckTxQueue          Signals whether to check tx or rx queue
-            * \return                       Amount of messages on the selected queue or -1                         
-            */
-            int messagesOnQueue(FRTTTaskHandle partner, bool bCheckTxQueue);
-            /*! 
-            * \brief                        Returns the amount of messages on a selected Multi-Sender-Queue (multiple tasks write on the tx line)
-            * \param multiSenderQueue       To select the specific internal multi-sender-queue to check the amount of messages from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \return                       Amount of messages on the selected queue or -1                           
-            */
-            int messagesOnQueue(eMultiSenderQueue multiSenderQueue);
-
-            /*! 
-            * \brief                        Checks if buffered rx data available                  
-            * \param partner                To select the specific internal rx buffer to check for data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer to check for data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \return                       True if buffered data available
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If 'partner' is used, bUseTaskHandleVar is set to true.<br>
-            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                
-            */
-            bool hasDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-            /*! 
-            * \brief                        Returns the amount of buffered data for a specific communication line                  
-            * \param partner                To select the specific internal rx buffer to check for the amount of buffered data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer to check for the amount of buffered data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \return                       Amount of buffered data or -1
-            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
-            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
-            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                
-            */
-            int bufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-            /*! 
-            * \brief                        Returns the amount of buffered data for a all communication lines combined                
-            * \return                       Amount of buffered data or -1 if FRTT::FRTTransceiver::_bHasValidStruct is true                                             
-            */
-            int bufferedDataInAllBuffers();
-        
-            /*! 
-            * \brief                        Checks if datatype found in rx buffer for a specific communication line
-            * \param partner                To select the specific internal rx buffer to check for the datatype (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer to check for the datatype (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
-            * \param u8Datatype             Datatype to look for (Create your own system wide datatypes)
-            * \return                       Amount of datatype occurences or -1                        
-            */
-            int isDatatypeInBuffer(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8Datatype);
-
-            /*! 
-            * \brief                        Returns the newest buffered data for a specific communication line
-            * \param partner                To select the specific internal rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter 
-            * \return                       Const pointer to the buffer position or NULL
-            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                          
-            */
-            const FRTTTempDataContainer * getNewestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-            /*! 
-            * \brief                        Returns the oldest buffered data for a specific communication line
-            * \param partner                To select the specific internal rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or multiSenderQueue parameter 
-            * \return                       Const pointer to the buffer position or NULL
-            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                          
-            */
-            const FRTTTempDataContainer * getOldestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
-            /*! 
-            * \brief                        Returns a selected part of the buffered data for a specific communication line
-            * \param partner                To select the specific internal rx buffer from which the data should be taken (Used to select the right entry in FRTTCommunicationPartner)
-            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer from which the data should be taken (Used to select the right entry in FRTTCommunicationPartner)
-            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter 
-            * \param u8PositionInBuffer     Position from which the data should be taken
-            * \return                       Const pointer to the buffer position or NULL
-            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                          
-            */
-            const FRTTTempDataContainer * getBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8PositionInBuffer);
-			/*! 
-            * \brief                            Sets the partner tasks notification state to pending (if not already pending!!) and increments its notification value (adds 1 to the value).
-            * \param partner                    Partner task to notify
-            * \return						    Will always return true unless you provided wrong parameters 
-            *                                   Will return false if any of the situations mentioned in 'note' below happened 
-            * \note                             Even if the receving task has a notification pending, this method will always increment the partner tasks notification value!                    
-            * \note                             Internally the library only checks: - Partner has been added to the list of communications<br>
-            *                                                                       - Partner is not a Multi-Sender-Queue || partner is not nullptr<br>
-            *                                   There is currently no solution available to check if a FRTTTaskhandle is valid so the correct execution of this method is in your hands<br>
-            *                                   An invalid FRTT::FRTTTaskhandle will result in a FreeRTOS crash!
-            */
-            bool NotifyBasic(FRTTTaskHandle partner);
-            /*! 
-            * \brief                            Extended version of FRTT:FRTTransceiver::NotifyBasic()
-            * \details                          In this version of the notify funcionality you can do: 
-            *                                       - Increment partner tasks notification value by 1 (equivalent to FRTT::FRTTransceiver::NotifyBasic())
-            *                                       - Set single bits in the partner tasks notification value (---> lightweight eventgroup)
-            *                                       - Update partner tasks notification value (only if partner task has no notification pending, similar to a queue with length 1)
-            *                                       - Update parnter tasks notification value (even if partner task has notification pending, similar to queueOverwrite())
-            * \param partner                    Partner task to notify         
-            * \param action                     Ways to update the notification value : [e_NoAction, e_SetBits, e_Increment,e_SetValueWithOverwrite,e_SetValueWithoutOverwrite]<br>
-            *                                   Check their description in FRTTransceiverNotify.h
-            * \param u32NotificationMask        Notification value/mask. Its usage depends on the 'action' provided.           
-            * \return						    Almost always true, except when action == FRTT::eFRTTNotifyActions::eSetValueWithoutOverwrite and the partner task had a notification pending
-            * \note                                                 
-            */
-            bool NotifyExtended(FRTTTaskHandle partner,eFRTTNotifyActions action,uint32_t u32NotificationMask);
-			/*! 
-            * \brief                        	Checks if the owner of this object has a notification pending
-            * \param 	action                	Set to FRTT:eNotifyAction::eCLEARCOUNTONEXIT to tell FreeRTOS to clear the notification value to 0
-            *                                   Set to FRTT:eNotifyAction::eCLEARCOUNTONEXITNOT to tell FreeRTOS to simply decrement the notification value at the end
-            * \return							*This object. Immediately call FRTT::FRTTransceiver::getNotificationVal() or FRTT::FRTTransceiver:hasNotification() for infos.<br>      
-            * \attention                        The final notification value put into the internal buffer can be 0.<br>
-            *                                   That would mean that no task notified us and FRTT::FRTTransceiver:hasNotification() will therefore return false<br>
-            *                                   The internal FreeRTOS method used in this basic version only checks for a notification value > 0
-            *                                                        
-            */
-            FRTTransceiver & NotifyReceiveBasic(eFRTTNotifyActions action,int blockTimeReceive_Ms);
-            /*! 
-            * \brief                        	Extended version of FRTT::FRTTransceiver::NofityReceiveBasic()
-            * \details                          In this version of the notify-receive functionality you can do:
-            *                                       - Clear bits (RIGHT ONENTRY) for the notification value of the owner task of this object (will only be cleared if no notification pending)
-            *                                       - Clear bits (AFTER xTaskNotifyWait()) for the notification value of the owner task of this object <br>
-            *                                         (will only be cleared if notification received / notification was already pending)
-            * \param    u32ClearOnEntryMask     Same bits as in this mask will be cleared (ONENTRY, before 'receive') in the notification value of the owner of this task (will only be cleared if no notification pending)<br>
-            *                                   Example: u32ClearOnEntryMask == 0x03, notificationBefore == 0x0011 ---> notificationValUpdated == 0x0000
-            * \param    u32ClearOnExitMask      Same bits as in this mask will be cleared (ONEXIT, after 'receive') in the notification value of the owner of this task (only if notification was received)
-            *                                   Example: u32ClearOnEntryMask == 0x03, notificationBefore == 0x0011 ---> notificationValUpdated == 0x0000                                    
-            * \return							*This object. Immediately call FRTT::FRTTransceiver::getNotificationVal() or FRTT::FRTTranceiver::hasNotification() to get infos      
-            * \note                             This method will also signal that a notification was received when the notification value == 0!                     
-            */
-            FRTTransceiver & NotifyReceiveExtended(uint32_t u32ClearOnEntryMask,uint32_t u32ClearOnExitMask,int blockTimeReceive_Ms);
-            /*! 
-            * \brief                            Returns the last notification value received	           
-            * \return					        32 Bit notification value                             
-            * \note                             A call to FRTT::FRTTransceiver::NotifyReceiveBasic() or FRTT::FRTTransceiver::NotifiyReceiveExtended() will update this value
-            * \note                             Return value -> Greater than zero: notification received. Zero:  Nothing received. 
-            */
-            uint32_t getNotificationVal();
-            /*! 
-            * \brief                            Sets the internal notification variable to zero	           
-            * \return					        void                            
-            */
-            void clearNotificationVal();
-            /*! 
-            * \brief                            Returns whether we had receveid a notification with the last call to any of the 'NotifyReceivexXx' methods.      
-            * \return                           True or false                            
-            */
-            bool hasNotification();
-            /*! 
-            * \brief                        To to add an allocator callback function
-            * \details                      This method is used to add an allocator callback function to the library.
-            *                               When the library reads data off the queue, it will do so by copying its content into a FRTT::FRTTDataContainerOnQueue structure.<br>
-            *                               After that, the library aquires the next free space in the internal rx buffer (FRTT::FRTTTempDataContainer) and places a call to the allocator callback<br>
-            *                               Now the callback function will be called, in which the user of the library can just copy everything (pointer to the original data of communication partner) 
-            *                               over OR allocate memory (e.g malloc) and then copy data into own variables.
-            * \param fP                     Pointer to a function which takes FRTT::FRTTDataContainerOnQueue and FRTT::FRTTTempDataContainer as an argument.
-            * \return                       void
-            * \attention                    Later versions of the library will support some sort of memory pool to allocate/free data through the callbacks
-            */ 
-            void addDataAllocateCallback(void(*fP)(const FRTTDataContainerOnQueue &, FRTTTempDataContainer &));
-            /*! 
-            * \brief                        To to add a de-allocator callback function
-            * \details                      This method is used to add a de-allocator callback function to the library.
-            *                               The user of the library should basically reverse the steps made in FRTT::FRTTransceiver::addDataAllocateCallback() <br>
-            * \param fP                     Pointer to a function which takes FRTT::FRTTDataContainerOnQueue and FRTT::FRTTTempDataContainer as an argument.
-            * \return                       void
-            * \attention                    Later versions of the library will support some sort of memory pool to allocate/free data through the callbacks
-            */
-            void addDataFreeCallback(void (*fP)(FRTTTempDataContainer &));
-            
-
-            #if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE)
-            /*! 
-            * \brief                        Prints a good summary of all communication lines (TURN ON by uncommenting #FRTTRANSCEIVER_ANALYTICS_ENABLE in FRTTransceiverSettings.h)
-            * \return                       void                           
-            */
-            void printCommunicationsSummary();
-            #endif
-    };
-}
+#ifndef FRTTRANSCEIVER_H
+#define FRTTRANSCEIVER_H
+
+/*!
+ * \file        FRTTransceiver.h
+ * \brief       Class definition headerfile
+ * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
+ * \version     v1.2.0
+ * \copyright   Copyright 2022 Xhemail Ramabaja
+ */
+
+#include "sdkconfig.h"
+
+#if !(ESP32 || ESP8266 || CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP8266)
+#error "FreeRTOS-Transceiver is not usable with this MCU."
+#endif 
+
+#include "FRTTransceiverNotify.h"
+#include "FRTTransceiverExtension.h"
+#include "FRTTransceiverPool.h"
+#include <string>
+
+using namespace std;
+
+namespace FRTT {
+    #if defined(ESP32) || defined (CONFIG_IDF_TARGET_ESP32)
+        /*! 
+        * \brief                         Function for task-creation (ESP32)
+        * \param    taskName             Name of the task
+        * \param    stackbytes           Stack size in BYTES
+        * \param    taskParameter        Pointer to data that is being passed to the task
+        * \param    taskPriority         Priority of the task (Max priority for the ESP32 == configMAX_PRIORITIES)
+        * \param    taskHandle           Address of FRTT::FRTTTaskhandle, which is holding the address to the task control block
+		* \param 	core				 CPU CORE (possible values: 0 and 1)
+        * \return   void                                      
+        */
+        void FRTTCreateTask(FRTTTaskFunction taskCode,
+                            const char * const taskName,
+                            const uint32_t stackbytes,
+                            void * const taskParameter,
+                            FRTTBaseType taskPriority,
+                            FRTTTaskHandle * taskHandle,
+                            const FRTTBaseType core);
+    #elif defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP8266)
+        /*! 
+        * \brief                         Function for Task-Creation (ESP8266)
+        * \param    taskName             Name of the task
+        * \param    stackbytes           Stack size in BYTES
+        * \param    taskParameter        Pointer to data that is being passed to the task
+        * \param    taskPriority         Priority of the task (Max priority for the ESP8266 == configMAX_PRIORITIES)
+        * \param    taskHandle           Address to the task control block
+        * \return   void                                      
+        */
+        void FRTTCreateTask(FRTTTaskFunction taskCode,
+                            const char * const taskName,
+                            const uint16_t stackbytes,
+                            void * const taskParameter,
+                            FRTTBaseType taskPriority,
+                            FRTTTaskHandle * taskHandle);
+    #endif
+
+    /*! 
+    * \brief                       Creates a queue
+    * \param   lengthOfQueue       Holds the desired queuelength
+    * \return                      FRTT::FRTTQueueHandle or nullptr                                      
+    */
+    FRTTQueueHandle FRTTCreateQueue(FRTTBaseType lengthOfQueue);
+    /*! 
+    * \brief                       Creates a semaphore
+    * \return                      Address to the semaphore or nullptr
+    * \note                        The user needs to create one for the tx-line and one for the rx-line                                   
+    */
+    FRTTSemaphoreHandle FRTTCreateSemaphore();
+    /*! 
+    * \brief                       Creates a single-producer/single-consumer ring (alternative to a queue for a 1:1 communication line)
+    * \param   lengthOfRing        Holds the desired ringlength (up to FRTTRANSCEIVER_MAXLINEDEPTH)
+    * \return                      FRTT::FRTTSpscRingHandle or nullptr
+    * \note                        Exactly one task may write to the ring and exactly one task may read from it. No semaphore is needed.<br>
+    *                              A ring longer than FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE needs a FRTT::FRTTLineStorage when it is added to a communication line
+    */
+    FRTTSpscRingHandle FRTTCreateSpscRing(FRTTBaseType lengthOfRing);
+    /*! 
+    * \brief                       Deletes a ring previously created with FRTT::FRTTCreateSpscRing()
+    * \param   ring                Address of the ring
+    * \return                      void
+    * \attention                   The ring must not be part of a communication line anymore
+    */
+    void FRTTDeleteSpscRing(FRTTSpscRingHandle ring);
+
+    #if (configSUPPORT_STATIC_ALLOCATION == 1)
+    /*! 
+    * \brief                       Creates a queue in memory supplied by the caller (no heap allocation)
+    * \param   lengthOfQueue       Holds the desired queuelength
+    * \param   storage             Memory for lengthOfQueue data packages (lengthOfQueue * sizeof(FRTT::FRTTDataContainerOnQueue) bytes)
+    * \param   queueBuffer         Memory of the queue control block
+    * \return                      FRTT::FRTTQueueHandle or nullptr
+    * \note                        FRTT::FRTTStaticQueue holds both, see the overload below
+    */
+    FRTTQueueHandle FRTTCreateQueueStatic(FRTTBaseType lengthOfQueue,uint8_t * storage,StaticQueue_t * queueBuffer);
+    /*! 
+    * \brief                       Creates a queue of length N in a FRTT::FRTTStaticQueue (no heap allocation)
+    * \param   storage             Memory of the queue
+    * \return                      FRTT::FRTTQueueHandle or nullptr
+    */
+    template<uint8_t N>
+    FRTTQueueHandle FRTTCreateQueueStatic(FRTTStaticQueue<N> & storage)
+    {
+        return FRTTCreateQueueStatic(N,storage.au8Storage,&storage.queueBuffer);
+    }
+    /*! 
+    * \brief                       Creates a semaphore in memory supplied by the caller (no heap allocation)
+    * \param   storage             Memory of the semaphore
+    * \return                      Address to the semaphore or nullptr
+    */
+    FRTTSemaphoreHandle FRTTCreateSemaphoreStatic(FRTTStaticSemaphore & storage);
+
+    #if defined(ESP32) || defined (CONFIG_IDF_TARGET_ESP32)
+        /*! 
+        * \brief                         Function for task-creation in memory supplied by the caller (ESP32, no heap allocation)
+        * \param    taskName             Name of the task
+        * \param    stack                Stack of the task
+        * \param    stackDepth           Size of the stack (amount of StackType_t entries, bytes on the ESP32)
+        * \param    taskParameter        Pointer to data that is being passed to the task
+        * \param    taskPriority         Priority of the task (Max priority for the ESP32 == configMAX_PRIORITIES)
+        * \param    taskBuffer           Memory of the task control block
+        * \param    taskHandle           Address of FRTT::FRTTTaskhandle, which is holding the address to the task control block (can be nullptr)
+        * \param    core                 CPU CORE (possible values: 0 and 1)
+        * \return   True if the task was created
+        */
+        bool FRTTCreateTaskStatic(FRTTTaskFunction taskCode,
+                                  const char * const taskName,
+                                  StackType_t * stack,
+                                  const uint32_t stackDepth,
+                                  void * const taskParameter,
+                                  FRTTBaseType taskPriority,
+                                  StaticTask_t * taskBuffer,
+                                  FRTTTaskHandle * taskHandle,
+                                  const FRTTBaseType core);
+        /*! 
+        * \brief                         Creates a task in a FRTT::FRTTStaticTask (ESP32, no heap allocation)
+        * \param    storage              Memory of the task (stack and task control block)
+        * \return   True if the task was created
+        * \note     See the overload above for the other parameters
+        */
+        template<uint32_t StackBytes>
+        bool FRTTCreateTaskStatic(FRTTTaskFunction taskCode,
+                                  const char * const taskName,
+                                  FRTTStaticTask<StackBytes> & storage,
+                                  void * const taskParameter,
+                                  FRTTBaseType taskPriority,
+                                  FRTTTaskHandle * taskHandle,
+                                  const FRTTBaseType core)
+        {
+            return FRTTCreateTaskStatic(taskCode,taskName,storage.stack,sizeof(storage.stack) / sizeof(StackType_t),taskParameter,taskPriority,&storage.taskBuffer,taskHandle,core);
+        }
+    #elif defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP8266)
+        /*! 
+        * \brief                         Function for task-creation in memory supplied by the caller (ESP8266, no heap allocation)
+        * \param    taskName             Name of the task
+        * \param    stack                Stack of the task
+        * \param    stackDepth           Size of the stack (amount of StackType_t entries)
+        * \param    taskParameter        Pointer to data that is being passed to the task
+        * \param    taskPriority         Priority of the task (Max priority for the ESP8266 == configMAX_PRIORITIES)
+        * \param    taskBuffer           Memory of the task control block
+        * \param    taskHandle           Address to the task control block (can be nullptr)
+        * \return   True if the task was created
+        */
+        bool FRTTCreateTaskStatic(FRTTTaskFunction taskCode,
+                                  const char * const taskName,
+                                  StackType_t * stack,
+                                  const uint32_t stackDepth,
+                                  void * const taskParameter,
+                                  FRTTBaseType taskPriority,
+                                  StaticTask_t * taskBuffer,
+                                  FRTTTaskHandle * taskHandle);
+        /*! 
+        * \brief                         Creates a task in a FRTT::FRTTStaticTask (ESP8266, no heap allocation)
+        * \param    storage              Memory of the task (stack and task control block)
+        * \return   True if the task was created
+        * \note     See the overload above for the other parameters
+        */
+        template<uint32_t StackBytes>
+        bool FRTTCreateTaskStatic(FRTTTaskFunction taskCode,
+                                  const char * const taskName,
+                                  FRTTStaticTask<StackBytes> & storage,
+                                  void * const taskParameter,
+                                  FRTTBaseType taskPriority,
+                                  FRTTTaskHandle * taskHandle)
+        {
+            return FRTTCreateTaskStatic(taskCode,taskName,storage.stack,sizeof(storage.stack) / sizeof(StackType_t),taskParameter,taskPriority,&storage.taskBuffer,taskHandle);
+        }
+    #endif
+    #endif
+
+    static_assert((FRTTRANSCEIVER_PARTNERINDEXSIZE & (FRTTRANSCEIVER_PARTNERINDEXSIZE - 1)) == 0 && FRTTRANSCEIVER_PARTNERINDEXSIZE <= 256,
+                                                                        "FRTTRANSCEIVER_PARTNERINDEXSIZE must be a power of two (max 256)");
+
+    /*!
+    * \brief   Class definition
+    */
+    class FRTTransceiver
+    {
+        private:                                                                 
+            FRTTTaskHandle _ownerAddress = nullptr;                                 /*!< Address of the task owning this object     */                                           
+            #if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+            uint8_t _u8SenderId = 0;                                                /*!< Id of the owner task stamped on every data package (FRTT::FRTTSenderId())  */
+            #endif
+            struct FRTTCommunicationPartner * _structCommPartners = nullptr;        /*!< Array of all connections                   */
+            uint8_t _u8CurrCommPartners = 0;                                        /*!< Amount of communications connected to      */
+            uint8_t _u8MaxPartners = 0;                                             /*!< Max amount of possible connections         */
+            uint8_t _u8MultiSenderQueues = 0;                                       /*!< Amount of multi-sender-queues (multiple tasks write on the tx line)            */
+			uint32_t _u32NotificationValue = 0;										/*!< Holds future notification values of the owner task 							*/
+            bool _bHasNotification = false;                                         /*!< Signals whether a notfication was received or not                              */
+            FRTTNotificationHandler * _notificationHandlers = nullptr;              /*!< Bit table of FRTT::FRTTransceiver::dispatchNotifications() (supplied by the user, FRTTRANSCEIVER_NOTIFICATIONBITS entries)  */
+            const FRTTDatatypeTable * _datatypeTable = nullptr;                     /*!< Handler table of FRTT::FRTTransceiver::dispatch() for lines without an own table                                            */
+            uint32_t _u32DispatchMask = 0;                                          /*!< Bits bound in ::_notificationHandlers (cleared by FRTT::FRTTransceiver::dispatchNotifications())                           */
+            bool _bDelete = false;                                                  /*!< Signals whether delete [] is needed in the destructor                          */
+            bool _bHasValidStruct = false;                                          /*!< Signals whether ::_structCommPartners is NOT nullptr || _u8MaxPartners != 0    */
+
+            uint8_t _u8PartnerIndex[FRTTRANSCEIVER_PARTNERINDEXSIZE] = {};         /*!< Open addressing hash table (FRTT::FRTTTaskHandle -> position in ::_structCommPartners + 1, 0 == empty)   */
+            uint8_t _u8MultiSenderSlots[FRTTRANSCEIVER_MAXMULTISENDERQUEUES] = {};  /*!< Position in ::_structCommPartners for each FRTT::eMultiSenderQueue enumerator                           */
+            uint8_t _u8IndexedPartners = 0;                                         /*!< Amount of partners stored in ::_u8PartnerIndex                                                          */
+            bool _bPartnerIndexOverflow = false;                                    /*!< Signals whether a partner did not fit into ::_u8PartnerIndex (lookup falls back to a linear scan)      */
+
+            eFRTTSchedulingPolicy _schedulingPolicy = eFRTTSchedulingPolicy::e_WEIGHTEDROUNDROBIN;   /*!< Policy of FRTT::FRTTransceiver::serviceLines()                         */
+            uint8_t _u8NextServiceLine = 0;                                         /*!< Line FRTT::FRTTransceiver::serviceLines() continues with (round-robin position)            */
+
+            #if (configUSE_QUEUE_SETS == 1)
+            QueueSetHandle_t _rxQueueSet = nullptr;                                 /*!< Queue set holding all rx queues. Created by the first call to FRTT::FRTTransceiver::readFromAny()      */
+            bool _bRxQueueSetStale = false;                                         /*!< Signals that the readable rx lines changed after ::_rxQueueSet was created (set is rebuilt)           */
+            #endif
+
+            #ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+            std::atomic<uint32_t> _broadcastCount {0};                              /*!< Amount of broadcasts made. See FRTT::FRTTransceiver::getStatistics()                       */
+            std::atomic<uint32_t> _notificationsReceived {0};                       /*!< Amount of notifications received. See FRTT::FRTTransceiver::getStatistics()                */
+            std::atomic<uint32_t> _tasksNotified {0};                               /*!< Amount of tasks notified. See FRTT::FRTTransceiver::getStatistics()                        */
+            TickType_t _runtimeStart = xTaskGetTickCount();                         /*!< Tick count taken when the object was created. See FRTT::FRTTransceiver::getStatistics()    */
+            #endif
+
+            fP_dataAllocateCallback _dataAllocator = nullptr;                       /*!< Function pointer to the data allocator callback supplied by the user       */
+            fP_dataFreeCallback _dataDestroyer = nullptr;                           /*!< Function pointer to the data de-allocator callback supplied by the user    */
+
+            /*! 
+            * \brief                        Returns the amount of queues (rx or tx)
+            * \param bTxQueue               Signals whether to return the amount of rx or tx queues          
+            * \return                       The amount of queues (rx or tx) or -1 (if no communication struct available)                          
+            */
+            int _getAmountOfQueues(bool bTxQueue);
+
+            /*! 
+            * \brief                        Checks if the supplied length of one queue is valid
+            * \param u8QueueLength          Length of the queue
+            * \param u8Depth                Depth of the storage of the communication line (FRTT::FRTTCommunicationPartner::u8Depth)
+            * \return                       True if the length is valid                           
+            */
+            bool _checkValidQueueLength(uint8_t u8QueueLength,uint8_t u8Depth);
+            /*! 
+            * \brief                        Adds a new communication to the list (see FRTT::FRTTransceiver::addCommPartner())
+            * \param txLineStorage          Storage for FRTT::FRTTCommunicationPartner::txLineContainer or nullptr (embedded storage)
+            * \param tempStorage            Storage for FRTT::FRTTCommunicationPartner::tempContainer or nullptr (embedded storage)
+            * \param sharedStorage          Storage for FRTT::FRTTCommunicationPartner::sharedPayload or nullptr (embedded storage)
+            * \param u8Depth                Amount of entries of each storage array
+            * \return                       True if communication was added
+            */
+            bool _addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,FRTTQueueHandle queueTX,
+                                    uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,const char * partnersName,
+                                    FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth);
+            /*! 
+            * \brief                        Adds a new Multi-Sender-Queue to the list (see FRTT::FRTTransceiver::addMultiSenderPartner())
+            * \param txLineStorage          Storage for FRTT::FRTTCommunicationPartner::txLineContainer or nullptr (embedded storage)
+            * \param tempStorage            Storage for FRTT::FRTTCommunicationPartner::tempContainer or nullptr (embedded storage)
+            * \param sharedStorage          Storage for FRTT::FRTTCommunicationPartner::sharedPayload or nullptr (embedded storage)
+            * \param u8Depth                Amount of entries of each storage array
+            * \return                       True if communication was added
+            */
+            bool _addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,const char * multiSenderQueueName,
+                                    FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth);
+            /*! 
+            * \brief                        Adds a new communication using rings to the list (see FRTT::FRTTransceiver::addCommPartner())
+            * \param txLineStorage          Storage for FRTT::FRTTCommunicationPartner::txLineContainer or nullptr (embedded storage)
+            * \param tempStorage            Storage for FRTT::FRTTCommunicationPartner::tempContainer or nullptr (embedded storage)
+            * \param sharedStorage          Storage for FRTT::FRTTCommunicationPartner::sharedPayload or nullptr (embedded storage)
+            * \param u8Depth                Amount of entries of each storage array
+            * \return                       True if communication was added
+            */
+            bool _addCommPartner(FRTTTaskHandle partner,FRTTSpscRingHandle ringRX,FRTTSpscRingHandle ringTX,const char * partnersName,
+                                    FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth);
+            /*! 
+            * \brief                        Hands the storage to the communication line that is about to be added
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       void
+            */
+            void _assignStorage(uint8_t u8CommStructPos,FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth);
+            /*! 
+            * \brief                        Checks if the supplied wait-time for read/write operations is valid
+            * \param time_ms                Wait-time in milliseconds
+            * \return                       Wait-time in milliseconds or -2 (-2 because #FRTTRANSCEIVER_WAITMAX is set to -1)                           
+            */
+            int _checkWaitTime(int time_ms);
+            /*! 
+            * \brief                        Closes the gap inside the internal buffer after one element was removed
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners, holding the buffer that needs rearrangement
+            * \param u8PosRemoved           Position in buffer that was removed (0 = oldest)
+            * \return                       void                           
+            * \note                         Removing the oldest or the newest entry costs no copy. Otherwise the shorter side of the buffer is moved
+            */
+            void _closeBufferGap(uint8_t u8CommStructPos,uint8_t u8PosRemoved);
+            /*! 
+            * \brief                        Translates a position in the internal buffer (0 = oldest) into an index of FRTT::FRTTCommunicationPartner::tempContainer
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param u8PositionInBuffer     Position in the internal buffer
+            * \return                       Index of the entry in FRTT::FRTTCommunicationPartner::tempContainer
+            */
+            uint8_t _bufferIndex(uint8_t u8CommStructPos,uint8_t u8PositionInBuffer);
+            /*! 
+            * \brief                        Counts the buffered data packages of one datatype (datatype index or scan of the buffer)
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param u8Datatype             Datatype to count
+            * \return                       Amount of buffered data packages with that datatype
+            */
+            int _countDatatype(uint8_t u8CommStructPos,uint8_t u8Datatype);
+            /*! 
+            * \brief                        Looks for the oldest or newest buffered data package of one datatype
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param u8Datatype             Datatype to look for
+            * \param bNewest                True to start at the newest entry
+            * \return                       Position in the internal buffer (0 = oldest) or -1
+            * \note                         Only a datatype the index counts as absent is answered without a scan
+            */
+            int _findDatatype(uint8_t u8CommStructPos,uint8_t u8Datatype,bool bNewest);
+            /*! 
+            * \brief                        Returns the position of the FRTT::FRTTCommunicationPartner structure
+            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param bUseTaskHandleVar      Signals whether to use the partner parameter or the Multi-Sender-Queue parameter
+            * \return                       Position or -1  
+            * \note                         Here either FRTTTaskHandle or an FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
+            *                               If multiSenderQueue is used, bUseTaskHandleVar is set to false
+            */
+            int _getCommStruct(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Returns the start position of a FRTT::FRTTTaskHandle inside ::_u8PartnerIndex
+            * \param partner                Address of the partner task
+            * \return                       Position inside ::_u8PartnerIndex
+            */
+            uint16_t _hashPartner(FRTTTaskHandle partner);
+            /*! 
+            * \brief                        Adds a communication line to ::_u8PartnerIndex
+            * \param partner                Address of the partner task
+            * \param u8CommStructPos        Position of the FRTT::FRTTCommunicationPartner structure in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       void
+            */
+            void _addToPartnerIndex(FRTTTaskHandle partner,uint8_t u8CommStructPos);
+            /*! 
+            * \brief                        Checks if there are messages on the queue
+            * \param queue                  Address of the queue to check
+            * \return                       True if at least one message on the queue                         
+            */
+            bool _checkForMessages(FRTTQueueHandle queue);
+            /*! 
+            * \brief                        Checks if 'queue' has already been added to a communication line
+            * \param queue                  Address of the queue to look for
+            * \param bTxQueue               Signals what type of queue 'queue' is (rx|tx)
+            * \return                       Returns 1 if queue has already been added<br>
+            *                               Returns 0 if queue has not been added yet<br>
+            *                               Returns -1 if 'queue' is nullptr                        
+            */
+            int _queueExists(FRTTQueueHandle queue,bool bTxQueue);
+            /*! 
+            * \brief                        Checks if 'smph' has already been added to a communication line
+            * \param queue                  Address of the semaphore to look for
+            * \param bTxQueue               Signals what type of semaphore 'smph' is (rx|tx)
+            * \return                       Returns 1 if semaphore has already been added<br>
+            *                               Returns 0 if semaphore has not been added yet<br>
+            *                               Returns -1 if 'smph' is nullptr                        
+            */
+            int _semaphoreExists(FRTTSemaphoreHandle smph,bool bTxSemaphore);
+            /*! 
+            * \brief                        Checks if 'ring' has already been added to a communication line
+            * \param ring                   Address of the ring to look for
+            * \param bTxRing                Signals what type of ring 'ring' is (rx|tx)
+            * \return                       Returns 1 if ring has already been added<br>
+            *                               Returns 0 if ring has not been added yet<br>
+            *                               Returns -1 if 'ring' is nullptr                        
+            */
+            int _ringExists(FRTTSpscRingHandle ring,bool bTxRing);
+            /*! 
+            * \brief                        Puts a data package into a ring (producer side)
+            * \param ring                   Address of the ring
+            * \param dataContainer          Data package
+            * \param timeToWait             Block-time (ticks) if the ring is full
+            * \return                       True if the data package was put into the ring
+            */
+            bool _ringPush(FRTTSpscRingHandle ring,const FRTTDataContainerOnQueue & dataContainer,TickType_t timeToWait);
+            /*! 
+            * \brief                        Takes the oldest data package out of a ring (consumer side)
+            * \param ring                   Address of the ring
+            * \param dataContainer          Receives the data package
+            * \param timeToWait             Block-time (ticks) if the ring is empty
+            * \return                       True if a data package was taken out of the ring
+            */
+            bool _ringPop(FRTTSpscRingHandle ring,FRTTDataContainerOnQueue & dataContainer,TickType_t timeToWait);
+            /*! 
+            * \brief                        Returns the amount of messages inside a ring
+            * \param ring                   Address of the ring
+            * \return                       Amount of messages
+            */
+            int _getAmountOfMessages(FRTTSpscRingHandle ring);
+            /*! 
+            * \brief                        Returns the amount of messages on the queue
+            * \param queue                  Address of the queue to check
+            * \return                       Amount of messages or -1                         
+            */
+            int _getAmountOfMessages(FRTTQueueHandle queue);
+            /*! 
+            * \brief                        Checks if user supplied neccessary callback functions
+            * \return                       True if callbacks available                           
+            */
+            bool _hasDataInterpreters();
+            /*! 
+            * \brief                        Checks if the callbacks needed to buffer data of a communication line are available
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       True if data can be moved into (and released from) the internal buffer
+            * \note                         A communication line with ownership transfer does not need the data allocate callback
+            */
+            bool _canBufferData(uint8_t u8CommStructPos);
+            /*! 
+            * \brief                        Releases one entry of the internal buffer (data free callback)
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param u8PositionInBuffer     Position of the entry in the internal buffer (0 = oldest)
+            * \return                       void
+            * \note                         Every path that drops buffered data goes through here
+            */
+            void _releaseSlot(uint8_t u8CommStructPos,uint8_t u8PositionInBuffer);
+            /*! 
+            * \brief                        Drops one reference of a shared payload and frees it (free callback of the sender) with the last one
+            * \param shared                 Address of the shared payload
+            * \return                       void
+            */
+            void _releaseShared(FRTTSharedPayload * shared);
+            /*! 
+            * \brief                        Releases a data package that is dropped without being buffered (e.g. FRTT::FRTTransceiver::queueFlush() or a rx semaphore that could not be taken)
+            * \param dataContainer          Dropped data package
+            * \param bTakeOwnership         Signals that the data belongs to this object (rx side of a line with ownership transfer). It is passed to the data free callback then
+            * \return                       void
+            * \note                         Shared payloads lose the reference of the package, inline payloads need nothing
+            */
+            void _releaseDiscarded(const FRTTDataContainerOnQueue & dataContainer,bool bTakeOwnership);
+            /*! 
+            * \brief                        Clears the address of a shared payload from a mirrored data package in FRTT::FRTTCommunicationPartner::txLineContainer
+            * \param mirror                 Mirrored data package
+            * \return                       void
+            */
+            void _clearSharedMirror(FRTTDataContainerOnQueue & mirror);
+            #if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE)
+            /*! 
+            * \brief                        Copies the counters of one communication line into a snapshot
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param lineStatistics         Receives the counters
+            * \return                       void
+            */
+            void _fillLineStatistics(uint8_t u8CommStructPos,FRTTLineStatistics & lineStatistics);
+            #endif
+            #if defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+            /*! 
+            * \brief                        Adds the time passed since u32EnqueueTime to a latency histogram
+            * \param histogram              Histogram to update
+            * \param u32EnqueueTime         Timestamp the sender put into the data package
+            * \return                       void
+            */
+            void _recordLatency(FRTTLatencyCounters & histogram,uint32_t u32EnqueueTime);
+            /*! 
+            * \brief                        Copies the counters of a latency histogram (each counter on its own, the copy may be taken in the middle of an update)
+            * \param counters               Counters of the communication line
+            * \param histogram              Receives the copy
+            * \return                       void
+            */
+            void _copyLatency(const FRTTLatencyCounters & counters,FRTTLatencyHistogram & histogram);
+            /*! 
+            * \brief                        Sets all counters of a latency histogram to 0
+            * \param counters               Counters of the communication line
+            * \return                       void
+            */
+            void _clearLatency(FRTTLatencyCounters & counters);
+            #endif
+            /*! 
+            * \brief                        Returns the partners name
+            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param bUseTaskHandleVar      Signals whether to use the partner parameter or the Multi-Sender-Queue parameter
+            * \return                       Partners name or empty string  
+            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
+            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false
+            */
+            const char * _getPartnersName(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Stores the name of the communication line that is about to be added
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param name                   Name supplied by the user (nullptr or empty: defaultName)
+            * \param defaultName            FRTTRANSCEIVER_DEFAULTPARTNERNAME or FRTTRANSCEIVER_DEFAULTPARTNERNAMEMULTISENDERQUEUE
+            * \return                       void
+            * \note                         Names longer than FRTTRANSCEIVER_MAXPARTNERNAMELENGTH are cut off
+            */
+            void _setPartnersName(uint8_t u8CommStructPos,const char * name,const char * defaultName);
+            /*! 
+            * \brief                        Checks if a FRTT::FRTTLine still refers to a communication line of this object
+            * \param line                   Handle of the communication line
+            * \return                       True if the handle is valid
+            */
+            bool _isValidLine(FRTTLine line);
+            /*! 
+            * \brief                        Creates the handle of a communication line of this object
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       FRTT::FRTTLine
+            */
+            FRTTLine _lineAt(uint8_t u8CommStructPos);
+            /*! 
+            * \brief                        Converts a wait-time in milliseconds into ticks
+            * \param time_ms                Wait-time in milliseconds (or #FRTTRANSCEIVER_WAITMAX)
+            * \param ticks                  Receives the wait-time in ticks
+            * \return                       False if the wait-time is invalid
+            */
+            bool _toTicks(int time_ms,TickType_t & ticks);
+            /*! 
+            * \brief                        Puts a data package on the tx queue of a communication line and mirrors it into the tx line container
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param dataContainer          Data package to send (receives the enqueue time if #FRTTRANSCEIVER_LATENCY_ENABLE is on)
+            * \param timeToWaitWrite        Block-time (ticks) for the write operation
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire the tx semaphore
+            * \return                       True if the data package was put on the queue (also if the mirror could not be updated afterwards, the queue owns the package then)
+            * \note                         The caller must have checked that the communication line has a tx queue or a tx ring
+            */
+            bool _writeToLine(uint8_t u8CommStructPos,FRTTDataContainerOnQueue & dataContainer,TickType_t timeToWaitWrite,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        Puts several data packages on the tx queue of a communication line with a single semaphore acquisition
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param dataContainers         Data packages to send (the sender address is replaced by the owner address)
+            * \param u8Count                Amount of data packages
+            * \param timeToWaitWrite        Block-time (ticks) for the first data package
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire the tx semaphore
+            * \return                       Amount of data packages put on the queue
+            * \note                         The caller must have checked that the communication line has a tx queue or a tx ring
+            */
+            int _writeBatchToLine(uint8_t u8CommStructPos,const FRTTDataContainerOnQueue * dataContainers,uint8_t u8Count,TickType_t timeToWaitWrite,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        Reads one data package from the rx queue of a communication line into its internal buffer
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param timeToWaitRead         Block-time (ticks) for the read operation
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire the rx semaphore
+            * \return                       True if data read
+            * \note                         The caller must have checked that the communication line has a rx queue (or rx ring) and that the data callbacks are available
+            */
+            bool _readFromLine(uint8_t u8CommStructPos,TickType_t timeToWaitRead,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        Reads up to u8MaxCount data packages from the rx queue of a communication line into its internal buffer
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param u8MaxCount             Maximum amount of data packages to read (> 0)
+            * \param timeToWaitRead         Block-time (ticks) for the first data package
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire the rx semaphore
+            * \return                       Amount of data packages read
+            * \note                         The caller must have checked that the communication line has a rx queue (or rx ring) and that the data callbacks are available
+            */
+            int _readManyFromLine(uint8_t u8CommStructPos,uint8_t u8MaxCount,TickType_t timeToWaitRead,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        Reads one data package from the first rx line that has data waiting (without waiting for data)
+            * \param bSkipQueueSetMembers   Skips the rx queues that are members of the queue set of FRTT::FRTTransceiver::readFromAny() (rings are always checked)
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire the rx semaphore
+            * \return                       Position of the communication line that was read from or -1
+            */
+            int _readFromWaitingLine(bool bSkipQueueSetMembers,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        Checks if a rx line can be serviced right now (rx queue/ring with data waiting and data callbacks available)
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       True if a data package can be read without waiting
+            */
+            bool _hasWaitingData(uint8_t u8CommStructPos);
+            /*! 
+            * \brief                        Checks if FRTT::FRTTransceiver::serviceLines() may read from a rx line (data waiting and space left in the internal buffer)
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       True if a data package can be read without releasing buffered data
+            */
+            bool _canServiceLine(uint8_t u8CommStructPos);
+            /*! 
+            * \brief                        FRTT::FRTTransceiver::serviceLines() with FRTT::eFRTTSchedulingPolicy::e_STRICTPRIORITY
+            * \param u8Budget               Maximum amount of data packages to read
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire a rx semaphore
+            * \return                       Amount of data packages read
+            */
+            int _serviceByPriority(uint8_t u8Budget,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        FRTT::FRTTransceiver::serviceLines() with FRTT::eFRTTSchedulingPolicy::e_WEIGHTEDROUNDROBIN
+            * \param u8Budget               Maximum amount of data packages to read
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire a rx semaphore
+            * \return                       Amount of data packages read
+            */
+            int _serviceByWeight(uint8_t u8Budget,TickType_t timeToWaitSemaphore);
+            #if (configUSE_QUEUE_SETS == 1)
+            /*! 
+            * \brief                        Reads one data package from the communication line an event of the queue set belongs to
+            * \param member                 Queue set member returned by xQueueSelectFromSet() (rx queue or signal of a rx ring)
+            * \param timeToWaitSemaphore    Block-time (ticks) to aquire the rx semaphore
+            * \return                       Position of the communication line that was read from or -1 (stale event)
+            */
+            int _readFromSetMember(QueueSetMemberHandle_t member,TickType_t timeToWaitSemaphore);
+            /*! 
+            * \brief                        Creates (or rebuilds) the queue set holding all rx queues and the signals of all rx rings
+            * \return                       True if the queue set is ready, false if it can not be created right now (e.g. a rx queue holds data)
+            * \note                         A queue can only join a queue set while it is empty
+            */
+            bool _buildRxQueueSet();
+            /*! 
+            * \brief                        Removes all rx queues and ring signals from the queue set and deletes it
+            * \return                       True if the queue set is gone, false if a rx queue still holds data (it stays a member)
+            */
+            bool _dropRxQueueSet();
+            #endif
+            /*! 
+            * \brief                        Moves the data package inside the rx line container into the internal buffer (releases the oldest data if the buffer is full)
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \return                       False if the data allocate callback rejected the data package (nothing buffered, nothing released)
+            * \note                         The rx semaphore must be held by the caller (not needed for an rx ring)
+            */
+            bool _moveIntoBuffer(uint8_t u8CommStructPos);
+            /*! 
+            * \brief                        Stamps the sender (address or id, see FRTTRANSCEIVER_COMPACTDATAPACKAGE) on a data package
+            * \param container              Data package that is about to be written
+            * \return                       void
+            */
+            void _setSender(FRTTDataContainerOnQueue & container) const;
+            /*! 
+            * \brief                        Checks if the partner task of a communication line can be notified
+            * \param pos                    Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners or -1
+            * \return                       True if the partner can be notified
+            */
+            bool _canNotify(int pos);
+            /*! 
+            * \brief                        Notifies the partner task of a communication line (see FRTT::FRTTransceiver::NotifyExtended())
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param action                 Way to update the notification value
+            * \param u32NotificationMask    Notification value/mask
+            * \return                       True if notified
+            */
+            bool _notifyExtended(uint8_t u8CommStructPos,eFRTTNotifyActions action,uint32_t u32NotificationMask);
+            /*! 
+            * \brief                        Notifies a task (counted as a notification sent, see FRTT::FRTTransceiver::getStatistics())
+            * \param task                   Address of the task
+            * \param action                 Way to update the notification value
+            * \param u32NotificationMask    Notification value/mask
+            * \return                       True if notified
+            */
+            bool _notifyExtended(FRTTTaskHandle task,eFRTTNotifyActions action,uint32_t u32NotificationMask);
+            /*! 
+            * \brief                        Sets the doorbell bits of a tx line in the notification value of the partner, if the reader may have found the line empty
+            * \param u8CommStructPos        Position of a FRTT::FRTTCommunicationPartner struct in FRTT::FRTTransceiver::_structCommPartners
+            * \param messagesBefore         Data packages on the tx queue/ring before the write
+            * \return                       void
+            */
+            void _ringDoorbell(uint8_t u8CommStructPos,int messagesBefore);
+        public:
+            /*! 
+            * \brief                        FRTTransceiver Constructor (Deleted)
+            * \note                         Will be removed since there are currently no options to add crucial data with class-methods at a later time after instantiation<br>
+            *                               So the user is therefore promted to use the other constructors instead and supply important data right away.                      
+            */
+            FRTTransceiver() = delete;
+            /*! 
+            * \brief                        FRTTransceiver Constructor (1)
+            * \details                      Allocates memory for FRTT::FRTTCommunicationPartner structure (memory will be automatically released when instance<br> 
+            *                               goes out of scope or implicit FRTT::FRTTransceiver::~FRTTransceiver() called)
+            * \param ownerAddress           Address of the task owning this object (can be nullptr, other tasks wont know who the source of messages is)
+            * \param u8MaxPartners          Max possible connections
+			* \note      				    Owner address will only be used to decorate tx packages with a source address (Task notification will know the address of this object)
+            * \attention                    If u8MaxPartners is 0, then the constructor will internally increment it to 1 (min 1 partner)!             
+            */
+            FRTTransceiver(FRTTTaskHandle ownerAddress,uint8_t u8MaxPartners);
+            /*! 
+            * \brief                        FRTTransceiver Constructor (2)
+            * \details                      Receives a pre-declared array of FRTT::FRTTCommunicationPartner
+            * \param ownerAddress           Address of the task owning this object (can be null, other tasks wont know who the source of messages is)
+            * \param u8MaxPartners          Max possible connections
+            * \param commStructs            Pointer to the pre-declared array of FRTT::FRTTCommunicationPartner.
+			* \note      				    Owner address will only be used to decorate tx packages with a source address (Task notification will know the address of this object)   
+            * \attention                    If commStructs is a nullptr OR u8MaxPartners is 0, then all class methods wont work<br>
+            *                               Supplying the wrong u8MaxPartners to the commStruct will result in undefined library behaviour (so make sure array size and u8MaxPartners match!)                  
+            */
+            FRTTransceiver(FRTTTaskHandle ownerAddress,FRTTCommunicationPartner * commStructs,uint8_t u8MaxPartners):   _ownerAddress(ownerAddress),
+                                                                                                                        #if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+                                                                                                                        _u8SenderId(FRTTSenderId(ownerAddress)),
+                                                                                                                        #endif
+                                                                                                                        _structCommPartners(commStructs),
+                                                                                                                        _u8MaxPartners(u8MaxPartners),
+                                                                                                                        _bDelete(false),
+                                                                                                                        _bHasValidStruct(commStructs && u8MaxPartners ? true:false)
+                                                                                                                        {};
+            /*! 
+            * \brief                        Destructor
+            * \details                      Will free memory previously allocated by the constructor (If needed)
+            */
+            ~FRTTransceiver();
+            /*! 
+            * \brief                        Adds a new communication to the list
+            * \param partner                Address of the partner task
+            * \param queueRX                Rx queue to the partner (reading messages from partner)
+            * \param u8QueueLengthRx        Rx queue length
+            * \param semaphoreRx            Rx semaphore
+            * \param queueTX                Tx queue to the partner (writing to the partner)
+            * \param u8QueueLengthTx        Tx queue length
+            * \param semaphoreTx            Tx semaphore
+            * \param partnersName           Partners name
+			* \attention 					If you choose to provide some random invalid address as the partner task, please make sure not to call for any task-notification 'notify task' methods!<br>
+            *                               There is currently no solution available to check if a FRTT::FRTTTaskhandle is valid so the correct execution of this method is in your hands<br>
+            *                               An invalid FRTT::FRTTTaskhandle will result in a FreeRTOS crash!
+            *                                 
+            * \return                       True if communication was added
+            */
+            bool addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,FRTTQueueHandle queueTX,
+                                                       uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,const char * partnersName = nullptr);
+            /*! 
+            * \brief                        Adds a new communication to the list, using its own storage of depth N instead of the embedded one
+            * \param partner                Address of the partner task
+            * \param queueRX                Rx queue to the partner (reading messages from partner)
+            * \param u8QueueLengthRx        Rx queue length (<= N)
+            * \param semaphoreRx            Rx semaphore
+            * \param queueTX                Tx queue to the partner (writing to the partner)
+            * \param u8QueueLengthTx        Tx queue length (<= N)
+            * \param semaphoreTx            Tx semaphore
+            * \param storage                Storage of the communication line (must outlive this object, one storage per communication line)
+            * \param partnersName           Partners name
+            * \return                       True if communication was added
+            * \note                         Lets one line (e.g. telemetry) use a depth of 64 while FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE stays small for all other lines
+            */
+            template<uint8_t N>
+            bool addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,FRTTQueueHandle queueTX,
+                                                       uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,FRTTLineStorage<N> & storage,const char * partnersName = nullptr)
+            {
+                return this->_addCommPartner(partner,queueRX,u8QueueLengthRx,semaphoreRx,queueTX,u8QueueLengthTx,semaphoreTx,partnersName,
+                                                storage.txLineContainer,storage.tempContainer,storage.sharedPayload,N);
+            }
+        
+            /*! 
+            * \brief                        Adds a new communication to the list, using single-producer/single-consumer rings instead of queues
+            * \param partner                Address of the partner task
+            * \param ringRX                 Rx ring to the partner (reading messages from partner), can be nullptr
+            * \param ringTX                 Tx ring to the partner (writing to the partner), can be nullptr
+            * \param partnersName           Partners name
+            * \return                       True if communication was added
+            * \note                         Rings do not need semaphores. The ring length (FRTT::FRTTCreateSpscRing()) is used as the queue length.<br>
+            *                               A ring has exactly one writer and one reader, so it can not be used for a Multi-Sender-Queue. Flushing is only allowed for the rx ring.<br>
+            *                               Rings longer than FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE are refused, use the overload taking a FRTT::FRTTLineStorage for them
+            */
+            bool addCommPartner(FRTTTaskHandle partner,FRTTSpscRingHandle ringRX,FRTTSpscRingHandle ringTX,const char * partnersName = nullptr);
+            /*! 
+            * \brief                        Adds a new communication using rings, with its own storage of depth N instead of the embedded one
+            * \param partner                Address of the partner task
+            * \param ringRX                 Rx ring to the partner (length <= N), can be nullptr
+            * \param ringTX                 Tx ring to the partner (length <= N), can be nullptr
+            * \param storage                Storage of the communication line (must outlive this object, one storage per communication line)
+            * \param partnersName           Partners name
+            * \return                       True if communication was added
+            */
+            template<uint8_t N>
+            bool addCommPartner(FRTTTaskHandle partner,FRTTSpscRingHandle ringRX,FRTTSpscRingHandle ringTX,FRTTLineStorage<N> & storage,const char * partnersName = nullptr)
+            {
+                return this->_addCommPartner(partner,ringRX,ringTX,partnersName,storage.txLineContainer,storage.tempContainer,storage.sharedPayload,N);
+            }
+
+            /*! 
+            * \brief                        Adds a new Multi-Sender-Queue connection (multiple tasks write on the tx line)
+            * \param queueRX                Rx queue to the x tasks writing on it
+            * \param u8QueueLengthRx        Rx queue length
+            * \param semaphoreRx            Rx semaphore
+            * \param multiSenderQueueName   Multi-sender-queue name
+            * \return                       True if communication was added
+            * \note                         You can not add a tx queue to this communication, since there is no Multi-Reader-Queue feature.<br>
+            *                               This communication line will therefore be read-only
+            *                               
+            */
+            bool addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
+                        const char * multiSenderQueueName = nullptr);
+            /*! 
+            * \brief                        Adds a new Multi-Sender-Queue to the list, using its own storage of depth N instead of the embedded one
+            * \param queueRX                Rx queue
+            * \param u8QueueLengthRx        Rx queue length (<= N)
+            * \param semaphoreRx            Rx semaphore
+            * \param storage                Storage of the communication line (must outlive this object, one storage per communication line)
+            * \param multiSenderQueueName   Multi-sender-queue name
+            * \return                       True if communication was added
+            */
+            template<uint8_t N>
+            bool addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
+                        FRTTLineStorage<N> & storage,const char * multiSenderQueueName = nullptr)
+            {
+                return this->_addMultiSenderPartner(queueRX,u8QueueLengthRx,semaphoreRx,multiSenderQueueName,
+                                                storage.txLineContainer,storage.tempContainer,storage.sharedPayload,N);
+            }
+
+            /*! 
+            * \brief                        Returns a pre-resolved handle for the communication line of a partner
+            * \param partner                Address of the partner task
+            * \return                       FRTT::FRTTLine (u8Slot == #FRTTRANSCEIVER_INVALIDLINE if the partner is unknown)
+            * \note                         Call it once after FRTT::FRTTransceiver::addCommPartner() and keep the handle for the hot path.
+            */
+            FRTTLine getLine(FRTTTaskHandle partner);
+            /*! 
+            * \brief                        Returns a pre-resolved handle for a Multi-Sender-Queue
+            * \param multiSenderQueue       Selects the Multi-Sender-Queue
+            * \return                       FRTT::FRTTLine (u8Slot == #FRTTRANSCEIVER_INVALIDLINE if the Multi-Sender-Queue is unknown)
+            * \note                         Call it once after FRTT::FRTTransceiver::addMultiSenderPartner() and keep the handle for the hot path.
+            */
+            FRTTLine getLine(eMultiSenderQueue multiSenderQueue);
+            /*! 
+            * \brief                        Returns the name of a communication line
+            * \param line                   Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \return                       Name (valid as long as this object lives) or an empty string if the line is invalid
+            */
+            const char * getPartnersName(FRTTLine line);
+
+            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+            /*! 
+            * \brief                            Writes to a selected tx queue
+            * \param destination                Destination queue (partner address)
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u32AdditionalInfo          32 Bit additional payload along with void pointer 'data'       
+            * \return                           True if it was successfully written to the tx queue
+            * \note                             Here you can pass a 32 bit variable along with the data pointer. <br>
+            *                                   You can have the same functionality but with an additional 64 bit payload instead, by uncommenting FRTTRANSCEIVER_64BITADDITIONALDATA
+            *                                   in FRTTransceiverSettings.h
+            */
+            bool writeToQueue(FRTTTaskHandle destination,uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
+            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+            /*! 
+            * \brief                            Writes to a selected tx queue
+            * \param destination                Destination queue (partner address)
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u64AdditionalInfo          64 Bit additional payload along with void pointer 'data'       
+            * \return                           True if it was successfully written to the tx queue
+            * \note                             Here you can pass a 64 bit variable along with the data pointer. <br>
+            *                                   You can have the same functionality but with an additional 32 bit payload instead, by uncommenting FRTTRANSCEIVER_32BITADDITIONALDATA
+            *                                   in FRTTransceiverSettings.h
+            */
+            bool writeToQueue(FRTTTaskHandle destination,uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
+            #endif
+
+            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+            /*! 
+            * \brief                            Writes to the tx queue of a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u32AdditionalInfo          32 Bit additional payload along with void pointer 'data'       
+            * \return                           True if it was successfully written to the tx queue
+            * \note                             Same as FRTT::FRTTransceiver::writeToQueue(), but without the partner lookup and the checks already made during registration.
+            *                                   Like every write, it returns false as long as the data allocate and free callbacks are not both supplied.
+            */
+            bool writeToQueue(FRTTLine line,uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
+            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+            /*! 
+            * \brief                            Writes to the tx queue of a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u64AdditionalInfo          64 Bit additional payload along with void pointer 'data'       
+            * \return                           True if it was successfully written to the tx queue
+            * \note                             Same as FRTT::FRTTransceiver::writeToQueue(), but without the partner lookup and the checks already made during registration.
+            *                                   Like every write, it returns false as long as the data allocate and free callbacks are not both supplied.
+            */
+            bool writeToQueue(FRTTLine line,uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
+            #endif
+
+            #if (FRTTRANSCEIVER_INLINEPAYLOADSIZE > 0)
+            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+            /*! 
+            * \brief                            Writes a small payload that is copied into the data package itself
+            * \param destination                Destination queue (partner address)
+            * \param u8Datatype                 Datatype of the payload. (Create your own system wide datatypes)
+            * \param payload                    Bytes to copy (may be a stack variable, it is not referenced after the call)
+            * \param u8Size                     Amount of bytes (1 ... FRTTRANSCEIVER_INLINEPAYLOADSIZE)
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u32AdditionalInfo          32 Bit additional payload
+            * \return                           True if it was successfully written to the tx queue
+            * \note                             The receiver buffers the bytes as they are: the data allocate/free callbacks are not called for this data package.
+            *                                   Read it with FRTT::FRTTGetPayload() (FRTT::FRTTDataContainerOnQueue::data is not valid)
+            */
+            bool writeInlineToQueue(FRTTTaskHandle destination,uint8_t u8Datatype,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
+            /*! 
+            * \brief                            FRTT::FRTTransceiver::writeInlineToQueue() for a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype                 Datatype of the payload. (Create your own system wide datatypes)
+            * \param payload                    Bytes to copy (may be a stack variable, it is not referenced after the call)
+            * \param u8Size                     Amount of bytes (1 ... FRTTRANSCEIVER_INLINEPAYLOADSIZE)
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u32AdditionalInfo          32 Bit additional payload
+            * \return                           True if it was successfully written to the tx queue
+            */
+            bool writeInlineToQueue(FRTTLine line,uint8_t u8Datatype,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
+            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+            /*! 
+            * \brief                            Writes a small payload that is copied into the data package itself
+            * \param destination                Destination queue (partner address)
+            * \param u8Datatype                 Datatype of the payload. (Create your own system wide datatypes)
+            * \param payload                    Bytes to copy (may be a stack variable, it is not referenced after the call)
+            * \param u8Size                     Amount of bytes (1 ... FRTTRANSCEIVER_INLINEPAYLOADSIZE)
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u64AdditionalData          64 Bit additional payload
+            * \return                           True if it was successfully written to the tx queue
+            * \note                             The receiver buffers the bytes as they are: the data allocate/free callbacks are not called for this data package.
+            *                                   Read it with FRTT::FRTTGetPayload() (FRTT::FRTTDataContainerOnQueue::data is not valid)
+            */
+            bool writeInlineToQueue(FRTTTaskHandle destination,uint8_t u8Datatype,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
+            /*! 
+            * \brief                            FRTT::FRTTransceiver::writeInlineToQueue() for a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype                 Datatype of the payload. (Create your own system wide datatypes)
+            * \param payload                    Bytes to copy (may be a stack variable, it is not referenced after the call)
+            * \param u8Size                     Amount of bytes (1 ... FRTTRANSCEIVER_INLINEPAYLOADSIZE)
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param u64AdditionalData          64 Bit additional payload
+            * \return                           True if it was successfully written to the tx queue
+            */
+            bool writeInlineToQueue(FRTTLine line,uint8_t u8Datatype,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
+            #endif
+            #endif
+
+            /*! 
+            * \brief                            Writes several data packages to a selected tx queue with a single semaphore acquisition
+            * \param destination                Address of the destination task
+            * \param dataContainers             Array of data packages (data, u8DataType and additional data are used, the sender address is set by the library)
+            * \param u8Count                    Amount of data packages inside 'dataContainers'
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write the FIRST data package (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           Amount of data packages put on the queue (in order, starting with dataContainers[0]) or -1 if the write is not allowed
+            * \note                             Only the first data package may wait for space on the queue. All others are only written if they fit right away.
+            */
+            int writeBatchToQueue(FRTTTaskHandle destination,const FRTTDataContainerOnQueue * dataContainers,uint8_t u8Count,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            FRTT::FRTTransceiver::writeBatchToQueue() for a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param dataContainers             Array of data packages (data, u8DataType and additional data are used, the sender address is set by the library)
+            * \param u8Count                    Amount of data packages inside 'dataContainers'
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write the FIRST data package (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           Amount of data packages put on the queue or -1 if the write is not allowed
+            */
+            int writeBatchToQueue(FRTTLine line,const FRTTDataContainerOnQueue * dataContainers,uint8_t u8Count,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms);
+
+            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+            /*! 
+            * \brief                            Broadcasts data to all communication lines with a tx connection
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to ONE of the queues (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire ONE of the semaphores for the operation (milliseconds)
+            * \param u32AdditionalInfo          32 Bit additional payload along with void pointer 'data'
+            * \return                           True if it was successfully written to ALL tx connections. <br>
+            *                                   False if at least one write operation failed
+            * \note                             Supplied block-time's will be used for each write operation!
+            * \note                             Databroadcast will proceed even if a write operation failed <br>
+            *                                   Here you can pass a 32 bit variable along with the data pointer. <br>
+            *                                   You can have the same functionality but with an additional 64 bit payload instead, by uncommenting FRTTRANSCEIVER_64BITADDITIONALDATA
+            *                                   in FRTTransceiverSettings.h
+            * \attention                        Do not use this feature when you have a lot of tx connections
+            *                                   and it's particularly hard to get instant permission to write on at least one of them<br>
+            *                                   However, if you still need to, at least keep  blockTimeWrite_Ms and blockTimeTakeSemaphore_Ms very low                   
+            */
+            bool databroadcast(uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
+            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+            /*! 
+            * \brief                            Broadcasts data to all communication lines with a tx connection
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to ONE of the queues (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire ONE of the semaphores for the operation (milliseconds)
+            * \param u64AdditionalInfo          64 Bit additional payload along with void pointer 'data'
+            * \return                           True if it was successfully written to ALL tx connections. <br>
+            *                                   False if at least one write operation failed
+            * \note                             Supplied block-time's will be used for each write operation!
+            * \note                             Databroadcast will proceed even if a write operation failed <br>
+            *                                   Here you can pass a 64 bit variable along with the data pointer. <br>
+            *                                   You can have the same functionality but with an additional 32 bit payload instead, by uncommenting FRTTRANSCEIVER_32BITADDITIONALDATA
+            *                                   in FRTTransceiverSettings.h
+            * \attention                        Do not use this feature when you have a lot of tx connections
+            *                                   and it's particularly hard to get instant permission to write on at least one of them<br>
+            *                                   However, if you still need to, at least keep  blockTimeWrite_Ms and blockTimeTakeSemaphore_Ms very low                   
+            */
+            bool databroadcast(uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
+            #endif
+
+            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+            /*! 
+            * \brief                            Broadcasts one shared payload to all communication lines with a tx connection
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to ONE of the queues (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire ONE of the semaphores for the operation (milliseconds)
+            * \param u32AdditionalInfo          32 Bit additional payload along with void pointer 'data'
+            * \return                           True if all queues received the data package
+            * \note                             The data is wrapped in a reference counted FRTT::FRTTSharedPayload. Receivers do not call their data allocate callback,
+            *                                   their buffer entry points to 'data' itself and is shared with the other receivers, so it should be treated as read-only (FRTT::FRTTGetPayload()).
+            *                                   The data free callback of THIS object runs once, after the last receiver released its entry or a queue holding it was flushed.<br>
+            *                                   Do not touch 'data' after the call. The mirror of the package in FRTT::FRTTCommunicationPartner::txLineContainer has its 'data' cleared.
+            */
+            bool databroadcastShared(uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalInfo);
+            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+            /*! 
+            * \brief                            Broadcasts one shared payload to all communication lines with a tx connection
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to the original data
+            * \param blockTimeWrite_Ms          How long the task calling this method should be put into a blocked state (max) until it is allowed to write to ONE of the queues (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire ONE of the semaphores for the operation (milliseconds)
+            * \param u64AdditionalData          64 Bit additional payload along with void pointer 'data'
+            * \return                           True if all queues received the data package
+            * \note                             The data is wrapped in a reference counted FRTT::FRTTSharedPayload. Receivers do not call their data allocate callback,
+            *                                   their buffer entry points to 'data' itself and is shared with the other receivers, so it should be treated as read-only (FRTT::FRTTGetPayload()).
+            *                                   The data free callback of THIS object runs once, after the last receiver released its entry or a queue holding it was flushed.<br>
+            *                                   Do not touch 'data' after the call. The mirror of the package in FRTT::FRTTCommunicationPartner::txLineContainer has its 'data' cleared.
+            */
+            bool databroadcastShared(uint8_t u8Datatype,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData);
+            #endif
+
+            #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+            /*! 
+            * \brief                            Broadcasts data to all communication lines with a tx connection without head-of-line blocking
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to data
+            * \param deadline_Ms                Overall time (milliseconds) the broadcast may take, no matter how many partners are congested. FRTTRANSCEIVER_WAITMAX waits until every line took the data
+            * \param u32AdditionalInfo           32 Bit additional payload along with void pointer 'data'
+            * \return                           Bitmask of the lines that received the data package. Bit n belongs to the line in slot n (FRTT::FRTTLine::u8Slot, see FRTT::FRTTransceiver::getLine()).
+            *                                   0 on invalid parameters
+            * \note                             Every line is tried once without blocking first. Afterwards only the lines that were full (or busy) are retried until the deadline expires.<br>
+            *                                   A line is served as soon as its queue accepted the data package (even if the tx mirror could not be updated), so no line gets it twice.<br>
+            *                                   Lines in slot 64 and above are served as well, but cannot be reported by the bitmask.
+            */
+            uint64_t databroadcastFanOut(uint8_t u8Datatype,void * data,int deadline_Ms,uint32_t u32AdditionalInfo);
+            #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+            /*! 
+            * \brief                            Broadcasts data to all communication lines with a tx connection without head-of-line blocking
+            * \param u8Datatype                 Datatype of void pointer 'data'. (Create your own system wide datatypes)
+            * \param data                       Pointer to data
+            * \param deadline_Ms                Overall time (milliseconds) the broadcast may take, no matter how many partners are congested. FRTTRANSCEIVER_WAITMAX waits until every line took the data
+            * \param u64AdditionalData           64 Bit additional payload along with void pointer 'data'
+            * \return                           Bitmask of the lines that received the data package. Bit n belongs to the line in slot n (FRTT::FRTTLine::u8Slot, see FRTT::FRTTransceiver::getLine()).
+            *                                   0 on invalid parameters
+            * \note                             Every line is tried once without blocking first. Afterwards only the lines that were full (or busy) are retried until the deadline expires.<br>
+            *                                   A line is served as soon as its queue accepted the data package (even if the tx mirror could not be updated), so no line gets it twice.<br>
+            *                                   Lines in slot 64 and above are served as well, but cannot be reported by the bitmask.
+            */
+            uint64_t databroadcastFanOut(uint8_t u8Datatype,void * data,int deadline_Ms,uint64_t u64AdditionalData);
+            #endif
+            /*! 
+            * \brief                            Reads from a selected queue (either normal queue or multi-sender-queue)
+            * \param partner                    To select the queue to read from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue           To select the Multi-Sender-Queue to read from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar          Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param blockTimeRead_Ms           How long the task calling this method should be put into a blocked state (max) until it is allowed to read from the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           True if data read into the internal buffer
+            * \note                             Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                                   If 'partner' is used, bUseTaskHandleVar is set to true.<br>
+            *                                   If multiSenderQueue is used, bUseTaskHandleVar is set to false                         
+            */
+            bool readFromQueue(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            Reads from the rx queue of a pre-resolved communication line (either normal queue or multi-sender-queue)
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param blockTimeRead_Ms           How long the task calling this method should be put into a blocked state (max) until it is allowed to read from the queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           True if data read into the internal buffer
+            */
+            bool readFromQueue(FRTTLine line,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            Reads all data packages waiting on a selected rx queue (either normal queue or multi-sender-queue) with a single semaphore acquisition
+            * \param partner                    Selects the partner (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue           Selects the Multi-Sender-Queue (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar          Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param u8MaxCount                 Maximum amount of data packages to read (capped at the length of the rx queue)
+            * \param blockTimeRead_Ms           How long the task calling this method should be put into a blocked state (max) until the FIRST data package arrives (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           Amount of data packages read into the internal buffer or -1 if the read is not allowed
+            * \note                             Only the first data package is waited for. Each data package goes through the data allocate callback, just like with FRTT::FRTTransceiver::readFromQueue().<br>
+            *                                   If the internal buffer is full, the oldest buffered data is released.
+            */
+            int readManyFromQueue(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8MaxCount,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            FRTT::FRTTransceiver::readManyFromQueue() for a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8MaxCount                 Maximum amount of data packages to read (capped at the length of the rx queue)
+            * \param blockTimeRead_Ms           How long the task calling this method should be put into a blocked state (max) until the FIRST data package arrives (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           Amount of data packages read into the internal buffer or -1 if the read is not allowed
+            */
+            int readManyFromQueue(FRTTLine line,uint8_t u8MaxCount,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            Selects the policy FRTT::FRTTransceiver::serviceLines() uses
+            * \param policy                     FRTT::eFRTTSchedulingPolicy::e_STRICTPRIORITY or FRTT::eFRTTSchedulingPolicy::e_WEIGHTEDROUNDROBIN (default)
+            * \return                           void
+            */
+            void setSchedulingPolicy(eFRTTSchedulingPolicy policy);
+            /*! 
+            * \brief                            Sets priority and weight of a rx line for FRTT::FRTTransceiver::serviceLines()
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Priority                 Priority (e_STRICTPRIORITY). Higher is served first, default 0
+            * \param u8Weight                   Weight (e_WEIGHTEDROUNDROBIN). Data packages the line may read per turn (> 0), default 1
+            * \return                           True if set
+            */
+            bool setLineScheduling(FRTTLine line,uint8_t u8Priority,uint8_t u8Weight);
+            /*! 
+            * \brief                            Reads up to u8Budget data packages from the rx lines (queues and rings) in the order of the scheduling policy
+            * \param u8Budget                   Maximum amount of data packages to read
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire a semaphore for the operation (milliseconds)
+            * \return                           Amount of data packages read or -1 if the parameters are invalid
+            * \note                             Never waits for data. Combine it with FRTT::FRTTransceiver::readFromAny() or a notification to sleep while all lines are empty.<br>
+            *                                   The position in the round-robin is kept between calls, so a small budget does not always favour the first lines.<br>
+            *                                   A line whose internal buffer is full is skipped (nothing buffered is released). Delete buffered data to have it serviced again
+            */
+            int serviceLines(uint8_t u8Budget,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            Returns how many data packages FRTT::FRTTransceiver::serviceLines() read from a rx line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \return                           Service count (0 for an invalid handle)
+            */
+            uint32_t getServiceCount(FRTTLine line);
+            /*! 
+            * \brief                            Sets the service counts of all lines to 0
+            * \return                           void
+            */
+            void resetServiceCounts();
+            #if (configUSE_QUEUE_SETS == 1)
+            /*! 
+            * \brief                            Blocks on all rx lines at once and reads one data package from the first line that has data
+            * \param blockTimeRead_Ms           How long the task calling this method should be put into a blocked state (max) until data arrives on any rx queue (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \return                           Handle of the communication line the data package was read from (compare it with FRTT::FRTTransceiver::getLine())<br>
+            *                                   FRTT::FRTTLine::u8Slot is FRTTRANSCEIVER_INVALIDLINE if nothing was read
+            * \note                             Uses a FreeRTOS queue set (configUSE_QUEUE_SETS) that is created with the first call and holds every rx queue of this object.
+            *                                   Rx rings take part with a binary semaphore that every write gives (FRTT::FRTTSpscRing::queueSetSignal).
+            *                                   Communication lines added later (or changed callbacks/ownership) are taken over as soon as all rx queues are empty.<br>
+            *                                   While the queue set can not be built, all lines are checked once per tick until the block-time is over.
+            * \attention                        Once this method is used, read the rx queues of this object only with FRTT::FRTTransceiver::readFromAny().
+            *                                   Every data package read (or flushed) otherwise leaves an event in the queue set, which can overflow it.
+            */
+            FRTTLine readFromAny(int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms);
+            #endif
+            /*! 
+            * \brief                            Flushes rx/tx queue                      
+            * \param partner                    To select the queue to flush (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue           To select the Multi-Sender-Queue to flush (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar          Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire the semaphore for the operation (milliseconds)
+            * \param bTxQueue                   Signals whether to use the tx line of the connection or the rx line
+            * \return                           True if queue flushed 
+            * \note                             Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enum is supplied. <br>
+            *                                   If 'partner' is used, bUseTaskHandleVar is set to true.<br>
+            *                                   If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false<br>
+            *                                   A tx ring (FRTT::FRTTSpscRing) can only be flushed by its reader, so flushing it returns false<br>
+            *                                   Shared payloads (FRTT::FRTTransceiver::databroadcastShared()) lying on the queue are released,
+            *                                   data packages on the rx line of an ownership transfer (FRTT::FRTTransceiver::setOwnershipTransfer()) are passed to the data free callback
+            */
+            bool queueFlush(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,int blockTimeTakeSemaphore_Ms,bool bTxQueue);
+
+            /*! 
+            * \brief                        Deletes an entry in the internal rx buffer                      
+            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param u8PositionInBuffer     Position in rx buffer to clear
+            * \return                       True if data "deleted"
+            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If 'partner' is used, bUseTaskHandleVar is set to true.<br>
+            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                               
+            */
+            bool delDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8PositionInBuffer);
+            /*! 
+            * \brief                        Flushes the rx buffer for a specific communication line                    
+            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \return                       True if buffer flushed 
+            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If 'partner' is used, bUseTaskHandleVar is set to true.<br>
+            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                 
+            */
+            bool delAllDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+
+            /*! 
+            * \brief                        Deletes oldest entry in the internal rx buffer (of a normal communication line)
+            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \return                       True if oldest data deleted
+            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                   
+            */                                          
+            bool delOldestDatabuffForLine(FRTTTaskHandle partner);
+            /*! 
+            * \brief                        Deletes oldest entry in the internal rx buffer of a Multi-Sender-Queue
+            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \return                       True if oldest data deleted
+            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                         
+            */ 
+            bool delOldestDatabuffForLine(eMultiSenderQueue multiSenderQueue);
+            /*! 
+            * \brief                        Deletes latest entry in the rx buffer for a specific communication line                  
+            * \param partner                To select the specific internal rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \return                       True if newest data deleted
+            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
+            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                              
+            */
+            bool delNewestDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Returns the amount of messages on a selected queue
+            * \param partner                To select the queue to check the amount of messages from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bCheckTxQueue          Signals whether to check tx or rx queue
+            * \return                       Amount of messages on the selected queue or -1                         
+            */
+            int messagesOnQueue(FRTTTaskHandle partner, bool bCheckTxQueue);
+            /*! 
+            * \brief                        Returns the amount of messages on a selected Multi-Sender-Queue (multiple tasks write on the tx line)
+            * \param multiSenderQueue       To select the specific internal multi-sender-queue to check the amount of messages from (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \return                       Amount of messages on the selected queue or -1                           
+            */
+            int messagesOnQueue(eMultiSenderQueue multiSenderQueue);
+
+            /*! 
+            * \brief                        Checks if buffered rx data available                  
+            * \param partner                To select the specific internal rx buffer to check for data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer to check for data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \return                       True if buffered data available
+            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If 'partner' is used, bUseTaskHandleVar is set to true.<br>
+            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                
+            */
+            bool hasDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Returns the amount of buffered data for a specific communication line                  
+            * \param partner                To select the specific internal rx buffer to check for the amount of buffered data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer to check for the amount of buffered data (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \return                       Amount of buffered data or -1
+            * \note                         Here either FRTT::FRTTTaskHandle or a FRTT::eMultiSenderQueue enumerator is supplied. <br>
+            *                               If partner is used, bUseTaskHandleVar is set to true.<br>
+            *                               If 'multiSenderQueue' is used, bUseTaskHandleVar is set to false                                                
+            */
+            int bufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Returns the amount of buffered data for a all communication lines combined                
+            * \return                       Amount of buffered data or -1 if FRTT::FRTTransceiver::_bHasValidStruct is true                                             
+            */
+            int bufferedDataInAllBuffers();
+        
+            /*! 
+            * \brief                        Checks if datatype found in rx buffer for a specific communication line
+            * \param partner                To select the specific internal rx buffer to check for the datatype (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer to check for the datatype (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param u8Datatype             Datatype to look for (Create your own system wide datatypes)
+            * \return                       Amount of datatype occurences or -1                        
+            */
+            int isDatatypeInBuffer(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8Datatype);
+            /*! 
+            * \brief                        FRTT::FRTTransceiver::isDatatypeInBuffer() for a pre-resolved communication line
+            * \param line                   Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype             Datatype to look for
+            * \return                       Amount of datatype occurences or -1
+            * \note                         O(1) for datatypes < FRTTRANSCEIVER_INDEXEDDATATYPES
+            */
+            int isDatatypeInBuffer(FRTTLine line,uint8_t u8Datatype);
+
+            /*! 
+            * \brief                        Returns the newest buffered data for a specific communication line
+            * \param partner                To select the specific internal rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter 
+            * \return                       Const pointer to the buffer position or NULL
+            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                          
+            */
+            const FRTTTempDataContainer * getNewestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Returns the oldest buffered data for a specific communication line
+            * \param partner                To select the specific internal rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal Multi-Sender-Queue rx buffer from which the data should be taken (Used to select the right entry in FRTT::FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or multiSenderQueue parameter 
+            * \return                       Const pointer to the buffer position or NULL
+            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                          
+            */
+            const FRTTTempDataContainer * getOldestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        Returns a selected part of the buffered data for a specific communication line
+            * \param partner                To select the specific internal rx buffer from which the data should be taken (Used to select the right entry in FRTTCommunicationPartner)
+            * \param multiSenderQueue       To select the specific internal multi-sender-queue rx buffer from which the data should be taken (Used to select the right entry in FRTTCommunicationPartner)
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter 
+            * \param u8PositionInBuffer     Position from which the data should be taken
+            * \return                       Const pointer to the buffer position or NULL
+            * \note                         Rx buffer : {  [[pos 0]oldest data][pos 1][pos 2].....[pos n-1][[pos n]newest data]  }                          
+            */
+            const FRTTTempDataContainer * getBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8PositionInBuffer);
+            /*! 
+            * \brief                        Returns the oldest buffered data package of a datatype
+            * \param line                   Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype             Datatype to look for
+            * \param pu8PositionInBuffer    Receives the position of the entry (e.g. for FRTT::FRTTransceiver::delDatabuffForLine()) or nullptr
+            * \return                       Const pointer to the buffer entry or NULL
+            * \note                         Returns right away (O(1)) if the datatype index knows that the datatype is not buffered.<br>
+            *                               Otherwise the buffer is scanned from the oldest entry up to the first match (O(n) in the amount of buffered data packages)
+            */
+            const FRTTTempDataContainer * getOldestBufferedDataOfType(FRTTLine line,uint8_t u8Datatype,uint8_t * pu8PositionInBuffer = nullptr);
+            /*! 
+            * \brief                        Returns the newest buffered data package of a datatype
+            * \param line                   Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param u8Datatype             Datatype to look for
+            * \param pu8PositionInBuffer    Receives the position of the entry (e.g. for FRTT::FRTTransceiver::delDatabuffForLine()) or nullptr
+            * \return                       Const pointer to the buffer entry or NULL
+            * \note                         Returns right away (O(1)) if the datatype index knows that the datatype is not buffered.<br>
+            *                               Otherwise the buffer is scanned from the newest entry up to the first match (O(n) in the amount of buffered data packages)
+            */
+            const FRTTTempDataContainer * getNewestBufferedDataOfType(FRTTLine line,uint8_t u8Datatype,uint8_t * pu8PositionInBuffer = nullptr);
+            /*! 
+            * \brief                            Sets the datatype handler table of all lines that do not have an own table
+            * \param table                      Handler table or nullptr
+            * \return                           void
+            * \attention                        The table is not copied and must outlive this object (or be removed before)
+            */
+            void setDatatypeTable(const FRTTDatatypeTable * table);
+            /*! 
+            * \brief                            Sets the datatype handler table of one line (overrides the table of the object)
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param table                      Handler table or nullptr (use the table of the object)
+            * \return                           True if set
+            */
+            bool setDatatypeTable(FRTTLine line,const FRTTDatatypeTable * table);
+            /*! 
+            * \brief                            Runs the handler of its datatype for every buffered data package of a line (oldest first) and releases each entry afterwards
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \return                           Amount of data packages dispatched or -1 (invalid line, no table)
+            * \attention                        A handler must not read from or delete the buffer of the same line. The data package is released after the handler returns
+            */
+            int dispatch(FRTTLine line);
+			/*! 
+            * \brief                            Sets the partner tasks notification state to pending (if not already pending!!) and increments its notification value (adds 1 to the value).
+            * \param partner                    Partner task to notify
+            * \return						    Will always return true unless you provided wrong parameters 
+            *                                   Will return false if any of the situations mentioned in 'note' below happened 
+            * \note                             Even if the receving task has a notification pending, this method will always increment the partner tasks notification value!                    
+            * \note                             Internally the library only checks: - Partner has been added to the list of communications<br>
+            *                                                                       - Partner is not a Multi-Sender-Queue || partner is not nullptr<br>
+            *                                   There is currently no solution available to check if a FRTTTaskhandle is valid so the correct execution of this method is in your hands<br>
+            *                                   An invalid FRTT::FRTTTaskhandle will result in a FreeRTOS crash!
+            */
+            bool NotifyBasic(FRTTTaskHandle partner);
+            /*! 
+            * \brief                            FRTT::FRTTransceiver::NotifyBasic() for a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \return                           True if notified
+            */
+            bool NotifyBasic(FRTTLine line);
+            /*! 
+            * \brief                            Extended version of FRTT:FRTTransceiver::NotifyBasic()
+            * \details                          In this version of the notify funcionality you can do: 
+            *                                       - Increment partner tasks notification value by 1 (equivalent to FRTT::FRTTransceiver::NotifyBasic())
+            *                                       - Set single bits in the partner tasks notification value (---> lightweight eventgroup)
+            *                                       - Update partner tasks notification value (only if partner task has no notification pending, similar to a queue with length 1)
+            *                                       - Update parnter tasks notification value (even if partner task has notification pending, similar to queueOverwrite())
+            * \param partner                    Partner task to notify         
+            * \param action                     Ways to update the notification value : [e_NoAction, e_SetBits, e_Increment,e_SetValueWithOverwrite,e_SetValueWithoutOverwrite]<br>
+            *                                   Check their description in FRTTransceiverNotify.h
+            * \param u32NotificationMask        Notification value/mask. Its usage depends on the 'action' provided.           
+            * \return						    Almost always true, except when action == FRTT::eFRTTNotifyActions::eSetValueWithoutOverwrite and the partner task had a notification pending
+            * \note                                                 
+            */
+            bool NotifyExtended(FRTTTaskHandle partner,eFRTTNotifyActions action,uint32_t u32NotificationMask);
+            /*! 
+            * \brief                            FRTT::FRTTransceiver::NotifyExtended() for a pre-resolved communication line
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param action                     Ways to update the notification value : [e_NoAction, e_SetBits, e_Increment,e_SetValueWithOverwrite,e_SetValueWithoutOverwrite]
+            * \param u32NotificationMask        Notification value/mask. Its usage depends on the 'action' provided.           
+            * \return						    Almost always true, except when action == FRTT::eFRTTNotifyActions::eSetValueWithoutOverwrite and the partner task had a notification pending
+            */
+            bool NotifyExtended(FRTTLine line,eFRTTNotifyActions action,uint32_t u32NotificationMask);
+			/*! 
+            * \brief                        	Checks if the owner of this object has a notification pending
+            * \param 	action                	Set to FRTT:eNotifyAction::eCLEARCOUNTONEXIT to tell FreeRTOS to clear the notification value to 0
+            *                                   Set to FRTT:eNotifyAction::eCLEARCOUNTONEXITNOT to tell FreeRTOS to simply decrement the notification value at the end
+            * \return							*This object. Immediately call FRTT::FRTTransceiver::getNotificationVal() or FRTT::FRTTransceiver:hasNotification() for infos.<br>      
+            * \attention                        The final notification value put into the internal buffer can be 0.<br>
+            *                                   That would mean that no task notified us and FRTT::FRTTransceiver:hasNotification() will therefore return false<br>
+            *                                   The internal FreeRTOS method used in this basic version only checks for a notification value > 0
+            *                                                        
+            */
+            FRTTransceiver & NotifyReceiveBasic(eFRTTNotifyActions action,int blockTimeReceive_Ms);
+            /*! 
+            * \brief                        	Extended version of FRTT::FRTTransceiver::NofityReceiveBasic()
+            * \details                          In this version of the notify-receive functionality you can do:
+            *                                       - Clear bits (RIGHT ONENTRY) for the notification value of the owner task of this object (will only be cleared if no notification pending)
+            *                                       - Clear bits (AFTER xTaskNotifyWait()) for the notification value of the owner task of this object <br>
+            *                                         (will only be cleared if notification received / notification was already pending)
+            * \param    u32ClearOnEntryMask     Same bits as in this mask will be cleared (ONENTRY, before 'receive') in the notification value of the owner of this task (will only be cleared if no notification pending)<br>
+            *                                   Example: u32ClearOnEntryMask == 0x03, notificationBefore == 0x0011 ---> notificationValUpdated == 0x0000
+            * \param    u32ClearOnExitMask      Same bits as in this mask will be cleared (ONEXIT, after 'receive') in the notification value of the owner of this task (only if notification was received)
+            *                                   Example: u32ClearOnEntryMask == 0x03, notificationBefore == 0x0011 ---> notificationValUpdated == 0x0000                                    
+            * \return							*This object. Immediately call FRTT::FRTTransceiver::getNotificationVal() or FRTT::FRTTranceiver::hasNotification() to get infos      
+            * \note                             This method will also signal that a notification was received when the notification value == 0!                     
+            */
+            FRTTransceiver & NotifyReceiveExtended(uint32_t u32ClearOnEntryMask,uint32_t u32ClearOnExitMask,int blockTimeReceive_Ms);
+            /*! 
+            * \brief                            Turns the doorbell mode of one side of a communication line on or off
+            * \details                          Sender side (FRTT::eFRTTDoorbell::e_TXLINE): a write that finds at most one data package on the tx line sets the bits of u32DoorbellMask
+            *                                   in the notification value of the partner (FRTT::eFRTTNotifyActions::e_SetBits). Writes to a line that holds more data do not notify,
+            *                                   so a busy producer wakes the consumer about once per batch instead of once per data package.
+            *                                   Use FRTT::eFRTTDoorbell::e_SHAREDTXLINE if other tasks write to the same tx queue/ring, every write rings then.<br>
+            *                                   Receiver side (FRTT::eFRTTDoorbell::e_RXLINE): the mask tells FRTT::FRTTransceiver::drainDoorbellLines() which rx line belongs to which bits.
+            *                                   Both sides of a line are set on their own, a receiver does not ring its partner with its own tx writes
+            * \param line                       Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param side                       Side of the line to configure
+            * \param u32DoorbellMask            Bit(s) of the line (usually one bit per line, both ends use the same mask). 0 turns the doorbell off
+            * \return                           True if set. False for an invalid line or if the line has no such side
+            * \note                             Do not mix it with FRTT::FRTTransceiver::NotifyBasic() or counting notifications towards the same task
+            */
+            bool setDoorbell(FRTTLine line,eFRTTDoorbell side,uint32_t u32DoorbellMask);
+            /*! 
+            * \brief                            Reads the rx lines whose doorbell bits are set (call it after FRTT::FRTTransceiver::NotifyReceiveExtended())
+            * \param u32Doorbells               In: doorbell bits received (FRTT::FRTTransceiver::getNotificationVal()). <br>
+            *                                   Out: bits of the lines that still hold data after this call
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire a semaphore for the operation (milliseconds)
+            * \return                           Amount of data packages read or -1 if the parameters are invalid
+            * \attention                        Reads at most one buffer (rx queue length) per line. If u32Doorbells is not 0 afterwards, process the buffered data
+            *                                   and call this method again before waiting for the next notification. The sender will not ring again for a line that stays filled
+            */
+            int drainDoorbellLines(uint32_t & u32Doorbells,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            Supplies the bit table of FRTT::FRTTransceiver::dispatchNotifications()
+            * \param table                      Array of FRTTRANSCEIVER_NOTIFICATIONBITS entries (index == bit of the notification value) or nullptr to turn dispatching off
+            * \return                           void
+            * \attention                        The table is not copied and must outlive this object. Change it with FRTT::FRTTransceiver::bindNotificationBit() only
+            */
+            void setNotificationHandlerTable(FRTTNotificationHandler * table);
+            /*! 
+            * \brief                            Binds a bit of the notification value to a rx line and/or a handler
+            * \param u8Bit                      Bit of the notification value (0 ... 31)
+            * \param line                       Rx line to read when the bit is set or FRTT::FRTTLine() for a pure event bit.
+            *                                   The bit becomes the rx doorbell mask of the line (FRTT::eFRTTDoorbell::e_RXLINE), writes of this object on the line do not ring it.
+            *                                   The sender turns its side on with FRTT::FRTTransceiver::setDoorbell() (FRTT::eFRTTDoorbell::e_TXLINE)
+            * \param handler                    Called when the bit is set or nullptr
+            * \param context                    Handed to the handler
+            * \return                           True if bound. False without table, for an invalid bit/line or if neither line nor handler is given
+            */
+            bool bindNotificationBit(uint8_t u8Bit,FRTTLine line,fP_notificationHandler handler,void * context);
+            /*! 
+            * \brief                            Removes the binding of a notification bit
+            * \param u8Bit                      Bit of the notification value (0 ... 31)
+            * \return                           True if the bit was bound
+            */
+            bool unbindNotificationBit(uint8_t u8Bit);
+            /*! 
+            * \brief                            Waits once for a notification and dispatches every bound bit that is set
+            * \details                          The set bits are visited with count-trailing-zeros, so the cost depends on the amount of set bits only.
+            *                                   For every bit the bound rx line is read (FRTT::FRTTransceiver::readManyFromQueue(), one buffer at most) and then the handler is called.
+            *                                   A line that still holds data sets its bit again in the own notification value, so the next call returns right away
+            * \param blockTimeReceive_Ms        How long the task calling this method should be put into a blocked state (max) until a notification arrives (milliseconds)
+            * \param blockTimeTakeSemaphore_Ms  How long the task calling this method should be put into a blocked state (max) until is is allowed to aquire a semaphore for the operation (milliseconds)
+            * \return                           Amount of bits dispatched or -1 if no table was supplied/the parameters are invalid
+            * \note                             Only the bound bits are cleared. The raw value is available with FRTT::FRTTransceiver::getNotificationVal(), bits nobody is bound to stay in the notification value
+            */
+            int dispatchNotifications(int blockTimeReceive_Ms,int blockTimeTakeSemaphore_Ms);
+            /*! 
+            * \brief                            Returns the last notification value received	           
+            * \return					        32 Bit notification value                             
+            * \note                             A call to FRTT::FRTTransceiver::NotifyReceiveBasic() or FRTT::FRTTransceiver::NotifiyReceiveExtended() will update this value
+            * \note                             Return value -> Greater than zero: notification received. Zero:  Nothing received. 
+            */
+            uint32_t getNotificationVal();
+            /*! 
+            * \brief                            Sets the internal notification variable to zero	           
+            * \return					        void                            
+            */
+            void clearNotificationVal();
+            /*! 
+            * \brief                            Returns whether we had receveid a notification with the last call to any of the 'NotifyReceivexXx' methods.      
+            * \return                           True or false                            
+            */
+            bool hasNotification();
+            /*! 
+            * \brief                        To to add an allocator callback function
+            * \details                      This method is used to add an allocator callback function to the library.
+            *                               When the library reads data off the queue, it will do so by copying its content into a FRTT::FRTTDataContainerOnQueue structure.<br>
+            *                               After that, the library aquires the next free space in the internal rx buffer (FRTT::FRTTTempDataContainer) and places a call to the allocator callback<br>
+            *                               Now the callback function will be called, in which the user of the library can just copy everything (pointer to the original data of communication partner) 
+            *                               over OR allocate memory (e.g malloc) and then copy data into own variables.<br>
+            *                               If the callback cannot take the data package (e.g. out of memory) it sets FRTTRANSCEIVER_FLAG_REJECTED in FRTT::FRTTTempDataContainer::u8Flags.
+            *                               The data package is dropped then: it is not buffered, the read reports no data and the free callback is not called for it.
+            * \param fP                     Pointer to a function which takes FRTT::FRTTDataContainerOnQueue and FRTT::FRTTTempDataContainer as an argument.
+            * \return                       void
+            * \attention                    Later versions of the library will support some sort of memory pool to allocate/free data through the callbacks
+            */ 
+            void addDataAllocateCallback(void(*fP)(const FRTTDataContainerOnQueue &, FRTTTempDataContainer &));
+            /*! 
+            * \brief                        To to add a de-allocator callback function
+            * \details                      This method is used to add a de-allocator callback function to the library.
+            *                               The user of the library should basically reverse the steps made in FRTT::FRTTransceiver::addDataAllocateCallback() <br>
+            * \param fP                     Pointer to a function which takes FRTT::FRTTDataContainerOnQueue and FRTT::FRTTTempDataContainer as an argument.
+            * \return                       void
+            * \attention                    Later versions of the library will support some sort of memory pool to allocate/free data through the callbacks
+            */
+            void addDataFreeCallback(void (*fP)(FRTTTempDataContainer &));
+            /*! 
+            * \brief                        Turns ownership transfer ON/OFF for the rx line of a communication (zero-copy receive)
+            * \details                      With ownership transfer the receiver adopts the 'data' pointer of a package as it is. The data allocate callback is not called
+            *                               and the data free callback runs once the buffer entry is released (buffer full, FRTT::FRTTransceiver::delDatabuffForLine() etc.)
+            *                               or the package is dropped before it was buffered (rx FRTT::FRTTransceiver::queueFlush(), rx semaphore not available)
+            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param bTakeOwnership         True to adopt the senders data, false to copy it with the data allocate callback (default)
+            * \return                       True if the mode was set, false if the communication line is unknown or still has buffered data
+            * \attention                    The sender must hand over data it will not touch or free anymore (e.g. allocated per package). The receivers free callback releases it.
+            */
+            bool setOwnershipTransfer(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,bool bTakeOwnership);
+            /*! 
+            * \brief                        Turns fire-and-forget writes ON/OFF for the tx line of a communication
+            * \details                      A fire-and-forget write puts the data package straight on the tx queue. It is not mirrored into FRTT::FRTTCommunicationPartner::txLineContainer
+            *                               and the tx semaphore is not taken (blockTimeTakeSemaphore_Ms is ignored). A tx ring never needs either of them, the mode changes nothing there
+            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param bFireAndForget         True to skip the mirror and the tx semaphore, false for the regular write path (default)
+            * \return                       True if the mode was set, false if the communication line is unknown
+            * \note                         Every other task writing to the same queue keeps its own mode. Use it for producers that never look at the data packages they sent
+            */
+            bool setFireAndForget(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,bool bFireAndForget);
+
+            #if defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+            /*! 
+            * \brief                        Takes a snapshot of the latency histograms of a communication line (TURN ON by uncommenting #FRTTRANSCEIVER_LATENCY_ENABLE in FRTTransceiverSettings.h)
+            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \param snapshot               Receives the histograms
+            * \return                       True if the communication line is known
+            * \note                         Latencies are recorded on the rx side in the unit of FRTTRANSCEIVER_TIMESTAMP(). Sender and receiver need the same setting.<br>
+            *                               Any task may take the snapshot. The counters are read one by one, a sample recorded meanwhile may show up in some of them only
+            */
+            bool getLatencyHistograms(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,FRTTLineLatency & snapshot);
+            /*! 
+            * \brief                        FRTT::FRTTransceiver::getLatencyHistograms() for a pre-resolved communication line
+            * \param line                   Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \param snapshot               Receives the histograms
+            * \return                       True if the handle is valid
+            */
+            bool getLatencyHistograms(FRTTLine line,FRTTLineLatency & snapshot);
+            /*! 
+            * \brief                        Clears the latency histograms of a communication line
+            * \param partner                Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param multiSenderQueue       Used to select the right entry in FRTT::FRTTCommunicationPartner
+            * \param bUseTaskHandleVar      Signals whether to use 'partner' parameter or 'multiSenderQueue' parameter
+            * \return                       True if the communication line is known
+            * \note                         Meant for the owner task. Called by another task, a sample the owner records at the same time may survive the reset
+            */
+            bool resetLatencyHistograms(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar);
+            /*! 
+            * \brief                        FRTT::FRTTransceiver::resetLatencyHistograms() for a pre-resolved communication line
+            * \param line                   Handle of the communication line (FRTT::FRTTransceiver::getLine())
+            * \return                       True if the handle is valid
+            */
+            bool resetLatencyHistograms(FRTTLine line);
+            #endif
+            
+
+            #if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE)
+            /*! 
+            * \brief                        Takes a snapshot of the counters of this object and of its communication lines (TURN ON by uncommenting #FRTTRANSCEIVER_ANALYTICS_ENABLE in FRTTransceiverSettings.h)
+            * \param statistics             Receives the counters of this object
+            * \param lineStatistics         Array receiving the counters of the communication lines (in the order they were added) or nullptr
+            * \param u8MaxLines             Size of the array
+            * \return                       Amount of entries written to lineStatistics
+            * \note                         May be called by any task (e.g. a supervisor sampling all transceivers). The counters are only written by the owner task
+            *                               and read without pausing it. Every counter is consistent on its own, the snapshot as a whole is not taken atomically
+            */
+            uint8_t getStatistics(FRTTTransceiverStatistics & statistics,FRTTLineStatistics * lineStatistics = nullptr,uint8_t u8MaxLines = 0);
+            /*! 
+            * \brief                        Prints a good summary of all communication lines (TURN ON by uncommenting #FRTTRANSCEIVER_ANALYTICS_ENABLE in FRTTransceiverSettings.h)
+            * \return                       void                           
+            * \note                         Printed from the same data FRTT::FRTTransceiver::getStatistics() returns
+            */
+            void printCommunicationsSummary();
+            #endif
+    };
+}
 #endif
\ No newline at end of file
@@ -1,88 +1,449 @@
-#ifndef FRTTRANSCEIVEREXTENSION_H
-#define FRTTRANSCEIVEREXTENSION_H
-/*!
- * \file        FRTTransceiverExtension.h
- * \brief       Extends the library to important structures, defines and variable types
- * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
- * \version     v1.2.0
- * \copyright   Copyright 2022 Xhemail Ramabaja
- *
- */
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
-#include "freertos/semphr.h"
-#include "freertos/task.h"
-#include "FRTTransceiverSettings.h"
-#include <string>
-
-using namespace std;
-
-/*! \brief Defines the maximum time a task can wait for something to become available */
-#define FRTTRANSCEIVER_WAITMAX (-1)
-
-namespace FRTT {
-    /*! \brief  Often used as the return value of a FreeRTOS functions */
-    using FRTTBaseType = UBaseType_t;
-    /*! \brief  Holds the address to a queue*/
-    using FRTTQueueHandle = QueueHandle_t;
-    /*! \brief  Holds the address to a task */
-    using FRTTTaskHandle = TaskHandle_t;
-    /*! \brief  Holds the address to a semaphore */
-    using FRTTSemaphoreHandle = SemaphoreHandle_t;
-    /*! \brief Describes a function which returns void and takes a void pointer */
-    using FRTTTaskFunction = TaskFunction_t;
-
-    /*! \brief Structure holding a data package that will be put on a queue */
-    struct FRTTDataContainerOnQueue
-    {
-        FRTTTaskHandle senderAddress = (FRTTTaskHandle)0x0;                             /*!< Address of the task which is the source of the data package        */
-        void * data = nullptr;                                                          /*!< Pointer to the original data that is being send over the queue     */
-        uint8_t u8DataType = 0;                                                         /*!< Datatype of the data that the void pointer points to               */
-        #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-        uint32_t u32AdditionalData = 0;                                                 /*!< 32 Bit additional data. Can be used for different data (TURN ON/OFF in FRTTransceiverSettings.h)   */
-        #elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-        uint64_t u64AdditionalData = 0;                                                 /*!< 64 Bit additional data. Can be used for different data (TURN ON/OFF in FRTTransceiverSettings.h)   */
-        #endif
-    };
-
-    /*! \brief Will be used as rx buffer*/
-    using FRTTTempDataContainer = FRTTDataContainerOnQueue;
-
-    /*! \brief Structure holding all important data regarding a communication line*/
-    struct FRTTCommunicationPartner
-    {
-        FRTTTaskHandle commPartner = nullptr;                                                   /*!< Holds the address of the partner task or NULL in the case of a Multi-Sender-Queue              */
-        string partnersName;                                                                    /*!< Holds the self set name of the partner task or FRTTRANSCEIVER_DEFAULTPARTNERNAMExxxxxxxx       */
-
-        bool bReadOnlyCommunication = false;                                                    /*!< Is set to true if the communication line is meant for a readonly multi-sender-queue. RX        */
-
-        FRTTSemaphoreHandle semaphoreRxQueue = nullptr;                                         /*!< Semaphore to get access to the rx queue (partner sets it as the semaphore for the tx queue)    */
-        FRTTSemaphoreHandle semaphoreTxQueue = nullptr;                                         /*!< Semaphore to get access to the tx queue (partner sets it as the semaphore for the rx queue)    */
-
-        uint8_t u8TxQueueLength = 0;                                                            /*!< Length of the tx queue (> 0)*/
-        uint8_t u8RxQueueLength = 0;                                                            /*!< Length of the rx queue (> 0)*/
-
-        struct FRTTDataContainerOnQueue txLineContainer[FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE];  /*!< Array holding data packages that are currently lying / have previously lain on the queue       */
-        struct FRTTDataContainerOnQueue rxLineContainer;                                        /*!< Intermediate container between queue and internal buffers                                      */
-
-        FRTTQueueHandle rxQueue = nullptr;                                                      /*!< Holds the address of the rx queue  */
-        FRTTQueueHandle txQueue = nullptr;                                                      /*!< Holds the address of the tx queue  */
-
-        FRTTTempDataContainer tempContainer[FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE];              /*!< Internal buffers. Data read from the queue end up in this buffer */
-
-        #ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE                                                             
-        int dataPackagesReceived = 0;                                                           /*!< Hold the amount of data packages received. (TURN ON/OFF in FRTTransceiverSettings.h)   */
-        int dataPackagesSent = 0;                                                               /*!< Hold the amount of data packages sent. (TURN ON/OFF in FRTTransceiverSettings.h)       */
-        #endif
-
-        bool bHasBufferedData = false;                                                          /*!< Signals whether we have buffered data for that specific communication line     */
-        bool bRxBufferFull = false;                                                             /*!< Signals whether the internal buffer is full. Only for internal use.            */
-        int8_t i8CurrTempcontainerPos = -1;                                                     /*!< Stores the current position in the internal buffer in which to write next      */
-    };
-
-    /*! \brief Pointer to the data allocator callback a user needs to supply in order to use this library       */
-    using fP_dataAllocateCallback =  void (*)(const FRTTDataContainerOnQueue &,FRTTTempDataContainer &);
-    /*! \brief Pointer to the data de-allocator callback a user needs to supply in order to use this library    */
-    using fP_dataFreeCallback = void (*)(FRTTTempDataContainer &);
-}
+#ifndef FRTTRANSCEIVEREXTENSION_H
+#define FRTTRANSCEIVEREXTENSION_H
+/*!
+ * \file        FRTTransceiverExtension.h
+ * \brief       Extends the library to important structures, defines and variable types
+ * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
+ * \version     v1.2.0
+ * \copyright   Copyright 2022 Xhemail Ramabaja
+ *
+ */
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "FRTTransceiverSettings.h"
+#include <string>
+#include <atomic>
+
+using namespace std;
+
+/*! \brief Defines the maximum time a task can wait for something to become available */
+#define FRTTRANSCEIVER_WAITMAX (-1)
+/*! \brief Slot of a FRTT::FRTTLine that does not belong to any communication line */
+#define FRTTRANSCEIVER_INVALIDLINE (0xFFu)
+/*! \brief Flag of a data package: 'data' points to a FRTT::FRTTSharedPayload (see FRTT::FRTTransceiver::databroadcastShared()) */
+#define FRTTRANSCEIVER_FLAG_SHAREDPAYLOAD (0x01u)
+/*! \brief Flag of a data package: the payload is stored in FRTT::FRTTDataContainerOnQueue::au8InlinePayload (see FRTT::FRTTransceiver::writeInlineToQueue()) */
+#define FRTTRANSCEIVER_FLAG_INLINEPAYLOAD (0x02u)
+/*! \brief Flag a data allocate callback sets to reject a data package. It is dropped instead of buffered (see FRTT::FRTTransceiver::addDataAllocateCallback()) */
+#define FRTTRANSCEIVER_FLAG_REJECTED (0x04u)
+/*! \brief Amount of bits of a task notification value (entries of a FRTT::FRTTNotificationHandler table) */
+#define FRTTRANSCEIVER_NOTIFICATIONBITS (32u)
+/*! \brief Amount of datatypes a uint8_t can select (entries of a FRTT::FRTTDatatypeTable) */
+#define FRTTRANSCEIVER_DATATYPES (256u)
+
+namespace FRTT {
+    class FRTTransceiver;
+
+    /*! \brief  Often used as the return value of a FreeRTOS functions */
+    using FRTTBaseType = UBaseType_t;
+    /*! \brief  Holds the address to a queue*/
+    using FRTTQueueHandle = QueueHandle_t;
+    /*! \brief  Holds the address to a task */
+    using FRTTTaskHandle = TaskHandle_t;
+    /*! \brief  Holds the address to a semaphore */
+    using FRTTSemaphoreHandle = SemaphoreHandle_t;
+    /*! \brief Describes a function which returns void and takes a void pointer */
+    using FRTTTaskFunction = TaskFunction_t;
+
+    /*! \brief Structure holding a data package that will be put on a queue */
+    struct FRTTDataContainerOnQueue
+    {
+        /* Members are ordered by their alignment, the structure does not contain padding between them (see static_assert below) */
+        #if defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+        uint64_t u64AdditionalData = 0;                                                 /*!< 64 Bit additional data. Can be used for different data (TURN ON/OFF in FRTTransceiverSettings.h)   */
+        #endif
+        #if !defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+        FRTTTaskHandle senderAddress = (FRTTTaskHandle)0x0;                             /*!< Address of the task which is the source of the data package        */
+        #endif
+        #if (FRTTRANSCEIVER_INLINEPAYLOADSIZE > 0)
+        union
+        {
+            void * data = nullptr;                                                      /*!< Pointer to the original data that is being send over the queue     */
+            uint8_t au8InlinePayload[FRTTRANSCEIVER_INLINEPAYLOADSIZE];                 /*!< Payload copied into the data package (only valid with FRTTRANSCEIVER_FLAG_INLINEPAYLOAD)  */
+        };
+        #else
+        void * data = nullptr;                                                          /*!< Pointer to the original data that is being send over the queue     */
+        #endif
+        #if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+        uint32_t u32AdditionalData = 0;                                                 /*!< 32 Bit additional data. Can be used for different data (TURN ON/OFF in FRTTransceiverSettings.h)   */
+        #endif
+        #if defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+        uint32_t u32EnqueueTime = 0;                                                    /*!< FRTTRANSCEIVER_TIMESTAMP() taken by the library when the data package was written (TURN ON/OFF in FRTTransceiverSettings.h)  */
+        #endif
+        #if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+        uint8_t u8SenderId = 0;                                                         /*!< Id of the task which is the source of the data package (see FRTT::FRTTGetSender(), 0 = unknown)   */
+        #endif
+        uint8_t u8DataType = 0;                                                         /*!< Datatype of the data that the void pointer points to               */
+        uint8_t u8Flags = 0;                                                            /*!< Set by the library (FRTTRANSCEIVER_FLAG_xxx), FRTTRANSCEIVER_FLAG_REJECTED by the data allocate callback    */
+        #if (FRTTRANSCEIVER_INLINEPAYLOADSIZE > 0)
+        uint8_t u8InlineSize = 0;                                                       /*!< Amount of bytes in FRTT::FRTTDataContainerOnQueue::au8InlinePayload */
+        #endif
+    };
+
+    /*! \brief Rounds u32Size up to a multiple of u32Alignment */
+    constexpr uint32_t FRTTAlignUp(uint32_t u32Size,uint32_t u32Alignment)
+    {
+        return ((u32Size + u32Alignment - 1) / u32Alignment) * u32Alignment;
+    }
+
+    /*! \brief Size of FRTT::FRTTDataContainerOnQueue if no padding is inserted between its members */
+    constexpr uint32_t FRTTPackedDataContainerSize = FRTTAlignUp(
+        #if defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+        sizeof(uint64_t) +
+        #elif defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+        sizeof(uint32_t) +
+        #endif
+        #if !defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+        sizeof(FRTTTaskHandle) +
+        #else
+        sizeof(uint8_t) +
+        #endif
+        #if (FRTTRANSCEIVER_INLINEPAYLOADSIZE > 0)
+        FRTTAlignUp(FRTTRANSCEIVER_INLINEPAYLOADSIZE > sizeof(void *) ? FRTTRANSCEIVER_INLINEPAYLOADSIZE:sizeof(void *),alignof(void *)) + sizeof(uint8_t) +
+        #else
+        sizeof(void *) +
+        #endif
+        #if defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+        sizeof(uint32_t) +
+        #endif
+        2 * sizeof(uint8_t),alignof(FRTTDataContainerOnQueue));
+
+    static_assert(sizeof(FRTTDataContainerOnQueue) == FRTTPackedDataContainerSize,"FRTTDataContainerOnQueue contains padding, check the order of its members");
+    static_assert(FRTTRANSCEIVER_INLINEPAYLOADSIZE <= 255,"FRTTRANSCEIVER_INLINEPAYLOADSIZE must fit into FRTTDataContainerOnQueue::u8InlineSize (max 255)");
+
+    /*! \brief Will be used as rx buffer*/
+    using FRTTTempDataContainer = FRTTDataContainerOnQueue;
+
+    /*!
+    * \brief                   Returns the payload of a data package, no matter if it was sent inline or as a pointer
+    * \param container         Data package (e.g. a buffer entry)
+    * \return                  Address of the inline bytes or FRTT::FRTTDataContainerOnQueue::data
+    */
+    inline const void * FRTTGetPayload(const FRTTDataContainerOnQueue & container)
+    {
+        #if (FRTTRANSCEIVER_INLINEPAYLOADSIZE > 0)
+        if(container.u8Flags & FRTTRANSCEIVER_FLAG_INLINEPAYLOAD)
+        {
+            return container.au8InlinePayload;
+        }
+        #endif
+        return container.data;
+    }
+
+    #if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+    /*!
+    * \brief                   Returns the sender id of a task. The task is registered on the first call
+    * \param task              Address of the task
+    * \return                  Sender id (1 ... FRTTRANSCEIVER_SENDERIDS) or 0 (task is nullptr or the registry is full)
+    * \note                    Called by the constructors of FRTT::FRTTransceiver. Ids are never given back
+    */
+    uint8_t FRTTSenderId(FRTTTaskHandle task);
+    /*!
+    * \brief                   Returns the task registered for a sender id
+    * \param u8SenderId        Sender id (FRTT::FRTTSenderId())
+    * \return                  Address of the task or nullptr (unknown id)
+    */
+    FRTTTaskHandle FRTTSenderAddress(uint8_t u8SenderId);
+    #endif
+
+    /*!
+    * \brief                   Returns the address of the task which sent a data package, no matter if FRTTRANSCEIVER_COMPACTDATAPACKAGE is on or off
+    * \param container         Data package (e.g. a buffer entry)
+    * \return                  Address of the sender or nullptr (unknown sender)
+    */
+    inline FRTTTaskHandle FRTTGetSender(const FRTTDataContainerOnQueue & container)
+    {
+        #if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+        return FRTTSenderAddress(container.u8SenderId);
+        #else
+        return container.senderAddress;
+        #endif
+    }
+
+    struct FRTTSharedPayload;
+
+    /*!
+    * \brief   Storage of a communication line with a depth chosen at compile time
+    * \details Hand it to FRTT::FRTTransceiver::addCommPartner() or FRTT::FRTTransceiver::addMultiSenderPartner() to use queues longer (or shorter)
+    *          than FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE for one communication line. Must outlive the FRTT::FRTTransceiver
+    */
+    template<uint8_t N>
+    struct FRTTLineStorage
+    {
+        static_assert(N > 0 && N <= FRTTRANSCEIVER_MAXLINEDEPTH,"Depth of a communication line must be between 1 and FRTTRANSCEIVER_MAXLINEDEPTH");
+
+        struct FRTTDataContainerOnQueue txLineContainer[N];                                     /*!< See FRTT::FRTTCommunicationPartner::txLineContainer    */
+        FRTTTempDataContainer tempContainer[N];                                                 /*!< See FRTT::FRTTCommunicationPartner::tempContainer      */
+        FRTTSharedPayload * sharedPayload[N] = {};                                              /*!< See FRTT::FRTTCommunicationPartner::sharedPayload      */
+    };
+
+    #if (configSUPPORT_STATIC_ALLOCATION == 1)
+    /*!
+    * \brief   Memory of a queue with a length chosen at compile time (FRTT::FRTTCreateQueueStatic())
+    * \details Declare it as a global/static object, the memory is then fixed at link time. Must outlive the queue
+    */
+    template<uint8_t N>
+    struct FRTTStaticQueue
+    {
+        static_assert(N > 0 && N <= FRTTRANSCEIVER_MAXLINEDEPTH,"Length of a queue must be between 1 and FRTTRANSCEIVER_MAXLINEDEPTH");
+
+        StaticQueue_t queueBuffer;                                                              /*!< Queue control block                                    */
+        uint8_t au8Storage[N * sizeof(FRTTDataContainerOnQueue)];                               /*!< Memory of the data packages on the queue               */
+    };
+
+    /*! \brief Memory of a semaphore (FRTT::FRTTCreateSemaphoreStatic()). Must outlive the semaphore */
+    using FRTTStaticSemaphore = StaticSemaphore_t;
+
+    /*!
+    * \brief   Memory of a task with a stack size chosen at compile time (FRTT::FRTTCreateTaskStatic())
+    * \details Declare it as a global/static object, the memory is then fixed at link time. Must outlive the task
+    */
+    template<uint32_t StackBytes>
+    struct FRTTStaticTask
+    {
+        static_assert(StackBytes >= sizeof(StackType_t),"Stack of a task must not be empty");
+
+        StaticTask_t taskBuffer;                                                                /*!< Task control block                                     */
+        StackType_t stack[StackBytes / sizeof(StackType_t)];                                    /*!< Stack of the task                                      */
+    };
+    #endif
+
+    /*!
+    * \brief   Lock-free single-producer/single-consumer ring. Alternative transport to a FreeRTOS queue for a 1:1 communication line
+    * \details Created with FRTT::FRTTCreateSpscRing(). Exactly one task writes to and exactly one task reads from the ring.
+    *          No mutex is needed and the kernel is only called if one side has to block (ring empty/full) while the other side is parked.
+    */
+    struct FRTTSpscRing
+    {
+        struct FRTTDataContainerOnQueue * slots = nullptr;                                      /*!< Ring storage (allocated by FRTT::FRTTCreateSpscRing()). One slot always stays empty to tell a full ring from an empty one  */
+        uint16_t u16Size = 0;                                                                   /*!< Amount of slots (length of the ring + 1)                                               */
+        std::atomic<uint32_t> u32Head {0};                                                      /*!< Next slot to write. Only written by the producer                                       */
+        std::atomic<uint32_t> u32Tail {0};                                                      /*!< Next slot to read. Only written by the consumer                                        */
+        std::atomic<bool> bConsumerParked {false};                                              /*!< Set while the consumer waits for data                                                  */
+        std::atomic<bool> bProducerParked {false};                                              /*!< Set while the producer waits for space                                                 */
+        FRTTSemaphoreHandle dataAvailable = nullptr;                                            /*!< Binary semaphore the consumer blocks on (only given if FRTT::FRTTSpscRing::bConsumerParked is set)  */
+        FRTTSemaphoreHandle spaceAvailable = nullptr;                                           /*!< Binary semaphore the producer blocks on (only given if FRTT::FRTTSpscRing::bProducerParked is set)  */
+        #if (configUSE_QUEUE_SETS == 1)
+        std::atomic<bool> bInQueueSet {false};                                                  /*!< Set while FRTT::FRTTSpscRing::queueSetSignal is a member of a queue set (FRTT::FRTTransceiver::readFromAny())  */
+        FRTTSemaphoreHandle queueSetSignal = nullptr;                                           /*!< Binary semaphore given on every write while FRTT::FRTTSpscRing::bInQueueSet is set    */
+        #endif
+    };
+
+    /*! \brief  Holds the address to a single-producer/single-consumer ring */
+    using FRTTSpscRingHandle = FRTTSpscRing *;
+
+    #if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE)
+    /*! \brief Snapshot of the counters of one communication line (FRTT::FRTTransceiver::getStatistics()) */
+    struct FRTTLineStatistics
+    {
+        FRTTTaskHandle commPartner = nullptr;                                                   /*!< Address of the partner task or NULL (Multi-Sender-Queue)               */
+        uint32_t u32PackagesSent = 0;                                                           /*!< Amount of data packages sent                                           */
+        uint32_t u32PackagesReceived = 0;                                                       /*!< Amount of data packages received                                       */
+        uint32_t u32PackagesDropped = 0;                                                        /*!< Amount of data packages rejected by the data allocate callback         */
+        uint8_t u8TxQueueLength = 0;                                                            /*!< Length of the tx queue/ring (0 = no tx line)                           */
+        uint8_t u8RxQueueLength = 0;                                                            /*!< Length of the rx queue/ring (0 = no rx line)                           */
+        uint8_t u8BufferedData = 0;                                                             /*!< Amount of entries in the internal buffer when the snapshot was taken   */
+        bool bReadOnlyCommunication = false;                                                    /*!< True for a Multi-Sender-Queue                                          */
+        bool bRing = false;                                                                     /*!< True if the line uses rings instead of queues                          */
+    };
+
+    /*! \brief Snapshot of the counters of one FRTT::FRTTransceiver (FRTT::FRTTransceiver::getStatistics()) */
+    struct FRTTTransceiverStatistics
+    {
+        FRTTTaskHandle ownerAddress = nullptr;                                                  /*!< Address of the owner task                                              */
+        uint8_t u8CommPartners = 0;                                                             /*!< Amount of communication lines                                          */
+        uint8_t u8MaxPartners = 0;                                                              /*!< Max amount of communication lines                                      */
+        uint8_t u8MultiSenderQueues = 0;                                                        /*!< Amount of Multi-Sender-Queues                                          */
+        uint32_t u32Broadcasts = 0;                                                             /*!< Amount of broadcasts made                                              */
+        uint32_t u32NotificationsSent = 0;                                                      /*!< Amount of tasks notified                                               */
+        uint32_t u32NotificationsReceived = 0;                                                  /*!< Amount of notifications received                                       */
+        TickType_t runtimeTicks = 0;                                                            /*!< Ticks since the object was created                                     */
+    };
+    #endif
+
+    #if defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+    /*!
+    * \brief   Logarithmic latency histogram (unit of FRTTRANSCEIVER_TIMESTAMP())
+    * \details Bucket 0 counts the latencies 0 and 1, bucket n the latencies [2^n, 2^(n+1)). The last bucket counts everything above
+    */
+    struct FRTTLatencyHistogram
+    {
+        uint32_t au32Buckets[FRTTRANSCEIVER_LATENCYBUCKETS] = {};                               /*!< Amount of samples per bucket                   */
+        uint32_t u32Samples = 0;                                                                /*!< Amount of samples of all buckets               */
+        uint32_t u32Max = 0;                                                                    /*!< Highest latency recorded                       */
+    };
+
+    /*! \brief Latency histograms of one communication line (rx side) */
+    struct FRTTLineLatency
+    {
+        FRTTLatencyHistogram queueWait;                                                         /*!< Time from the write of the sender until the data package was read into the internal buffer    */
+        FRTTLatencyHistogram untilRelease;                                                      /*!< Time from the write of the sender until the buffer entry was released (deleted/overwritten)   */
+    };
+
+    /*! \brief Counters behind a FRTT::FRTTLatencyHistogram. Written by the owner task only, other tasks take snapshots. Only for internal use. */
+    struct FRTTLatencyCounters
+    {
+        std::atomic<uint32_t> au32Buckets[FRTTRANSCEIVER_LATENCYBUCKETS];                      /*!< See FRTT::FRTTLatencyHistogram::au32Buckets    */
+        std::atomic<uint32_t> u32Samples {0};                                                   /*!< See FRTT::FRTTLatencyHistogram::u32Samples     */
+        std::atomic<uint32_t> u32Max {0};                                                       /*!< See FRTT::FRTTLatencyHistogram::u32Max         */
+
+        FRTTLatencyCounters() { for(std::atomic<uint32_t> & bucket : au32Buckets) bucket.store(0,std::memory_order_relaxed); }
+    };
+
+    /*! \brief Counters behind a FRTT::FRTTLineLatency. Only for internal use. */
+    struct FRTTLineLatencyCounters
+    {
+        FRTTLatencyCounters queueWait;                                                          /*!< See FRTT::FRTTLineLatency::queueWait           */
+        FRTTLatencyCounters untilRelease;                                                       /*!< See FRTT::FRTTLineLatency::untilRelease        */
+    };
+    #endif
+
+    /*! \brief Structure holding all important data regarding a communication line*/
+    struct FRTTCommunicationPartner
+    {
+        FRTTTaskHandle commPartner = nullptr;                                                   /*!< Holds the address of the partner task or NULL in the case of a Multi-Sender-Queue              */
+        char partnersName[FRTTRANSCEIVER_MAXPARTNERNAMELENGTH + 1] = {};                         /*!< Holds the self set name of the partner task or FRTTRANSCEIVER_DEFAULTPARTNERNAMExxxxxxxx       */
+
+        bool bReadOnlyCommunication = false;                                                    /*!< Is set to true if the communication line is meant for a readonly multi-sender-queue. RX        */
+
+        FRTTSemaphoreHandle semaphoreRxQueue = nullptr;                                         /*!< Semaphore to get access to the rx queue (partner sets it as the semaphore for the tx queue)    */
+        FRTTSemaphoreHandle semaphoreTxQueue = nullptr;                                         /*!< Semaphore to get access to the tx queue (partner sets it as the semaphore for the rx queue)    */
+
+        uint8_t u8TxQueueLength = 0;                                                            /*!< Length of the tx queue (> 0)*/
+        uint8_t u8RxQueueLength = 0;                                                            /*!< Length of the rx queue (> 0)*/
+
+        struct FRTTDataContainerOnQueue txLineStorage[FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE];    /*!< Embedded storage of txLineContainer (used if no FRTT::FRTTLineStorage was supplied)      */
+        struct FRTTDataContainerOnQueue * txLineContainer = txLineStorage;                      /*!< Array holding data packages that are currently lying / have previously lain on the queue       */
+        struct FRTTDataContainerOnQueue rxLineContainer;                                        /*!< Intermediate container between queue and internal buffers                                      */
+
+        FRTTQueueHandle rxQueue = nullptr;                                                      /*!< Holds the address of the rx queue  */
+        FRTTQueueHandle txQueue = nullptr;                                                      /*!< Holds the address of the tx queue  */
+        FRTTSpscRingHandle rxRing = nullptr;                                                    /*!< Holds the address of the rx ring (used instead of the rx queue)  */
+        FRTTSpscRingHandle txRing = nullptr;                                                    /*!< Holds the address of the tx ring (used instead of the tx queue)  */
+
+        FRTTTempDataContainer tempStorage[FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE];                /*!< Embedded storage of tempContainer (used if no FRTT::FRTTLineStorage was supplied)        */
+        FRTTSharedPayload * sharedStorage[FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE] = {};          /*!< Embedded storage of sharedPayload (used if no FRTT::FRTTLineStorage was supplied)        */
+        FRTTTempDataContainer * tempContainer = tempStorage;                                    /*!< Internal buffers. Data read from the queue end up in this buffer (circular, oldest entry at u8BufferHead) */
+        FRTTSharedPayload ** sharedPayload = sharedStorage;                                     /*!< Shared payload referenced by the entry of the internal buffer at the same position (or nullptr)    */
+        uint8_t u8Depth = FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE;                                 /*!< Amount of entries of the arrays above. Upper bound for the queue lengths of this line     */
+
+        #ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE                                                             
+        std::atomic<uint32_t> dataPackagesReceived {0};                                         /*!< Hold the amount of data packages received. (TURN ON/OFF in FRTTransceiverSettings.h)   */
+        std::atomic<uint32_t> dataPackagesSent {0};                                             /*!< Hold the amount of data packages sent. (TURN ON/OFF in FRTTransceiverSettings.h)       */
+        std::atomic<uint32_t> dataPackagesDropped {0};                                          /*!< Hold the amount of data packages rejected by the data allocate callback. (TURN ON/OFF in FRTTransceiverSettings.h)  */
+        #endif
+        #ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+        FRTTLineLatencyCounters latency;                                                        /*!< Latency histograms of the rx line. (TURN ON/OFF in FRTTransceiverSettings.h)           */
+        #endif
+
+        bool bHasBufferedData = false;                                                          /*!< Signals whether we have buffered data for that specific communication line     */
+        bool bRxBufferFull = false;                                                             /*!< Signals whether the internal buffer is full. Only for internal use.            */
+        bool bTakeOwnership = false;                                                            /*!< Signals whether the receiver adopts the data of a package instead of calling the data allocate callback (ownership transfer)   */
+        bool bFanOutPending = false;                                                            /*!< Signals that a fan-out broadcast still has to deliver to this line. Only for internal use.    */
+        bool bFireAndForget = false;                                                            /*!< Signals that writes go straight to the tx queue (no mirror in txLineContainer, no tx semaphore)    */
+        uint8_t u8Priority = 0;                                                                 /*!< Priority of the rx line for FRTT::eFRTTSchedulingPolicy::e_STRICTPRIORITY (higher is served first)    */
+        uint8_t u8Weight = 1;                                                                   /*!< Weight of the rx line for FRTT::eFRTTSchedulingPolicy::e_WEIGHTEDROUNDROBIN (data packages per turn)  */
+        uint8_t u8Deficit = 0;                                                                  /*!< Credit left in the current turn of the weighted round-robin. Only for internal use.                   */
+        uint32_t u32ServiceCount = 0;                                                           /*!< Amount of data packages FRTT::FRTTransceiver::serviceLines() read from this line                      */
+        #if (FRTTRANSCEIVER_INDEXEDDATATYPES > 0)
+        uint8_t au8DatatypeCount[FRTTRANSCEIVER_INDEXEDDATATYPES] = {};                         /*!< Amount of buffered data packages per datatype. Only for internal use.                             */
+        #endif
+        const struct FRTTDatatypeTable * datatypeTable = nullptr;                               /*!< Handler table of the line for FRTT::FRTTransceiver::dispatch() (nullptr = table of the object)    */
+        uint32_t u32TxDoorbellMask = 0;                                                         /*!< Bits a write on the tx line sets in the partner's notification value (0 = off). See FRTT::FRTTransceiver::setDoorbell()   */
+        uint32_t u32RxDoorbellMask = 0;                                                         /*!< Bits that belong to the rx line in the own notification value (0 = off). See FRTT::FRTTransceiver::drainDoorbellLines()  */
+        bool bSharedTxDoorbell = false;                                                         /*!< Signals that other tasks write to the same tx queue/ring, every write rings (FRTT::eFRTTDoorbell::e_SHAREDTXLINE)        */
+        bool bInRxQueueSet = false;                                                             /*!< Signals that the rx queue (or the signal of the rx ring) is a member of the queue set of FRTT::FRTTransceiver::readFromAny(). Only for internal use.  */
+        int16_t i16CurrTempcontainerPos = -1;                                                   /*!< Stores the position (relative to the oldest entry) of the newest entry in the internal buffer     */
+        uint8_t u8BufferHead = 0;                                                               /*!< Index of the oldest entry in the internal buffer. Only for internal use.       */
+        uint8_t u8Generation = 0;                                                               /*!< Incremented whenever the structure is assigned to a new communication line (invalidates old FRTT::FRTTLine handles)   */
+    };
+
+    /*!
+    * \brief   Pre-resolved handle of a communication line
+    * \details Returned by FRTT::FRTTransceiver::getLine(). Methods taking a FRTT::FRTTLine skip the partner lookup and all checks 
+    *          that were already made while the communication line was added.
+    */
+    struct FRTTLine
+    {
+        uint8_t u8Slot = FRTTRANSCEIVER_INVALIDLINE;                                            /*!< Position of the communication line inside the array of FRTT::FRTTCommunicationPartner    */
+        uint8_t u8Generation = 0;                                                               /*!< Generation of the communication line at the time the handle was created                  */
+        const FRTTransceiver * owner = nullptr;                                                 /*!< Object that created the handle. Handles of other objects are rejected                    */
+    };
+
+    /*!
+    * \brief   Order in which FRTT::FRTTransceiver::serviceLines() reads the rx lines
+    */
+    enum class eFRTTSchedulingPolicy : uint8_t
+    {
+        e_STRICTPRIORITY = 0,                   /*!< Always reads the line with the highest priority that has data. Lines of the same priority take turns              */
+        e_WEIGHTEDROUNDROBIN,                   /*!< Deficit round-robin. Each turn a line may read as many data packages as its weight (unused credit is not kept)    */
+    };
+
+    /*!
+    * \brief   Side of a communication line FRTT::FRTTransceiver::setDoorbell() configures
+    */
+    enum class eFRTTDoorbell : uint8_t
+    {
+        e_TXLINE = 0,                           /*!< Sender: writes that find the tx line (nearly) empty set the bits in the partner's notification value              */
+        e_SHAREDTXLINE,                         /*!< Sender on a tx queue/ring other tasks write to as well (e.g. a Multi-Sender-Queue): every write sets the bits      */
+        e_RXLINE,                               /*!< Receiver: the bits FRTT::FRTTransceiver::drainDoorbellLines() reads the rx line for                               */
+    };
+
+    /*! \brief Two handles are equal if they refer to the same communication line (e.g. compare the result of FRTT::FRTTransceiver::readFromAny() with FRTT::FRTTransceiver::getLine()) */
+    inline bool operator==(const FRTTLine & a,const FRTTLine & b) { return a.u8Slot == b.u8Slot && a.u8Generation == b.u8Generation && a.owner == b.owner; }
+    /*! \brief See FRTT::operator==(const FRTTLine &,const FRTTLine &) */
+    inline bool operator!=(const FRTTLine & a,const FRTTLine & b) { return !(a == b); }
+
+    /*! \brief Pointer to the data allocator callback a user needs to supply in order to use this library       */
+    using fP_dataAllocateCallback =  void (*)(const FRTTDataContainerOnQueue &,FRTTTempDataContainer &);
+    /*! \brief Pointer to the data de-allocator callback a user needs to supply in order to use this library    */
+    using fP_dataFreeCallback = void (*)(FRTTTempDataContainer &);
+    /*! \brief Pointer to a handler of a notification bit (FRTT::FRTTransceiver::dispatchNotifications()). Gets the dispatching object, the bound line (may be invalid) and the user context */
+    using fP_notificationHandler = void (*)(FRTTransceiver &,FRTTLine,void *);
+
+    /*!
+    * \brief   Entry of a notification bit table (FRTT::FRTTransceiver::setNotificationHandlerTable())
+    * \details A bit can be bound to a rx line (read when the bit is set), to a handler or to both
+    */
+    struct FRTTNotificationHandler
+    {
+        fP_notificationHandler handler = nullptr;                                               /*!< Called for every set bit (after the bound line was read)        */
+        void * context = nullptr;                                                               /*!< Handed to the handler unchanged                                 */
+        FRTTLine line;                                                                          /*!< Rx line read when the bit is set (invalid = none)                */
+    };
+
+    /*! \brief Pointer to a handler of one datatype (FRTT::FRTTransceiver::dispatch()). Gets the dispatching object, the line, the buffered data package and the context of the table */
+    using fP_datatypeHandler = void (*)(FRTTransceiver &,FRTTLine,const FRTTTempDataContainer &,void *);
+
+    /*! \brief Handler of all datatypes nobody registered for. Does nothing */
+    inline void FRTTIgnoreDatatype(FRTTransceiver &,FRTTLine,const FRTTTempDataContainer &,void *) {}
+
+    /*!
+    * \brief   Handler table indexed by FRTT::FRTTDataContainerOnQueue::u8DataType (FRTT::FRTTransceiver::setDatatypeTable())
+    * \details Every entry starts with FRTT::FRTTIgnoreDatatype(), so the dispatch is a plain indexed call without checks.
+    *          Register a handler with table.handlers[u8DataType] = handler
+    */
+    struct FRTTDatatypeTable
+    {
+        fP_datatypeHandler handlers[FRTTRANSCEIVER_DATATYPES];                                  /*!< Handler per datatype                                            */
+        void * context = nullptr;                                                               /*!< Handed to every handler unchanged                               */
+
+        FRTTDatatypeTable() { for(fP_datatypeHandler & handler : handlers) handler = FRTTIgnoreDatatype; }
+    };
+
+    /*!
+    * \brief   Header wrapped around the data of a shared broadcast (FRTT::FRTTransceiver::databroadcastShared())
+    * \details Every receiver buffers a view of FRTT::FRTTSharedPayload::payload instead of its own copy. The view is not write protected,
+    *          receivers that change the data change it for all others.
+    *          The free callback of the sender runs once, when the last reference is released.
+    */
+    struct FRTTSharedPayload
+    {
+        std::atomic<uint32_t> u32References {0};                                                /*!< Amount of data packages/buffer entries still referencing the payload    */
+        FRTTTempDataContainer payload;                                                          /*!< Original data package of the sender                                      */
+        fP_dataFreeCallback freeCallback = nullptr;                                             /*!< Free callback of the sender                                              */
+    };
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef FRTTRANSCEIVERPOOL_H
+#define FRTTRANSCEIVERPOOL_H
+
+/*!
+ * \file        FRTTransceiverPool.h
+ * \brief       Fixed-block payload pools and ready-made data allocate/free callbacks
+ * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
+ * \version     v1.2.0
+ * \copyright   Copyright 2022 Xhemail Ramabaja
+ *
+ */
+#include "FRTTransceiverExtension.h"
+#include <atomic>
+
+namespace FRTT {
+
+    /*! \brief Snapshot of the usage of one FRTT::FRTTPool */
+    struct FRTTPoolStatistics
+    {
+        uint16_t u16BlockSize = 0;                                                              /*!< Size of one block (bytes)                                                  */
+        uint16_t u16Blocks = 0;                                                                 /*!< Amount of blocks of the pool                                               */
+        uint16_t u16InUse = 0;                                                                  /*!< Amount of blocks currently handed out                                      */
+        uint16_t u16HighWater = 0;                                                              /*!< Maximum amount of blocks that were handed out at the same time             */
+        uint32_t u32Exhausted = 0;                                                              /*!< Amount of allocations that failed because no block was left                */
+    };
+
+    /*!
+    * \brief   Pool of equally sized blocks with O(1) lock-free allocate and free
+    * \details The free blocks form a stack. The index of the next free block is stored inside the free block itself,
+    *          the top of the stack is tagged to rule out ABA problems. Safe to use from several tasks at once (not from an ISR)
+    */
+    class FRTTPool
+    {
+        private:
+            uint8_t * _pu8Storage;                                                              /*!< Memory holding all blocks                                                  */
+            uint16_t _u16BlockSize;                                                             /*!< Size of one block (bytes, >= 2)                                            */
+            uint16_t _u16Blocks;                                                                /*!< Amount of blocks                                                           */
+            std::atomic<uint32_t> _u32Head {0};                                                 /*!< Top of the free stack. Low 16 bit: index of the block, high 16 bit: tag   */
+            std::atomic<uint16_t> _u16InUse {0};                                                /*!< See FRTT::FRTTPoolStatistics::u16InUse                                     */
+            std::atomic<uint16_t> _u16HighWater {0};                                            /*!< See FRTT::FRTTPoolStatistics::u16HighWater                                 */
+            std::atomic<uint32_t> _u32Exhausted {0};                                            /*!< See FRTT::FRTTPoolStatistics::u32Exhausted                                 */
+
+        public:
+            /*!
+            * \brief                        FRTTPool Constructor
+            * \param storage                Memory for u16Blocks * u16BlockSize bytes (aligned for the data that will be stored)
+            * \param u16BlockSize           Size of one block in bytes (min 2, use a multiple of the required alignment)
+            * \param u16Blocks              Amount of blocks (max 65534)
+            * \attention                    The pool does not take ownership of the storage. It must outlive the pool
+            */
+            FRTTPool(void * storage,uint16_t u16BlockSize,uint16_t u16Blocks);
+            FRTTPool(const FRTTPool &) = delete;
+            FRTTPool & operator=(const FRTTPool &) = delete;
+            /*!
+            * \brief                        Takes one block out of the pool
+            * \return                       Address of the block or nullptr (pool exhausted)
+            */
+            void * allocate();
+            /*!
+            * \brief                        Gives a block back to the pool
+            * \param block                  Address returned by FRTT::FRTTPool::allocate() (nullptr is ignored)
+            * \return                       void
+            */
+            void release(void * block);
+            /*!
+            * \brief                        Checks whether the address belongs to a block of this pool
+            * \param block                  Address to check
+            * \return                       True if the address is the start of one block of this pool
+            */
+            bool owns(const void * block) const;
+            /*!
+            * \brief                        Returns the size of one block
+            * \return                       Block size in bytes
+            */
+            uint16_t blockSize() const { return this->_u16BlockSize; }
+            /*!
+            * \brief                        Returns the usage of the pool
+            * \return                       Snapshot of the pool statistics
+            */
+            FRTTPoolStatistics getStatistics() const;
+            /*!
+            * \brief                        Resets the high-water mark (to the current usage) and the exhaustion counter
+            * \return                       void
+            */
+            void resetStatistics();
+    };
+
+    /*!
+    * \brief   FRTT::FRTTPool that brings its own storage
+    * \tparam  BlockSize                    Size of one block (bytes). Rounded up to a multiple of 8
+    * \tparam  Blocks                       Amount of blocks
+    */
+    template<uint16_t BlockSize,uint16_t Blocks>
+    class FRTTStaticPool : public FRTTPool
+    {
+        static_assert(BlockSize > 0 && Blocks > 0 && Blocks < 0xFFFFu,"Invalid pool dimensions");
+
+        private:
+            static constexpr uint16_t _u16Stride = (BlockSize + 7u) & ~7u;
+            alignas(8) uint8_t _au8Storage[_u16Stride * Blocks];
+
+        public:
+            FRTTStaticPool() : FRTTPool(_au8Storage,_u16Stride,Blocks) {};
+    };
+
+    /*!
+    * \brief                                Lets the ready-made callbacks serve one datatype with a pool
+    * \param u8DataType                     Datatype (must be lower than FRTTRANSCEIVER_POOLDATATYPES)
+    * \param pool                           Pool for that datatype. Several datatypes of similar size can share one pool (size class)
+    * \param u16PayloadSize                 Size of the data behind FRTT::FRTTDataContainerOnQueue::data for that datatype (<= block size of the pool)
+    * \return                               True if the datatype was registered
+    * \note                                 Register all datatypes before any task uses FRTT::FRTTPoolAllocateCallback()/FRTT::FRTTPoolFreeCallback()
+    */
+    bool FRTTPoolRegister(uint8_t u8DataType,FRTTPool & pool,uint16_t u16PayloadSize);
+
+    /*!
+    * \brief                                Ready-made data allocate callback (FRTT::FRTTransceiver::addDataAllocateCallback())
+    * \details                              Copies the payload of a received data package into a block of the pool registered for its datatype
+    * \param orig                           Data package from the queue
+    * \param temp                           Internal buffer entry
+    * \return                               void
+    * \note                                 Only for trivially copyable payloads. If the datatype is not registered or the pool is exhausted, the data package is rejected (FRTTRANSCEIVER_FLAG_REJECTED)
+    */
+    void FRTTPoolAllocateCallback(const FRTTDataContainerOnQueue & orig,FRTTTempDataContainer & temp);
+
+    /*!
+    * \brief                                Ready-made data free callback (FRTT::FRTTransceiver::addDataFreeCallback())
+    * \param temp                           Internal buffer entry whose block goes back to its pool
+    * \return                               void
+    */
+    void FRTTPoolFreeCallback(FRTTTempDataContainer & temp);
+}
+#endif
@@ -1,75 +1,157 @@
-#ifndef FRTTRANSCEIVERSETTINGS_H
-#define FRTTRANSCEIVERSETTINGS_H
-
-/*!
- * \file        FRTTransceiverSettings.h
- * \brief       Configuration file for the FreeRTOS-Transceiver library
- * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
- * \version     v1.2.0
- * \copyright   Copyright 2022 Xhemail Ramabaja
- *
- */
-
-#include <stdint.h>
-
-//*! \brief TURN ON (uncomment) to use up to 64 bit as additional data for a data package on queue (turn off 32 bit)*/
-//#define FRTTRANSCEIVER_64BITADDITIONALDATA
-/*! \brief TURN ON (uncomment) to use up to 32 bit as additional data for a data package on queue (turn off 64 bit)*/
-#define FRTTRANSCEIVER_32BITADDITIONALDATA
-
-/*!
- * \brief   Defines the maximum length a queue can have
- * \note    To save memory please set the number as low as possible (> 0)
- */
-#define FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE                (3u)
-
-/*! \brief   Default name of a partner, when no name is supplied */
-#define FRTTRANSCEIVER_DEFAULTPARTNERNAME                   ("UNKNOWN NAME") 
-/*! \brief Default name of a Multi-Sender-Queue (multiple tasks write on the tx line), when no name is supplied */
-#define FRTTRANSCEIVER_DEFAULTPARTNERNAMEMULTISENDERQUEUE   ("MULTISENDER-QUEUE")
-/*! \brief TURN ON (uncomment) if you want to use FRTT::FRTTransceiver.printCommunicationsSummary() and let the library track packages received/sent etc. (SHOULD ONLY BE USED FOR DEBUGGING) */
-//#define FRTTRANSCEIVER_ANALYTICS_ENABLE
-
-#if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE)
-/*!
- * \brief   Describes a normal communication line with another task
- * \note    Used for FRTT::FRTTransceiver.printCommunicationsSummary()
- */
-#define FRTTRANSCEIVER_COMMTYPE1                            ("NORMAL COMMUNICATION (READ & WRITE)")
-/*!
- * \brief   Describes a read-only communication line, where the tx queue is a multi-sender-queue (multiple tasks write on the tx line)
- * \note    Used for FRTT::FRTTransceiver.printCommunicationsSummary()
- */
-#define FRTTRANSCEIVER_COMMTYPE2                            ("MULTISENDER QUEUE (READONLY)")
-/*!
- * \brief   Describes an echo communicatation line, where a task set him self as his communication partner
- * \note    Used for FRTT::FRTTransceiver.printCommunicationsSummary()
- */
-#define FRTTRANSCEIVER_COMMTYPE3                            ("ECHO")
-/*!
- * \brief   When the address of the partner was not supplied
- * \note    Used by FRTT::FRTTransceiver.printCommunicationsSummary()
- */
-#define FRTTRANSCEIVER_UNKNOWNADDRESS                       (0x00000000)
-#endif
-
-namespace FRTT {
-    /*!
-    * \brief         Enumeration is used to select a multi-sender-queue for different class methods
-    * \details       Normally one would need to select a communication line by supplying a FRTT::FRTTTaskHandle.
-    *                A multi-sender-queue does not have a unique FRTT::FRTTTaskHandle, so that another way of selecting a communication line
-    *                had to be introduced.<br>
-    * \note          There should be a maximum of #FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE enumerators. <br>
-    *                Increasing #FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE also requires one to adjust the amount of eMultiSenderQueue enumerators to match #FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE
-    *                
-    */
-    enum class eMultiSenderQueue : int8_t 
-    {
-        eNOMULTIQSELECTED   = -1,           /*!< It is just a filler enumerator if one wants to use a FRTT::FRTTTaskHandle for selecting a communication line       */
-        eMULTISENDERQ0,                     /*!< Select the FIRST Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                       */
-        eMULTISENDERQ1,                     /*!< Select the SECOND Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                      */
-        eMULTISENDERQ2,                     /*!< Select the THIRD Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                       */
-        eMULTISENDERQ3,                     /*!< Select the FOURTH Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                      */
-    };
-}
+#ifndef FRTTRANSCEIVERSETTINGS_H
+#define FRTTRANSCEIVERSETTINGS_H
+
+/*!
+ * \file        FRTTransceiverSettings.h
+ * \brief       Configuration file for the FreeRTOS-Transceiver library
+ * \author      Xhemail Ramabaja (x.ramabaja@outlook.de)
+ * \version     v1.2.0
+ * \copyright   Copyright 2022 Xhemail Ramabaja
+ *
+ */
+
+#include <stdint.h>
+
+//*! \brief TURN ON (uncomment) to use up to 64 bit as additional data for a data package on queue (turn off 32 bit)*/
+//#define FRTTRANSCEIVER_64BITADDITIONALDATA
+/*! \brief TURN ON (uncomment) to use up to 32 bit as additional data for a data package on queue (turn off 64 bit)*/
+#define FRTTRANSCEIVER_32BITADDITIONALDATA
+
+/*!
+ * \brief   TURN ON (uncomment) to send an 8 bit sender id instead of the FRTT::FRTTTaskHandle of the sender with every data package
+ * \note    Shrinks every queue item, ring slot and buffer entry (and the copies in and out of a queue) by sizeof(FRTTTaskHandle) - 1 bytes.
+ *          FRTT::FRTTDataContainerOnQueue::senderAddress is replaced by FRTT::FRTTDataContainerOnQueue::u8SenderId,
+ *          use FRTT::FRTTGetSender() to get the address of the sender (data allocate callbacks have to copy u8SenderId)
+ */
+//#define FRTTRANSCEIVER_COMPACTDATAPACKAGE
+
+#if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+/*!
+ * \brief   Amount of tasks the sender id registry can hold (max 255). Every task owning a FRTT::FRTTransceiver takes one id
+ * \note    Costs sizeof(FRTTTaskHandle) bytes per id. Data packages of tasks that did not get an id have the unknown sender (id 0)
+ */
+#define FRTTRANSCEIVER_SENDERIDS                            (32u)
+#endif
+
+/*!
+ * \brief   Defines the maximum length a queue can have (if no own storage is supplied while adding the communication line)
+ * \note    Every FRTT::FRTTCommunicationPartner embeds buffers of this size. To save memory please set the number as low as possible (> 0)<br>
+ *          and hand a FRTT::FRTTLineStorage to the few communication lines that need deeper queues
+ */
+#define FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE                (3u)
+
+/*!
+ * \brief   Defines the maximum length a queue with its own storage (FRTT::FRTTLineStorage) can have
+ * \note    Upper bound for FRTT::FRTTCreateQueue(). Max 255
+ */
+#define FRTTRANSCEIVER_MAXLINEDEPTH                         (255u)
+
+/*!
+ * \brief   Size of the partner lookup index each FRTT::FRTTransceiver keeps (maps a FRTT::FRTTTaskHandle to its communication line)
+ * \note    Must be a power of two (max 256). Keep it bigger than the amount of partners of your largest FRTT::FRTTransceiver instance,
+ *          otherwise partners that did not fit into the index are looked up with a linear scan
+ */
+#define FRTTRANSCEIVER_PARTNERINDEXSIZE                     (32u)
+
+/*!
+ * \brief   Amount of datatypes (0 ... n-1) that can be served by the ready-made pool callbacks (FRTT::FRTTPoolRegister())
+ * \note    Every datatype costs one registry entry (pool address + payload size)
+ */
+#define FRTTRANSCEIVER_POOLDATATYPES                        (32u)
+
+/*!
+ * \brief   Maximum amount of bytes a data package can carry inside the queue item itself (FRTT::FRTTransceiver::writeInlineToQueue(), max 255)
+ * \note    The bytes share their space with FRTT::FRTTDataContainerOnQueue::data. The default (sizeof(void *), spelled so the preprocessor can read it)
+ *          keeps the size of the queue items. Every byte beyond enlarges all queue items, ring slots and buffer entries. 0 turns inline payloads off
+ */
+#define FRTTRANSCEIVER_INLINEPAYLOADSIZE                    (__SIZEOF_POINTER__)
+
+/*!
+ * \brief   Amount of datatypes (0 ... n-1) counted per communication line while they are in the internal buffer
+ * \note    Lets FRTT::FRTTransceiver::isDatatypeInBuffer() answer in O(1) and the typed getters skip lines without the datatype
+ *          (a buffered datatype is still searched by scanning the buffer).
+ *          Costs one byte per datatype and line. Datatypes >= n are counted by scanning the buffer. 0 turns the index off
+ */
+#define FRTTRANSCEIVER_INDEXEDDATATYPES                     (16u)
+
+/*! \brief   Maximum amount of Multi-Sender-Queues selectable with a FRTT::eMultiSenderQueue enumerator (filler enumerator not included) */
+#define FRTTRANSCEIVER_MAXMULTISENDERQUEUES                 (4u)
+
+/*!
+ * \brief   Maximum length of a partner name (without the terminating '\0')
+ * \note    The name is stored inside every FRTT::FRTTCommunicationPartner (no heap allocation), longer names are cut off
+ */
+#define FRTTRANSCEIVER_MAXPARTNERNAMELENGTH                 (23u)
+
+/*! \brief   Default name of a partner, when no name is supplied */
+#define FRTTRANSCEIVER_DEFAULTPARTNERNAME                   ("UNKNOWN NAME") 
+/*! \brief Default name of a Multi-Sender-Queue (multiple tasks write on the tx line), when no name is supplied */
+#define FRTTRANSCEIVER_DEFAULTPARTNERNAMEMULTISENDERQUEUE   ("MULTISENDER-QUEUE")
+/*! \brief TURN ON (uncomment) if you want to use FRTT::FRTTransceiver.printCommunicationsSummary() and let the library track packages received/sent etc. (SHOULD ONLY BE USED FOR DEBUGGING) */
+//#define FRTTRANSCEIVER_ANALYTICS_ENABLE
+
+#if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE)
+/*!
+ * \brief   Describes a normal communication line with another task
+ * \note    Used for FRTT::FRTTransceiver.printCommunicationsSummary()
+ */
+#define FRTTRANSCEIVER_COMMTYPE1                            ("NORMAL COMMUNICATION (READ & WRITE)")
+/*!
+ * \brief   Describes a read-only communication line, where the tx queue is a multi-sender-queue (multiple tasks write on the tx line)
+ * \note    Used for FRTT::FRTTransceiver.printCommunicationsSummary()
+ */
+#define FRTTRANSCEIVER_COMMTYPE2                            ("MULTISENDER QUEUE (READONLY)")
+/*!
+ * \brief   Describes an echo communicatation line, where a task set him self as his communication partner
+ * \note    Used for FRTT::FRTTransceiver.printCommunicationsSummary()
+ */
+#define FRTTRANSCEIVER_COMMTYPE3                            ("ECHO")
+/*!
+ * \brief   When the address of the partner was not supplied
+ * \note    Used by FRTT::FRTTransceiver.printCommunicationsSummary()
+ */
+#define FRTTRANSCEIVER_UNKNOWNADDRESS                       (0x00000000)
+#endif
+
+/*!
+ * \brief   TURN ON (uncomment) to stamp every data package with its enqueue time and keep latency histograms per communication line
+ * \note    Adds 4 bytes to every data package on a queue. See FRTT::FRTTransceiver::getLatencyHistograms()
+ */
+//#define FRTTRANSCEIVER_LATENCY_ENABLE
+
+#if defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+#ifndef FRTTRANSCEIVER_TIMESTAMP
+#include "esp_timer.h"
+/*!
+ * \brief   Free-running 32 bit timestamp used for the latency histograms (default: microseconds since boot)
+ * \note    Define it before including the library to use another clock (e.g. a cycle counter). Wrap-arounds are handled
+ */
+#define FRTTRANSCEIVER_TIMESTAMP()                          ((uint32_t)esp_timer_get_time())
+#endif
+/*!
+ * \brief   Amount of buckets of a latency histogram. Bucket 0 counts the latencies 0 and 1, bucket n the latencies [2^n, 2^(n+1))
+ * \note    The last bucket counts all latencies that do not fit into the buckets before
+ */
+#define FRTTRANSCEIVER_LATENCYBUCKETS                       (20u)
+#endif
+
+namespace FRTT {
+    /*!
+    * \brief         Enumeration is used to select a multi-sender-queue for different class methods
+    * \details       Normally one would need to select a communication line by supplying a FRTT::FRTTTaskHandle.
+    *                A multi-sender-queue does not have a unique FRTT::FRTTTaskHandle, so that another way of selecting a communication line
+    *                had to be introduced.<br>
+    * \note          There should be a maximum of #FRTTRANSCEIVER_MAXMULTISENDERQUEUES enumerators. <br>
+    *                Increasing #FRTTRANSCEIVER_MAXMULTISENDERQUEUES also requires one to adjust the amount of eMultiSenderQueue enumerators to match #FRTTRANSCEIVER_MAXMULTISENDERQUEUES
+    *                
+    */
+    enum class eMultiSenderQueue : int8_t 
+    {
+        eNOMULTIQSELECTED   = -1,           /*!< It is just a filler enumerator if one wants to use a FRTT::FRTTTaskHandle for selecting a communication line       */
+        eMULTISENDERQ0,                     /*!< Select the FIRST Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                       */
+        eMULTISENDERQ1,                     /*!< Select the SECOND Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                      */
+        eMULTISENDERQ2,                     /*!< Select the THIRD Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                       */
+        eMULTISENDERQ3,                     /*!< Select the FOURTH Multi-Sender-Queue added with FRTT::FRTTransceiver::addMultiSenderPartner()                      */
+    };
+}
 #endif
\ No newline at end of file
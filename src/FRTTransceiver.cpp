@@ -1,1241 +1,3453 @@
-#ifndef FRTTRANSCEIVER_CPP
-#define FRTTRANSCEIVER_CPP
-
-/*!
- * \file       	FRTTransceiver.cpp
- * \brief      	Transceiver class methods implementation
- * \author     	Xhemail Ramabaja (x.ramabaja@outlook.de)
- * \version 	   v1.2.0
- * \copyright  	Copyright 2022 Xhemail Ramabaja
- */
-
-#include "../include/FRTTransceiver.h"
-#include <cstdio>
-
-//#define LOG_INFO
-namespace FRTT {
-   #if defined(ESP32) || defined (CONFIG_IDF_TARGET_ESP32)
-         void FRTTCreateTask(FRTTTaskFunction taskCode,
-                           const char * const taskName,
-                           const uint32_t stackbytes,
-                           void * const taskParameter,
-                           FRTTBaseType taskPriority,
-                           FRTTTaskHandle * taskHandle,
-                           const FRTTBaseType core)
-         {
-            if(taskCode == nullptr) return;
-
-            if(xTaskCreatePinnedToCore(taskCode,string(taskName).size() == 0 ? "def-task-name" : taskName,stackbytes,taskParameter,taskPriority,taskHandle,core) != pdPASS)
-            {
-               #ifdef LOG_INFO
-               printf("Task creation failed.\n");
-               #endif
-            }
-         }
-	#elif defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP8266)
-         void FRTTCreateTask(FRTTTaskFunction taskCode,
-                           const char * const taskName,
-                           const uint16_t stackbytes,
-                           void * const taskParameter,
-                           FRTTBaseType taskPriority,
-                           FRTTTaskHandle * taskHandle)
-         {
-            if(taskCode == nullptr) return;
-            
-            if(xTaskCreate(taskCode,string(taskName).size() == 0 ? "def-task-name" : taskName,stackbytes,taskParameter,taskPriority,taskHandle) != pdPASS)
-            {
-               #ifdef LOG_INFO
-               printf("Task creation failed.\n");
-               #endif
-            }
-		   }               
-      
-    #endif
-
-
-	FRTTQueueHandle FRTTCreateQueue(FRTTBaseType lengthOfQueue)
-	{
-
-		if(lengthOfQueue <= 0 || lengthOfQueue > FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE)
-		{
-			#ifdef LOG_INFO
-			printf("Supplied length of the queue is not valid. NULL returned [Either too small or too big]\n");
-			#endif
-			return nullptr;
-		}
-
-		FRTTQueueHandle queue = xQueueCreate(lengthOfQueue,sizeof(struct FRTTDataContainerOnQueue));
-
-		if(!queue)
-		{
-			#ifdef LOG_INFO
-			printf("Queue cannot be created [Insufficient heap memory]\n");
-			#endif
-		}
-		else
-		{
-			#ifdef LOG_INFO
-			printf("Queue successfully created. Queue handle returned\n");
-			#endif
-		}
-		return queue;
-	}
-
-
-	FRTTSemaphoreHandle FRTTCreateSemaphore()
-	{
-		FRTTSemaphoreHandle semaphore = xSemaphoreCreateMutex();
-
-		if(!semaphore)
-		{
-			#ifdef LOG_INFO
-			printf("Semaphore cannot be created [Insufficient heap memory]\n");
-			#endif
-		}
-		else
-		{
-			#ifdef LOG_INFO
-			printf("Semaphore successfully created. Semaphore handle returned\n");
-			#endif
-		}
-		return semaphore;
-	}
-		
-	bool FRTTransceiver::_checkForMessages(FRTTQueueHandle txQueue)
-	{
-		if(txQueue)
-		{
-			return uxQueueMessagesWaiting(txQueue) > 0 ? true:false;
-		}
-
-		return false;
-	}
-
-
-	int FRTTransceiver::_getAmountOfMessages(FRTTQueueHandle queue)
-	{
-		if(queue)
-		{
-			return uxQueueMessagesWaiting(queue);
-		}
-		return -1;
-	}
-
-	bool FRTTransceiver::_hasDataInterpreters()
-	{
-		return (this->_dataAllocator && this->_dataDestroyer) ? true:false;
-	}
-
-	bool FRTTransceiver::_hasSemaphore(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar, bool bTxLine)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return false;
-		}
-		
-		if(bUseTaskHandleVar)
-		{
-			if(bTxLine)
-			{
-				return this->_structCommPartners[pos].semaphoreTxQueue == nullptr ? false:true;
-			}
-			else
-			{
-				return this->_structCommPartners[pos].semaphoreRxQueue == nullptr ? false:true;
-			}
-		}
-		else
-		{
-			return this->_structCommPartners[pos].semaphoreRxQueue == nullptr ? false:true;
-		}
-	}
-
-	bool FRTTransceiver::addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,
-					uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
-					FRTTQueueHandle queueTX,uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,const string partnersName)
-	{
-
-		if(!this->_bHasValidStruct || this->_u8CurrCommPartners + 1 > this->_u8MaxPartners)
-		{
-			return false;
-		}
-
-		/* Handle should not be nullptr AND no communication structure should be linked to the new partner */
-		if(partner != nullptr && this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true) == -1)
-		{
-			this->_structCommPartners[_u8CurrCommPartners].commPartner = partner;
-		}
-		else
-		{
-			return false;
-		}
-
-
-		if(queueRX != nullptr)
-		{	
-			if(this->_queueExists(queueRX,false) != 1 && this->_queueExists(queueRX,true) != 1)
-			{	
-				if(semaphoreRx == nullptr || this->_semaphoreExists(semaphoreRx,true) == 1 	|| this->_semaphoreExists(semaphoreRx,false) == 1
-																							|| (this->_checkValidQueueLength(u8QueueLengthRx) == false))
-				{	
-					/* It is possible to establish a connection without a queue (task-notification), 
-					but since the queue was valid, we shouldnt procceed further because the user clearly wanted to add a queue */
-					#ifdef LOG_INFO
-					printf("Queue is valid but the semaphore OR queuelength is invalid!\n");
-					#endif
-					return false;
-				}
-				this->_structCommPartners[_u8CurrCommPartners].rxQueue = queueRX;
-				this->_structCommPartners[_u8CurrCommPartners].u8RxQueueLength = u8QueueLengthRx;
-				this->_structCommPartners[_u8CurrCommPartners].semaphoreRxQueue = semaphoreRx;
-			}
-			else
-			{	
-				/* It is possible to establish a connection without a queue (task-notification), 
-					but since the queue was already added to a comm-line, we shouldnt procceed further because the user clearly wanted to add a queue */
-				#ifdef LOG_INFO
-				printf("Queue already exists\n");
-				#endif
-				return false;
-			}
-		}
-
-
-		if(queueTX != nullptr)
-		{	
-			if(this->_queueExists(queueTX,true) != 1 && this->_queueExists(queueTX,false) != 1)
-			{
-				if(semaphoreTx == nullptr || this->_semaphoreExists(semaphoreTx,true) == 1 	|| this->_semaphoreExists(semaphoreTx,false) == 1
-																							|| (this->_checkValidQueueLength(u8QueueLengthTx) == false))
-				{	
-					/* It is possible to establish a connection without a queue (task-notification), 
-					but since the queue was valid, we shouldnt procceed further because the user clearly wanted to add a queue */
-					#ifdef LOG_INFO
-					printf("Queue is valid but the semaphore OR queuelength is invalid!\n");
-					#endif
-					return false;
-				}
-				this->_structCommPartners[_u8CurrCommPartners].txQueue = queueTX;
-				this->_structCommPartners[_u8CurrCommPartners].u8TxQueueLength = u8QueueLengthTx;
-				this->_structCommPartners[_u8CurrCommPartners].semaphoreTxQueue = semaphoreTx;
-			}
-			else
-			{	
-				/* It is possible to establish a connection without a queue (task-notification), 
-					but since the queue was already added to a comm-line, we shouldnt procceed further because the user clearly wanted to add a queue */
-				#ifdef LOG_INFO
-				printf("Queue already exists\n");
-				#endif
-				return false;
-			}
-		}
-		
-		if(partnersName.length() == 0)
-		{
-			this->_structCommPartners[_u8CurrCommPartners].partnersName = FRTTRANSCEIVER_DEFAULTPARTNERNAME;
-		}
-		else
-		{
-			this->_structCommPartners[_u8CurrCommPartners].partnersName = partnersName;
-		}
-
-		this->_u8CurrCommPartners++;
-		return true;
-	}
-
-	bool FRTTransceiver::addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
-													const string multiSenderQueueName)
-	{
-		if(!this->_bHasValidStruct || this->_u8CurrCommPartners + 1 > this->_u8MaxPartners)
-		{
-			return false;
-		}
-
-		if(queueRX != nullptr)
-		{	
-			if(this->_queueExists(queueRX,false) != 1 && this->_queueExists(queueRX,true) != 1)
-			{
-				if(semaphoreRx == nullptr || this->_semaphoreExists(semaphoreRx,true) == 1 	|| this->_semaphoreExists(semaphoreRx,false) == 1
-																							||(this->_checkValidQueueLength(u8QueueLengthRx) == false))
-				{	
-					/* It is possible to establish a connection without a queue (task-notification), 
-					but since the queue was valid, we shouldnt procceed further because the user clearly wanted to add a queue */
-					#ifdef LOG_INFO
-					printf("Queue is valid but the semaphore OR queuelength is invalid!\n");
-					#endif
-					return false;
-				}
-				this->_structCommPartners[_u8CurrCommPartners].rxQueue = queueRX;
-				this->_structCommPartners[_u8CurrCommPartners].u8RxQueueLength = u8QueueLengthRx;
-				this->_structCommPartners[_u8CurrCommPartners].semaphoreRxQueue = semaphoreRx;
-			}
-			else
-			{	
-				/* It is possible to establish a connection without a queue (task-notification), 
-					but since the queue was already added to a comm-line, we shouldnt procceed further because the user clearly wanted to add a queue */
-				#ifdef LOG_INFO
-				printf("Queue already exists\n");
-				#endif
-				return false;
-			}
-		}
-		else
-		{
-			return false;
-		}
-
-		if(multiSenderQueueName.length() == 0)
-		{
-			this->_structCommPartners[_u8CurrCommPartners].partnersName = FRTTRANSCEIVER_DEFAULTPARTNERNAMEMULTISENDERQUEUE;
-		}
-		else
-		{
-			this->_structCommPartners[_u8CurrCommPartners].partnersName = multiSenderQueueName;
-		}
-
-		this->_structCommPartners[_u8CurrCommPartners].bReadOnlyCommunication = true; /* means multisender queue, where we dont send ourselves*/
-		this->_u8MultiSenderQueues++;
-		this->_u8CurrCommPartners++;
-		return true;
-	}
-
-	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-	bool FRTTransceiver::writeToQueue(FRTTTaskHandle destination,uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
-	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-	bool FRTTransceiver::writeToQueue(FRTTTaskHandle destination,uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
-	#endif
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(destination,eMultiSenderQueue::eNOMULTIQSELECTED,true);
-
-		if(pos == -1 || !this->_hasDataInterpreters() || !this->_hasSemaphore(destination,eMultiSenderQueue::eNOMULTIQSELECTED,true,true))
-		{
-			#ifdef LOG_INFO
-			printf("You are not allowed to write to a queue \nOne of the following things happened:\n"
-				"-[no communication struct available]\n"
-				"-[no callback functions for (allocating,freeing) data supplied]\n"
-				"-[no semphores supplied]\n"
-				"-[destination task unknown]\n");
-			#endif
-			return false;
-		}
-
-		if(this->_structCommPartners[pos].txQueue == nullptr || this->_checkValidQueueLength(this->_structCommPartners[pos].u8TxQueueLength) == false || data == nullptr)
-		{
-			#ifdef LOG_INFO
-			printf("Action now allowed \nOne of the following things happened:\n"
-				"-[no tx queue supplied]\n"
-				"-[queue length invalid]\n"
-				"-[data pointer null]\n");
-			#endif
-			return false;
-		}
-
-
-		unsigned long timeToWaitSemaphore = _checkWaitTime(blockTimeTakeSemaphore_Ms);
-		unsigned long timeToWaitWrite = _checkWaitTime(blockTimeWrite_Ms);
-
-		if(timeToWaitSemaphore == -2 || timeToWaitWrite == -2)
-		{  
-			return false;
-		}
-
-		timeToWaitSemaphore = (timeToWaitSemaphore == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitSemaphore));
-		timeToWaitWrite = (timeToWaitWrite == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitWrite));
-
-		SemaphoreHandle_t s = this->_structCommPartners[pos].semaphoreTxQueue;
-
-
-		/* Queue Full. Manual wait */
-		if(this->_structCommPartners[pos].u8TxQueueLength == this->_getAmountOfMessages(this->_structCommPartners[pos].txQueue))
-		{
-			/* does not end when data arrives, so if timeToWaitWrite == MAXWAIT -----> doesnt go further than below code */
-			/* c++11 no aggregate initialization possible */
-			struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
-			tempDataContainerOnQueue.senderAddress = this->_ownerAddress;
-			tempDataContainerOnQueue.data = data;
-			tempDataContainerOnQueue.u8DataType = u8DataType;
-
-			#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-			tempDataContainerOnQueue.u32AdditionalData = u32AdditionalData;
-			#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-			tempDataContainerOnQueue.u64AdditionalData = u64AdditionalData;
-			#endif
-
-			
-			FRTTBaseType returnVal = xQueueSendToBack(this->_structCommPartners[pos].txQueue,(const void *)&tempDataContainerOnQueue,timeToWaitWrite);
-
-			if(returnVal == pdPASS)
-			{
-				if(xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
-				{
-				#ifdef LOG_INFO
-				printf("Semaphore was not available before block time expired.\n");
-				#endif
-				return false;
-				}
-				
-				/* c++11 no aggregate initialization possible */
-				this->_structCommPartners[pos].txLineContainer[this->_structCommPartners[pos].u8TxQueueLength - 1].senderAddress = this->_ownerAddress;
-				this->_structCommPartners[pos].txLineContainer[this->_structCommPartners[pos].u8TxQueueLength - 1].data = data;
-				this->_structCommPartners[pos].txLineContainer[this->_structCommPartners[pos].u8TxQueueLength - 1].u8DataType = u8DataType;
-				#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-				this->_structCommPartners[pos].txLineContainer[this->_structCommPartners[pos].u8TxQueueLength - 1].u32AdditionalData = u32AdditionalData;
-				#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-				this->_structCommPartners[pos].txLineContainer[this->_structCommPartners[pos].u8TxQueueLength - 1].u64AdditionalData = u64AdditionalData,
-				#endif
-
-				#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-				this->_structCommPartners[pos].dataPackagesSent++;
-				#endif
-
-				xSemaphoreGive(s);
-				return true;
-			}
-
-			return false;
-		}
-
-		
-		if(xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
-		{
-			#ifdef LOG_INFO
-			printf("Semaphore was not available before block time expired.\n");
-			#endif
-			return false;
-		}
-
-		/* space left for another element */
-		uint8_t u8MessagesOnQueue = this->_getAmountOfMessages(this->_structCommPartners[pos].txQueue);
-		
-		/* c++11 no aggregate initialization possible */
-		this->_structCommPartners[pos].txLineContainer[u8MessagesOnQueue].senderAddress = this->_ownerAddress;
-		this->_structCommPartners[pos].txLineContainer[u8MessagesOnQueue].data = data;
-		this->_structCommPartners[pos].txLineContainer[u8MessagesOnQueue].u8DataType = u8DataType;
-		#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-		this->_structCommPartners[pos].txLineContainer[u8MessagesOnQueue].u32AdditionalData = u32AdditionalData;
-		#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-		this->_structCommPartners[pos].txLineContainer[u8MessagesOnQueue].u64AdditionalData = u64AdditionalData;
-		#endif
-
-
-		/* At this point we should just be able to put data on the queue without waiting. */
-		FRTTBaseType returnVal = xQueueSendToBack(this->_structCommPartners[pos].txQueue,(const void *)&this->_structCommPartners[pos].txLineContainer[u8MessagesOnQueue],
-																																									timeToWaitWrite);
-
-		if(returnVal == pdPASS)
-		{
-			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-			this->_structCommPartners[pos].dataPackagesSent++;
-			#endif
-		}
-		xSemaphoreGive(s);
-		return true;
-		
-	}
-
-
-	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
-	bool FRTTransceiver::databroadcast(uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
-	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-	bool FRTTransceiver::databroadcast(uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
-	#endif
-	{  
-		
-		if(!this->_bHasValidStruct || this->_getAmountOfQueues(true) <= 0) return false;
-
-		uint8_t u8SuccessCounter = 0;
-		
-		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners ; u8I++)
-		{
-			if(this->_structCommPartners[u8I].bReadOnlyCommunication == false || this->_structCommPartners[u8I].txQueue != nullptr)
-			{
-				#ifdef FRTTRANSCEIVER_32BITADDITIONALDATA
-				if(this->writeToQueue(this->_structCommPartners[u8I].commPartner,u8DataType,data,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms,u32AdditionalData)){
-				u8SuccessCounter++;
-				}
-				#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
-				if(this->writeToQueue(this->_structCommPartners[u8I].commPartner,u8DataType,data,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms,u64AdditionalData)){
-				u8SuccessCounter++;
-				}
-				#endif
-			}
-		}
-		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-		if(u8SuccessCounter > 0)
-		{
-			this->_broadcastCount++;
-		}
-		#endif
-
-		return (u8SuccessCounter == this->_getAmountOfQueues(true));
-	}
-
-
-	bool FRTTransceiver::readFromQueue(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms)
-	{
-		if(!this->_bHasValidStruct || !this->_hasDataInterpreters() || !this->_hasSemaphore(partner,multiSenderQueue,bUseTaskHandleVar,false))
-		{
-			return false;
-		}
-
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1 || this->_structCommPartners[pos].rxQueue == nullptr)
-		{
-			return false;
-
-		}
-
-		unsigned long timeToWaitRead = this->_checkWaitTime(blockTimeRead_Ms);
-		unsigned long timeToWaitSemaphore = this->_checkWaitTime(blockTimeTakeSemaphore_Ms);
-
-		if(timeToWaitRead == -2 || timeToWaitSemaphore == -2)
-		{
-			return false;
-		}
-
-		timeToWaitRead = (timeToWaitRead == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitRead));
-		timeToWaitSemaphore = (timeToWaitSemaphore == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitSemaphore));
-		
-		
-
-		FRTTBaseType returnVal = xQueueReceive(this->_structCommPartners[pos].rxQueue,(void *)&this->_structCommPartners[pos].rxLineContainer,(TickType_t)timeToWaitRead);
-
-
-		/* errQUEUE_EMPTY returned if expression true*/
-		if(!(returnVal == pdPASS))
-		{
-			return false;
-		}
-
-		SemaphoreHandle_t s = this->_structCommPartners[pos].semaphoreRxQueue;
-
-		if(xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
-		{
-			return false;
-		}
-
-		/* Here it needs to be checked whether we still have space in the tempcontainer array or not*/
-		if(this->_structCommPartners[pos].bRxBufferFull)
-		{
-			/* remove oldest data */
-			this->_dataDestroyer(this->_structCommPartners[pos].tempContainer[0]);
-			/* rearrange array if length at least 2 */
-			if(this->_structCommPartners[pos].u8RxQueueLength - 1 > 0)
-			{
-				this->_rearrangeTempContainerArray(pos,0);
-			}
-			this->_structCommPartners[pos].i8CurrTempcontainerPos--;
-		}
-
-		this->_dataAllocator(this->_structCommPartners[pos].rxLineContainer,this->_structCommPartners[pos].tempContainer[++this->_structCommPartners[pos].i8CurrTempcontainerPos]);
-		this->_structCommPartners[pos].bHasBufferedData = true;
-
-		if(this->_structCommPartners[pos].i8CurrTempcontainerPos+1 == this->_structCommPartners[pos].u8RxQueueLength)
-		{
-			this->_structCommPartners[pos].bRxBufferFull = true;
-		}
-		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-		this->_structCommPartners[pos].dataPackagesReceived++;
-		#endif
-
-		xSemaphoreGive(s);
-		return true;
-	}
-
-	bool FRTTransceiver::queueFlush(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandle,int blockTimeTakeSemaphore_Ms,bool bTxQueue)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandle);
-
-		unsigned long timeToWaitSemaphore = this->_checkWaitTime(blockTimeTakeSemaphore_Ms);
-
-		if(pos == -1 || timeToWaitSemaphore == -2)
-		{
-			return false;
-		}
-
-		if(((bTxQueue) && this->_structCommPartners[pos].txQueue == nullptr) || ((!bTxQueue) && this->_structCommPartners[pos].rxQueue == nullptr))
-		{
-			return false;
-		}
-
-		
-		timeToWaitSemaphore = (timeToWaitSemaphore == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitSemaphore));
-
-		xQueueReset(bTxQueue ? this->_structCommPartners[pos].txQueue : this->_structCommPartners[pos].rxQueue);
-
-		
-		return true;
-	}
-
-
-
-	bool FRTTransceiver::delOldestDatabuffForLine(FRTTTaskHandle partner)
-	{
-		return this->delDatabuffForLine(partner,eMultiSenderQueue::eMULTISENDERQ0,true,0);
-	}
-	bool FRTTransceiver::delOldestDatabuffForLine(eMultiSenderQueue multiSenderQueue)
-	{
-		return this->delDatabuffForLine(nullptr,multiSenderQueue,false,0);
-	}
-
-	bool FRTTransceiver::delNewestDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return false;
-		}
-		return this->delDatabuffForLine(partner,multiSenderQueue,bUseTaskHandleVar,this->_structCommPartners[pos].i8CurrTempcontainerPos);
-	}
-
-	bool FRTTransceiver::delDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8PositionInBuffer)
-	{
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1 || !this->_hasDataInterpreters())
-		{
-			return false;
-		}
-
-		if(this->_structCommPartners[pos].bHasBufferedData && u8PositionInBuffer <= this->_structCommPartners[pos].i8CurrTempcontainerPos)
-		{
-			this->_dataDestroyer(this->_structCommPartners[pos].tempContainer[u8PositionInBuffer]);
-			
-			if(this->_structCommPartners[pos].i8CurrTempcontainerPos == 0)
-			{
-				this->_structCommPartners[pos].bHasBufferedData = false;
-
-			}
-			else
-			{
-				this->_rearrangeTempContainerArray(pos,u8PositionInBuffer);
-			}
-			this->_structCommPartners[pos].i8CurrTempcontainerPos--;
-			this->_structCommPartners[pos].bRxBufferFull = false;
-			return true;
-		}
-		return false;
-	}
-
-
-	bool FRTTransceiver::delAllDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */  
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1 || !this->_hasDataInterpreters())
-		{
-			return false;
-		}
-
-		if(this->_structCommPartners[pos].bHasBufferedData)
-		{  
-			for(uint8_t u8I = 0;u8I <= this->_structCommPartners[pos].i8CurrTempcontainerPos;u8I++)
-			{
-				this->_dataDestroyer(this->_structCommPartners[pos].tempContainer[u8I]);
-			}
-			this->_structCommPartners[pos].bHasBufferedData = false;
-			this->_structCommPartners[pos].bRxBufferFull = false;
-			this->_structCommPartners[pos].i8CurrTempcontainerPos = -1;
-			return true;
-		}
-		return false;
-	}
-
-
-	int FRTTransceiver::messagesOnQueue(FRTTTaskHandle partner,bool bCheckTxQueue)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
-
-		if(pos == -1)
-		{
-			return -1;
-		}
-
-		FRTTQueueHandle temp = (bCheckTxQueue ? this->_structCommPartners[pos].txQueue:this->_structCommPartners[pos].rxQueue);
-		if(temp == nullptr)
-		{
-			return -1;
-		}
-
-		return this->_getAmountOfMessages(temp);
-	}
-
-	int FRTTransceiver::messagesOnQueue(eMultiSenderQueue multiSenderQueue)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(nullptr,multiSenderQueue,false);
-
-		if(pos == -1)
-		{
-			return -1;
-		}
-
-		if(this->_structCommPartners[pos].rxQueue == nullptr)
-		{
-			return -1;
-		}
-
-		return this->_getAmountOfMessages(this->_structCommPartners[pos].rxQueue);
-	}
-
-	bool FRTTransceiver::hasDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return false;
-		}
-
-		return this->_structCommPartners[pos].bHasBufferedData;
-	}
-
-
-	int FRTTransceiver::bufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return -1;
-		}
-
-		return (this->_structCommPartners[pos].bHasBufferedData ? this->_structCommPartners[pos].i8CurrTempcontainerPos + 1:0);
-	}
-
-	int FRTTransceiver::bufferedDataInAllBuffers()
-	{
-		if(!this->_bHasValidStruct) return -1;
-
-		int amountOfDataAvail = 0;
-		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
-		{
-			if(this->_structCommPartners[u8I].bHasBufferedData){
-				amountOfDataAvail += this->_structCommPartners[u8I].i8CurrTempcontainerPos + 1;
-			}
-		}
-		return amountOfDataAvail;
-	}
-
-
-	int FRTTransceiver::_getCommStruct(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{
-		if(!this->_bHasValidStruct) return -1;
-
-		if(bUseTaskHandleVar)
-		{
-			if(!partner)
-			{
-				return -1;
-			}
-
-			for(int i = 0; i < this->_u8CurrCommPartners;i++)
-			{
-				if(this->_structCommPartners[i].commPartner == partner)
-				{
-				return i;
-				}
-			}
-			return -1;
-		}
-		else
-		{
-			if(!(static_cast<int8_t>(multiSenderQueue) >= 0 && static_cast<int8_t>(multiSenderQueue) < this->_u8MultiSenderQueues))
-			{
-				return -1;
-			}
-
-			uint8_t counter = 0;
-
-			for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners;u8I++)
-			{
-				if(this->_structCommPartners[u8I].bReadOnlyCommunication)
-				{
-					if(static_cast<int8_t>(multiSenderQueue) == counter)
-					{
-						return u8I;
-					}
-					else
-					{
-						counter++;
-					}
-				}
-			}
-			return -1;
-		}
-	}
-	int FRTTransceiver::_queueExists(FRTTQueueHandle queue,bool bTxQueue)
-	{
-		if(!queue) return -1;
-
-		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
-		{
-			FRTTQueueHandle toCheck = (bTxQueue ? this->_structCommPartners[u8I].txQueue:this->_structCommPartners[u8I].rxQueue);
-			
-			if(toCheck == queue) return 1;
-		}
-
-		return 0;
-	}
-
-	int FRTTransceiver::_semaphoreExists(FRTTSemaphoreHandle smph,bool bTxSemaphore)
-	{
-		if(!smph) return -1;
-
-		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
-		{
-			SemaphoreHandle_t toCheck = (bTxSemaphore ? this->_structCommPartners[u8I].semaphoreTxQueue:this->_structCommPartners[u8I].semaphoreRxQueue);
-			
-			if(toCheck == smph) return 1;
-		}
-
-		return 0;
-	}
-
-	int FRTTransceiver::isDatatypeInBuffer(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8Datatype)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return -1;
-		}
-
-		int counter = 0;
-		if(this->_structCommPartners[pos].bHasBufferedData)
-		{
-			for(uint8_t u8I = 0;u8I <= this->_structCommPartners[pos].i8CurrTempcontainerPos;u8I++)
-			{
-				if(this->_structCommPartners[pos].tempContainer[u8I].u8DataType == u8Datatype)
-				{
-					counter++;
-				}
-			}
-		}
-		
-		return counter;
-	}
-
-	const FRTTTempDataContainer * FRTTransceiver::getNewestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return nullptr;
-		}
-
-		if(this->_structCommPartners[pos].bHasBufferedData)
-		{
-			return (const FRTTTempDataContainer *)&this->_structCommPartners[pos].tempContainer[this->_structCommPartners[pos].i8CurrTempcontainerPos];
-		}
-		return nullptr;
-	}
-
-
-	const FRTTTempDataContainer * FRTTransceiver::getOldestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return nullptr;
-		}
-
-		if(this->_structCommPartners[pos].bHasBufferedData)
-		{
-			return (const FRTTTempDataContainer *)&this->_structCommPartners[pos].tempContainer[0];
-		}
-		return nullptr;
-	}
-
-	const FRTTTempDataContainer * FRTTransceiver::getBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar, 
-																																		uint8_t u8PositionInBuffer)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-		
-		if(pos == -1)
-		{
-			return nullptr;
-		}
-
-		if(this->_structCommPartners[pos].bHasBufferedData && u8PositionInBuffer <= this->_structCommPartners[pos].i8CurrTempcontainerPos)
-		{
-			return (const FRTTTempDataContainer *)&this->_structCommPartners[pos].tempContainer[u8PositionInBuffer];
-		}
-		
-		return nullptr;
-	}
-
-	bool FRTTransceiver::NotifyBasic(FRTTTaskHandle partner)
-	{
-		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
-
-		/* check for bReadOnlyComm..(true) unnecessary since commPartner will be nullptr for readOnlyQueues anyways*/
-		if(pos == -1 || this->_structCommPartners[pos].commPartner == nullptr || this->_structCommPartners[pos].bReadOnlyCommunication == true)
-		{
-
-			#ifdef LOG_INFO
-			printf("You are not to notify your partner \nOne of the following things happened:\n"
-				"-[no communication struct available]\n"
-				"-[communication partner address == nullptr AND/OR communication line is a multiSenderQueue]\n");
-			#endif
-			return false;
-		}
-
-		/**
-		 *	From here on we will be fine UNLESS the user provided an invalid FRTTTaskhandle! 
-		 */
-		
-		xTaskNotifyGive(this->_structCommPartners[pos].commPartner);	/* WILL ALWAYS RETURN pdPASS*/
-
-		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-		this->_tasksNotified++;
-		#endif
-		
-		return true;
-	}
-
-	bool FRTTransceiver::NotifyExtended(FRTTTaskHandle partner,eFRTTNotifyActions action,uint32_t u32NotificationMask)
-	{
-		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
-
-		/* check for bReadOnlyComm..(true) unnecessary since commPartner will be nullptr for readOnlyQueues anyways*/
-		if(pos == -1 || this->_structCommPartners[pos].commPartner == nullptr || this->_structCommPartners[pos].bReadOnlyCommunication == true)
-		{
-
-			#ifdef LOG_INFO
-			printf("You are not to notify your partner \nOne of the following things happened:\n"
-				"-[no communication struct available]\n"
-				"-[communication partner address == nullptr AND/OR communication line is a multiSenderQueue]\n");
-			#endif
-			return false;
-		}
-
-		if(!(action >= eFRTTNotifyActions::e_NoAction && action <= eFRTTNotifyActions::e_SetValueWithoutOverwrite))
-		{
-			#ifdef LOG_INFO
-			printf("You are not to notify your partner \nOne of the following things happened:\n"
-					"-[eFRTTNotifyAction is invalid in this case. Possible interval: [e_NoAction;e_SetValueWithoutOverwrite]]\n");
-			#endif
-			return false;
-		}
-
-		/**
-		 *	From here on we will be fine UNLESS the user provided an invalid FRTTTaskhandle! 
-		 */
-
-
-		/*
-
-				---> FREERTOS ENUM
-
-			typedef enum
-			{
-				eNoAction = 0,                
-				eSetBits,                     
-				eIncrement,                   
-				eSetValueWithOverwrite,       
-				eSetValueWithoutOverwrite     
-			} eNotifyAction;
-
-		*/
-
-		eNotifyAction freeRtosAction;//= (eNotifyAction)(static_cast<uint8_t>(action) - 2);
-
-		switch(action)
-		{
-			case eFRTTNotifyActions::e_NoAction:
-				freeRtosAction = eNoAction;
-				break;
-			case eFRTTNotifyActions::e_SetBits:
-				freeRtosAction = eSetBits;
-				break;
-			case eFRTTNotifyActions::e_Increment:
-				freeRtosAction = eIncrement;
-				break;
-			case eFRTTNotifyActions::e_SetValueWithOverwrite:
-				freeRtosAction = eSetValueWithOverwrite;
-				break;
-			case eFRTTNotifyActions::e_SetValueWithoutOverwrite:
-				freeRtosAction = eSetValueWithoutOverwrite;
-				break;
-			case eFRTTNotifyActions::e_CLEARCOUNTONEXIT:
-			case eFRTTNotifyActions::e_DECREMENTCOUNTONEXIT:
-			default:
-				/* Wont ever come to this situation because we check it in the if() above (e_CLEARCOUNTON***** not allowed here). 
-														Just so that the c++ compiler for the esp8266 doesnt throw -Werror=switch since we define more enumerators than freertos..!*/
-				freeRtosAction = eNoAction; /* randomly chosen */
-				break;
-		}
-		FRTTBaseType retVal =  xTaskNotify(partner,u32NotificationMask,freeRtosAction);
-
-		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-		if(retVal == pdTRUE) this->_tasksNotified++;
-		#endif
-
-		return (retVal == pdFAIL) ? false:true;
-	}
-
-	FRTTransceiver &  FRTTransceiver::NotifyReceiveBasic(eFRTTNotifyActions action,int blockTimeReceive_Ms)
-	{
-
-		blockTimeReceive_Ms = this->_checkWaitTime(blockTimeReceive_Ms);
-		
-		if(blockTimeReceive_Ms == -2 || !(action == eFRTTNotifyActions::e_CLEARCOUNTONEXIT || action == eFRTTNotifyActions::e_DECREMENTCOUNTONEXIT))
-		{  
-			return *this;
-		}
-
-		unsigned long timeToWaitReceive = (blockTimeReceive_Ms == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(blockTimeReceive_Ms));
-		
-		FRTTBaseType clearCount = (action == eFRTTNotifyActions::e_CLEARCOUNTONEXIT ? pdTRUE:pdFALSE);
-
-		uint32_t u32TempNotificationVal = ulTaskNotifyTake(clearCount,(TickType_t)timeToWaitReceive);
-		
-		/* 
-		   FreeRTOS lets the task wait in the blocked state until the notification value != 0 
-		   So value > 0 == notfication received.
-		*/
-
-		#ifdef LOG_INFO
-		if(!u32TempNotificationVal) printf("NotifyReceiveBasic: Nothing received!\n");
-		#endif
-
-		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-		if(u32TempNotificationVal != 0) this->_notificationsReceived++;
-		#endif
-
-		this->_bHasNotification = (u32TempNotificationVal != 0 ? true:false);
-
-		this->_u32NotificationValue = u32TempNotificationVal;
-		return *this;
-	}
-
-	FRTTransceiver & FRTTransceiver::NotifyReceiveExtended(uint32_t u32ClearOnEntryMask,uint32_t u32ClearOnExitMask,int blockTimeReceive_Ms)
-	{
-		int timeToWaitReceive = this->_checkWaitTime(blockTimeReceive_Ms);
-
-		if(timeToWaitReceive == -2)
-		{
-			return *this;
-		}
-
-		timeToWaitReceive = (timeToWaitReceive == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitReceive));
-
-		FRTTBaseType retVal = xTaskNotifyWait(u32ClearOnEntryMask,u32ClearOnExitMask,&this->_u32NotificationValue,timeToWaitReceive);
-
-		if(retVal == pdTRUE)
-		{	
-			this->_bHasNotification = true;
-			#ifdef LOG_INFO
-			printf("Notfication received\n");
-			#endif
-
-			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-			this->_notificationsReceived++;
-			#endif
-		}
-		else
-		{	
-			this->_bHasNotification = false;
-			#ifdef LOG_INFO
-			printf("Nothing received\n");
-			#endif
-		}
-
-		return *this;
-	}
-
-	uint32_t FRTTransceiver::getNotificationVal()
-	{
-		return this->_u32NotificationValue;
-	}
-
-	void FRTTransceiver::clearNotificationVal()
-	{
-		this->_u32NotificationValue = 0;
-	}
-
-	bool FRTTransceiver::hasNotification()
-	{
-		return this->_bHasNotification;
-	}
-
-	void FRTTransceiver::addDataAllocateCallback(void(*fP)(const FRTTDataContainerOnQueue &,FRTTTempDataContainer &))
-	{
-		this->_dataAllocator = fP;
-	}
-
-
-	void FRTTransceiver::addDataFreeCallback(void (*fP)(FRTTTempDataContainer &))
-	{
-		this->_dataDestroyer = fP;
-	}
-
-
-	string FRTTransceiver::_getPartnersName(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
-	{  
-		/* _getCommStruct checks if a valid communication struct is available */
-		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
-
-		if(pos == -1)
-		{
-			return string("");
-		}
-
-		return this->_structCommPartners[pos].partnersName;
-	}
-
-	int FRTTransceiver::_getAmountOfQueues(bool bTxQueue)
-	{
-		if(!this->_bHasValidStruct) return -1;
-
-		int amount = 0;
-		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
-		{
-			if(bTxQueue)
-			{
-				if(!(this->_structCommPartners[u8I].txQueue == nullptr)) amount++;
-			}
-			else
-			{
-				if(!(this->_structCommPartners[u8I].rxQueue == nullptr)) amount++;
-			}
-		}
-		return amount;
-	}
-
-	int FRTTransceiver::_checkWaitTime(int time_ms)
-	{
-		/* WAITMAX is defined as -1, If timeMs element of [-infinite;0[, than display error! */
-		if(time_ms < FRTTRANSCEIVER_WAITMAX || (time_ms > FRTTRANSCEIVER_WAITMAX && time_ms < 0))
-		{
-			#ifdef LOG_INFO
-			printf("Nothing sent [invalid wait time specified]\n");
-			#endif
-			return -2;
-		}
-		return time_ms;
-	}
-
-	bool FRTTransceiver::_checkValidQueueLength(uint8_t u8QueueLength)
-	{
-		return !(u8QueueLength <= 0 || u8QueueLength > FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE);
-	}
-
-	void FRTTransceiver::_rearrangeTempContainerArray(uint8_t u8CommStructPos,uint8_t u8PosRemoved)
-	{
-		for(uint8_t u8I = u8PosRemoved + 1; u8I <= this->_structCommPartners[u8CommStructPos].i8CurrTempcontainerPos;u8I++)
-		{
-			this->_structCommPartners[u8CommStructPos].tempContainer[u8I-1] = this->_structCommPartners[u8CommStructPos].tempContainer[u8I];
-		}
-	}
-
-	#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-
-	void FRTTransceiver::printCommunicationsSummary()
-	{
-		if(!this->_bHasValidStruct) return;
-
-		/* General Infos */
-
-		auto runtime = std::chrono::high_resolution_clock::now() - this->_runtimeStart;
-		std::chrono::minutes min = std::chrono::duration_cast<std::chrono::minutes>(runtime);
-
-		printf("General Infos\n\n");
-		printf("\tOwner address            \t\t%p\n",this->_ownerAddress == nullptr ? FRTTRANSCEIVER_UNKNOWNADDRESS : this->_ownerAddress);
-		printf("\tCommunicationpartner     \t\t(%d out of %d)\n",this->_u8CurrCommPartners,this->_u8MaxPartners);
-		printf("\t\t- - - > (%d of those read only)\n",this->_u8MultiSenderQueues);
-		printf("\tMax partners             \t\t%d\n",this->_u8MaxPartners);
-		printf("\tTX-QUEUE CONNECTIONS	   \t\t%d\n",this->_getAmountOfQueues(true));
-		printf("\tRX-QUEUES CONNECTIONS	   \t\t%d\n",this->_getAmountOfQueues(false));
-		printf("\tData callbacks available \t\t%s\n",this->_hasDataInterpreters() ? "yes":"no");
-		printf("\tBroadcasts made          \t\t%d\n",this->_broadcastCount);
-		printf("\tNotifications received   \t\t%d\n",this->_notificationsReceived);
-		printf("\tNotifications sent   	   \t\t%d\n",this->_tasksNotified);
-		printf("\tLast notification value  \t\t%ld\n\n",(long int)this->getNotificationVal());
-		if(min.count() > 0)
-		{
-			printf("\tRunning for [%ld min]\n\n",(long int)min.count());
-		}
-		else
-		{	
-			std::chrono::seconds sec = std::chrono::duration_cast<std::chrono::seconds>(runtime);
-			printf("\tRunning for [%ld sec]\n\n",(long int)sec.count());
-		}
-		/* Communication partners */
-		
-		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners;u8I++)
-		{
-			printf("Line [%d]\n",u8I+1);
-			printf("\tName                    \t\t%s\n",this->_structCommPartners[u8I].partnersName.c_str());
-			printf("\tAddress                 \t\t%p\n",this->_structCommPartners[u8I].commPartner == nullptr ? FRTTRANSCEIVER_UNKNOWNADDRESS : this->_structCommPartners[u8I].commPartner);
-
-			if(!this->_structCommPartners[u8I].bReadOnlyCommunication)
-			{
-				printf("\tComm-Type               \t\t%s\n",this->_ownerAddress == this->_structCommPartners[u8I].commPartner ? FRTTRANSCEIVER_COMMTYPE3:FRTTRANSCEIVER_COMMTYPE1);
-			}
-			else
-			{
-				printf("\tComm-Type               \t\t%s\n",FRTTRANSCEIVER_COMMTYPE2);
-			}
-			printf("\tTX-LINE                 \t\t%s\n",this->_structCommPartners[u8I].txQueue == nullptr ? "OFF":"ON");
-			printf("\t\tLength                %d\n",this->_structCommPartners[u8I].u8TxQueueLength);
-			printf("\tRX-LINE                 \t\t%s\n",this->_structCommPartners[u8I].rxQueue == nullptr ? "OFF":"ON");
-			printf("\t\tLength                %d\n",this->_structCommPartners[u8I].u8RxQueueLength);
-			printf("\tPackages sent           \t\t%d\n",this->_structCommPartners[u8I].dataPackagesSent);
-			printf("\tPackages received       \t\t%d\n",this->_structCommPartners[u8I].dataPackagesReceived);
-			printf("\tHas buffered data       \t\t%s\n",this->_structCommPartners[u8I].bHasBufferedData ? "YES":"NO");
-		}
-		printf("\n\n");
-	}
-	#endif
-
-	FRTTransceiver::FRTTransceiver(FRTTTaskHandle ownerAddress, uint8_t u8MaxPartners)//: _bDelete(true), _bHasValidStruct(true)
-	{  
-		/* Can be null. Receivers wont know who you are then....*/
-		this->_ownerAddress = ownerAddress;
-		
-		u8MaxPartners = (u8MaxPartners == 0 ? 1:u8MaxPartners);
-
-		this->_u8MaxPartners = u8MaxPartners;
-		this->_structCommPartners = new (std::nothrow) struct FRTTCommunicationPartner[u8MaxPartners];
-
-		if(this->_structCommPartners != nullptr)
-		{
-			this->_bDelete = true;
-			this->_bHasValidStruct = true;
-
-			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
-			this->_runtimeStart = std::chrono::high_resolution_clock::now();
-			#endif
-		}
-	}
-
-	FRTTransceiver::~FRTTransceiver()
-	{
-		if(this->_bDelete)
-		{
-			delete[] this->_structCommPartners;
-		}
-	}
-}
+#ifndef FRTTRANSCEIVER_CPP
+#define FRTTRANSCEIVER_CPP
+
+/*!
+ * \file       	FRTTransceiver.cpp
+ * \brief      	Transceiver class methods implementation
+ * \author     	Xhemail Ramabaja (x.ramabaja@outlook.de)
+ * \version 	   v1.2.0
+ * \copyright  	Copyright 2022 Xhemail Ramabaja
+ */
+
+#include "../include/FRTTransceiver.h"
+#include <cstdio>
+#include <cstring>
+
+//#define LOG_INFO
+namespace FRTT {
+	#if defined(FRTTRANSCEIVER_ANALYTICS_ENABLE) || defined(FRTTRANSCEIVER_LATENCY_ENABLE)
+	/* Only the owner task writes a counter, other tasks just sample it. A relaxed load + store is enough (no read-modify-write needed) */
+	static inline void FRTTCountUp(std::atomic<uint32_t> & counter,uint32_t u32Amount = 1)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + u32Amount,std::memory_order_relaxed);
+	}
+	#endif
+
+   #if defined(ESP32) || defined (CONFIG_IDF_TARGET_ESP32)
+         void FRTTCreateTask(FRTTTaskFunction taskCode,
+                           const char * const taskName,
+                           const uint32_t stackbytes,
+                           void * const taskParameter,
+                           FRTTBaseType taskPriority,
+                           FRTTTaskHandle * taskHandle,
+                           const FRTTBaseType core)
+         {
+            if(taskCode == nullptr) return;
+
+            if(xTaskCreatePinnedToCore(taskCode,(taskName == nullptr || taskName[0] == '\0') ? "def-task-name" : taskName,stackbytes,taskParameter,taskPriority,taskHandle,core) != pdPASS)
+            {
+               #ifdef LOG_INFO
+               printf("Task creation failed.\n");
+               #endif
+            }
+         }
+	#elif defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP8266)
+         void FRTTCreateTask(FRTTTaskFunction taskCode,
+                           const char * const taskName,
+                           const uint16_t stackbytes,
+                           void * const taskParameter,
+                           FRTTBaseType taskPriority,
+                           FRTTTaskHandle * taskHandle)
+         {
+            if(taskCode == nullptr) return;
+            
+            if(xTaskCreate(taskCode,(taskName == nullptr || taskName[0] == '\0') ? "def-task-name" : taskName,stackbytes,taskParameter,taskPriority,taskHandle) != pdPASS)
+            {
+               #ifdef LOG_INFO
+               printf("Task creation failed.\n");
+               #endif
+            }
+		   }               
+      
+    #endif
+
+
+	FRTTQueueHandle FRTTCreateQueue(FRTTBaseType lengthOfQueue)
+	{
+
+		if(lengthOfQueue <= 0 || lengthOfQueue > FRTTRANSCEIVER_MAXLINEDEPTH)
+		{
+			#ifdef LOG_INFO
+			printf("Supplied length of the queue is not valid. NULL returned [Either too small or too big]\n");
+			#endif
+			return nullptr;
+		}
+
+		FRTTQueueHandle queue = xQueueCreate(lengthOfQueue,sizeof(struct FRTTDataContainerOnQueue));
+
+		if(!queue)
+		{
+			#ifdef LOG_INFO
+			printf("Queue cannot be created [Insufficient heap memory]\n");
+			#endif
+		}
+		else
+		{
+			#ifdef LOG_INFO
+			printf("Queue successfully created. Queue handle returned\n");
+			#endif
+		}
+		return queue;
+	}
+
+
+	FRTTSemaphoreHandle FRTTCreateSemaphore()
+	{
+		FRTTSemaphoreHandle semaphore = xSemaphoreCreateMutex();
+
+		if(!semaphore)
+		{
+			#ifdef LOG_INFO
+			printf("Semaphore cannot be created [Insufficient heap memory]\n");
+			#endif
+		}
+		else
+		{
+			#ifdef LOG_INFO
+			printf("Semaphore successfully created. Semaphore handle returned\n");
+			#endif
+		}
+		return semaphore;
+	}
+
+	FRTTSpscRingHandle FRTTCreateSpscRing(FRTTBaseType lengthOfRing)
+	{
+		if(lengthOfRing <= 0 || lengthOfRing > FRTTRANSCEIVER_MAXLINEDEPTH)
+		{
+			#ifdef LOG_INFO
+			printf("Supplied length of the ring is not valid. NULL returned [Either too small or too big]\n");
+			#endif
+			return nullptr;
+		}
+
+		FRTTSpscRingHandle ring = new (std::nothrow) struct FRTTSpscRing;
+
+		if(ring)
+		{
+			/* One slot more than the length, it always stays empty */
+			ring->slots = new (std::nothrow) struct FRTTDataContainerOnQueue[lengthOfRing + 1];
+			ring->dataAvailable = xSemaphoreCreateBinary();
+			ring->spaceAvailable = xSemaphoreCreateBinary();
+			bool bCreated = ring->slots && ring->dataAvailable && ring->spaceAvailable;
+
+			#if (configUSE_QUEUE_SETS == 1)
+			ring->queueSetSignal = xSemaphoreCreateBinary();
+			bCreated = bCreated && ring->queueSetSignal;
+			#endif
+
+			if(!bCreated)
+			{
+				if(ring->dataAvailable) vSemaphoreDelete(ring->dataAvailable);
+				if(ring->spaceAvailable) vSemaphoreDelete(ring->spaceAvailable);
+				#if (configUSE_QUEUE_SETS == 1)
+				if(ring->queueSetSignal) vSemaphoreDelete(ring->queueSetSignal);
+				#endif
+				delete[] ring->slots;
+				delete ring;
+				ring = nullptr;
+			}
+		}
+
+		if(!ring)
+		{
+			#ifdef LOG_INFO
+			printf("Ring cannot be created [Insufficient heap memory]\n");
+			#endif
+			return nullptr;
+		}
+
+		ring->u16Size = lengthOfRing + 1;
+
+		#ifdef LOG_INFO
+		printf("Ring successfully created. Ring handle returned\n");
+		#endif
+		return ring;
+	}
+
+	void FRTTDeleteSpscRing(FRTTSpscRingHandle ring)
+	{
+		if(!ring) return;
+
+		vSemaphoreDelete(ring->dataAvailable);
+		vSemaphoreDelete(ring->spaceAvailable);
+		#if (configUSE_QUEUE_SETS == 1)
+		vSemaphoreDelete(ring->queueSetSignal);
+		#endif
+		delete[] ring->slots;
+		delete ring;
+	}
+
+	#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	FRTTQueueHandle FRTTCreateQueueStatic(FRTTBaseType lengthOfQueue,uint8_t * storage,StaticQueue_t * queueBuffer)
+	{
+		if(lengthOfQueue <= 0 || lengthOfQueue > FRTTRANSCEIVER_MAXLINEDEPTH || storage == nullptr || queueBuffer == nullptr)
+		{
+			#ifdef LOG_INFO
+			printf("Supplied length or memory of the queue is not valid. NULL returned\n");
+			#endif
+			return nullptr;
+		}
+
+		return xQueueCreateStatic(lengthOfQueue,sizeof(struct FRTTDataContainerOnQueue),storage,queueBuffer);
+	}
+
+	FRTTSemaphoreHandle FRTTCreateSemaphoreStatic(FRTTStaticSemaphore & storage)
+	{
+		return xSemaphoreCreateMutexStatic(&storage);
+	}
+
+	#if defined(ESP32) || defined (CONFIG_IDF_TARGET_ESP32)
+	bool FRTTCreateTaskStatic(FRTTTaskFunction taskCode,
+							  const char * const taskName,
+							  StackType_t * stack,
+							  const uint32_t stackDepth,
+							  void * const taskParameter,
+							  FRTTBaseType taskPriority,
+							  StaticTask_t * taskBuffer,
+							  FRTTTaskHandle * taskHandle,
+							  const FRTTBaseType core)
+	{
+		if(taskCode == nullptr || stack == nullptr || taskBuffer == nullptr) return false;
+
+		FRTTTaskHandle task = xTaskCreateStaticPinnedToCore(taskCode,(taskName == nullptr || taskName[0] == '\0') ? "def-task-name" : taskName,stackDepth,taskParameter,taskPriority,stack,taskBuffer,core);
+
+		if(taskHandle) *taskHandle = task;
+		return task != nullptr;
+	}
+	#elif defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP8266)
+	bool FRTTCreateTaskStatic(FRTTTaskFunction taskCode,
+							  const char * const taskName,
+							  StackType_t * stack,
+							  const uint32_t stackDepth,
+							  void * const taskParameter,
+							  FRTTBaseType taskPriority,
+							  StaticTask_t * taskBuffer,
+							  FRTTTaskHandle * taskHandle)
+	{
+		if(taskCode == nullptr || stack == nullptr || taskBuffer == nullptr) return false;
+
+		FRTTTaskHandle task = xTaskCreateStatic(taskCode,(taskName == nullptr || taskName[0] == '\0') ? "def-task-name" : taskName,stackDepth,taskParameter,taskPriority,stack,taskBuffer);
+
+		if(taskHandle) *taskHandle = task;
+		return task != nullptr;
+	}
+	#endif
+	#endif
+
+	#if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+	static_assert(FRTTRANSCEIVER_SENDERIDS > 0 && FRTTRANSCEIVER_SENDERIDS <= 255,"FRTTRANSCEIVER_SENDERIDS must be in [1;255]");
+
+	/* Id n belongs to _senderRegistry[n-1]. Entries are written once (before the amount is published) and never change */
+	static FRTTTaskHandle _senderRegistry[FRTTRANSCEIVER_SENDERIDS];
+	static std::atomic<uint8_t> _u8SenderIds {0};
+
+	uint8_t FRTTSenderId(FRTTTaskHandle task)
+	{
+		if(!task) return 0;
+
+		uint8_t u8SenderId = 0;
+
+		/* Registering is rare (once per object), the scheduler is suspended so that two tasks can not take the same id */
+		vTaskSuspendAll();
+		uint8_t u8Ids = _u8SenderIds.load(std::memory_order_relaxed);
+
+		for(uint8_t u8I = 0;u8I < u8Ids;u8I++)
+		{
+			if(_senderRegistry[u8I] == task)
+			{
+				u8SenderId = u8I + 1;
+				break;
+			}
+		}
+
+		if(u8SenderId == 0 && u8Ids < FRTTRANSCEIVER_SENDERIDS)
+		{
+			_senderRegistry[u8Ids] = task;
+			_u8SenderIds.store(u8Ids + 1,std::memory_order_release);
+			u8SenderId = u8Ids + 1;
+		}
+		xTaskResumeAll();
+
+		if(u8SenderId == 0)
+		{
+			#ifdef LOG_INFO
+			printf("No sender id left [increase FRTTRANSCEIVER_SENDERIDS]\n");
+			#endif
+		}
+		return u8SenderId;
+	}
+
+	FRTTTaskHandle FRTTSenderAddress(uint8_t u8SenderId)
+	{
+		if(u8SenderId == 0 || u8SenderId > _u8SenderIds.load(std::memory_order_acquire))
+		{
+			return nullptr;
+		}
+		return _senderRegistry[u8SenderId - 1];
+	}
+	#endif
+
+	void FRTTransceiver::_setSender(FRTTDataContainerOnQueue & container) const
+	{
+		#if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+		container.u8SenderId = this->_u8SenderId;
+		#else
+		container.senderAddress = this->_ownerAddress;
+		#endif
+	}
+		
+	bool FRTTransceiver::_checkForMessages(FRTTQueueHandle txQueue)
+	{
+		if(txQueue)
+		{
+			return uxQueueMessagesWaiting(txQueue) > 0 ? true:false;
+		}
+
+		return false;
+	}
+
+
+	int FRTTransceiver::_getAmountOfMessages(FRTTQueueHandle queue)
+	{
+		if(queue)
+		{
+			return uxQueueMessagesWaiting(queue);
+		}
+		return -1;
+	}
+
+	int FRTTransceiver::_getAmountOfMessages(FRTTSpscRingHandle ring)
+	{
+		if(ring)
+		{
+			uint32_t u32Head = ring->u32Head.load(std::memory_order_acquire);
+			uint32_t u32Tail = ring->u32Tail.load(std::memory_order_acquire);
+
+			return (u32Head + ring->u16Size - u32Tail) % ring->u16Size;
+		}
+		return -1;
+	}
+
+	bool FRTTransceiver::_hasDataInterpreters()
+	{
+		return (this->_dataAllocator && this->_dataDestroyer) ? true:false;
+	}
+
+	bool FRTTransceiver::_canBufferData(uint8_t u8CommStructPos)
+	{
+		/* The allocate callback is not used if the receiver takes over the senders data */
+		return this->_dataDestroyer && (this->_dataAllocator || this->_structCommPartners[u8CommStructPos].bTakeOwnership);
+	}
+
+	void FRTTransceiver::_releaseSlot(uint8_t u8CommStructPos,uint8_t u8PositionInBuffer)
+	{
+		uint8_t u8Index = this->_bufferIndex(u8CommStructPos,u8PositionInBuffer);
+		FRTTSharedPayload * shared = this->_structCommPartners[u8CommStructPos].sharedPayload[u8Index];
+
+		#if (FRTTRANSCEIVER_INDEXEDDATATYPES > 0)
+		/* Read before the free callback runs, it may clear the entry */
+		uint8_t u8Datatype = this->_structCommPartners[u8CommStructPos].tempContainer[u8Index].u8DataType;
+		if(u8Datatype < FRTTRANSCEIVER_INDEXEDDATATYPES)
+		{
+			this->_structCommPartners[u8CommStructPos].au8DatatypeCount[u8Datatype]--;
+		}
+		#endif
+
+		#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+		this->_recordLatency(this->_structCommPartners[u8CommStructPos].latency.untilRelease,this->_structCommPartners[u8CommStructPos].tempContainer[u8Index].u32EnqueueTime);
+		#endif
+
+		/* A shared payload is only a view, its owner is the sender */
+		if(shared)
+		{
+			this->_structCommPartners[u8CommStructPos].sharedPayload[u8Index] = nullptr;
+			this->_releaseShared(shared);
+			return;
+		}
+
+		/* Inline bytes were never allocated */
+		if(this->_structCommPartners[u8CommStructPos].tempContainer[u8Index].u8Flags & FRTTRANSCEIVER_FLAG_INLINEPAYLOAD)
+		{
+			return;
+		}
+
+		this->_dataDestroyer(this->_structCommPartners[u8CommStructPos].tempContainer[u8Index]);
+	}
+
+	void FRTTransceiver::_releaseShared(FRTTSharedPayload * shared)
+	{
+		if(shared->u32References.fetch_sub(1,std::memory_order_acq_rel) == 1)
+		{
+			shared->freeCallback(shared->payload);
+			delete shared;
+		}
+	}
+
+	void FRTTransceiver::_releaseDiscarded(const FRTTDataContainerOnQueue & dataContainer,bool bTakeOwnership)
+	{
+		if(dataContainer.u8Flags & FRTTRANSCEIVER_FLAG_SHAREDPAYLOAD)
+		{
+			this->_releaseShared((FRTTSharedPayload *)dataContainer.data);
+		}
+		/* The receiver owns the senders data, nobody else would free it */
+		else if(bTakeOwnership && !(dataContainer.u8Flags & FRTTRANSCEIVER_FLAG_INLINEPAYLOAD) && this->_dataDestroyer)
+		{
+			FRTTTempDataContainer owned = dataContainer;
+			this->_dataDestroyer(owned);
+		}
+	}
+
+	void FRTTransceiver::_clearSharedMirror(FRTTDataContainerOnQueue & mirror)
+	{
+		/* The last receiver frees the header, the mirror must not keep its address */
+		if(mirror.u8Flags & FRTTRANSCEIVER_FLAG_SHAREDPAYLOAD)
+		{
+			mirror.data = nullptr;
+		}
+	}
+
+	#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+	void FRTTransceiver::_recordLatency(FRTTLatencyCounters & histogram,uint32_t u32EnqueueTime)
+	{
+		/* unsigned arithmetic: a wrap-around of the timestamp in between does not matter */
+		uint32_t u32Latency = FRTTRANSCEIVER_TIMESTAMP() - u32EnqueueTime;
+		uint8_t u8Bucket = (u32Latency < 2 ? 0 : 31 - __builtin_clz(u32Latency));
+
+		if(u8Bucket >= FRTTRANSCEIVER_LATENCYBUCKETS)
+		{
+			u8Bucket = FRTTRANSCEIVER_LATENCYBUCKETS - 1;
+		}
+
+		FRTTCountUp(histogram.au32Buckets[u8Bucket]);
+		FRTTCountUp(histogram.u32Samples);
+
+		if(u32Latency > histogram.u32Max.load(std::memory_order_relaxed))
+		{
+			histogram.u32Max.store(u32Latency,std::memory_order_relaxed);
+		}
+	}
+
+	void FRTTransceiver::_copyLatency(const FRTTLatencyCounters & counters,FRTTLatencyHistogram & histogram)
+	{
+		for(uint8_t u8I = 0;u8I < FRTTRANSCEIVER_LATENCYBUCKETS;u8I++)
+		{
+			histogram.au32Buckets[u8I] = counters.au32Buckets[u8I].load(std::memory_order_relaxed);
+		}
+		histogram.u32Samples = counters.u32Samples.load(std::memory_order_relaxed);
+		histogram.u32Max = counters.u32Max.load(std::memory_order_relaxed);
+	}
+
+	void FRTTransceiver::_clearLatency(FRTTLatencyCounters & counters)
+	{
+		for(std::atomic<uint32_t> & bucket : counters.au32Buckets)
+		{
+			bucket.store(0,std::memory_order_relaxed);
+		}
+		counters.u32Samples.store(0,std::memory_order_relaxed);
+		counters.u32Max.store(0,std::memory_order_relaxed);
+	}
+	#endif
+
+	bool FRTTransceiver::addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,
+					uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
+					FRTTQueueHandle queueTX,uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,const char * partnersName)
+	{
+		return this->_addCommPartner(partner,queueRX,u8QueueLengthRx,semaphoreRx,queueTX,u8QueueLengthTx,semaphoreTx,partnersName,
+										nullptr,nullptr,nullptr,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE);
+	}
+
+	bool FRTTransceiver::_addCommPartner(FRTTTaskHandle partner,FRTTQueueHandle queueRX,
+					uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
+					FRTTQueueHandle queueTX,uint8_t u8QueueLengthTx,FRTTSemaphoreHandle semaphoreTx,const char * partnersName,
+					FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth)
+	{
+
+		if(!this->_bHasValidStruct || this->_u8CurrCommPartners + 1 > this->_u8MaxPartners)
+		{
+			return false;
+		}
+
+		/* Handle should not be nullptr AND no communication structure should be linked to the new partner */
+		if(partner != nullptr && this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true) == -1)
+		{
+			this->_structCommPartners[_u8CurrCommPartners].commPartner = partner;
+		}
+		else
+		{
+			return false;
+		}
+
+
+		if(queueRX != nullptr)
+		{	
+			if(this->_queueExists(queueRX,false) != 1 && this->_queueExists(queueRX,true) != 1)
+			{	
+				if(semaphoreRx == nullptr || this->_semaphoreExists(semaphoreRx,true) == 1 	|| this->_semaphoreExists(semaphoreRx,false) == 1
+																							|| (this->_checkValidQueueLength(u8QueueLengthRx,u8Depth) == false))
+				{	
+					/* It is possible to establish a connection without a queue (task-notification), 
+					but since the queue was valid, we shouldnt procceed further because the user clearly wanted to add a queue */
+					#ifdef LOG_INFO
+					printf("Queue is valid but the semaphore OR queuelength is invalid!\n");
+					#endif
+					return false;
+				}
+				this->_structCommPartners[_u8CurrCommPartners].rxQueue = queueRX;
+				this->_structCommPartners[_u8CurrCommPartners].u8RxQueueLength = u8QueueLengthRx;
+				this->_structCommPartners[_u8CurrCommPartners].semaphoreRxQueue = semaphoreRx;
+			}
+			else
+			{	
+				/* It is possible to establish a connection without a queue (task-notification), 
+					but since the queue was already added to a comm-line, we shouldnt procceed further because the user clearly wanted to add a queue */
+				#ifdef LOG_INFO
+				printf("Queue already exists\n");
+				#endif
+				return false;
+			}
+		}
+
+
+		if(queueTX != nullptr)
+		{	
+			if(this->_queueExists(queueTX,true) != 1 && this->_queueExists(queueTX,false) != 1)
+			{
+				if(semaphoreTx == nullptr || this->_semaphoreExists(semaphoreTx,true) == 1 	|| this->_semaphoreExists(semaphoreTx,false) == 1
+																							|| (this->_checkValidQueueLength(u8QueueLengthTx,u8Depth) == false))
+				{	
+					/* It is possible to establish a connection without a queue (task-notification), 
+					but since the queue was valid, we shouldnt procceed further because the user clearly wanted to add a queue */
+					#ifdef LOG_INFO
+					printf("Queue is valid but the semaphore OR queuelength is invalid!\n");
+					#endif
+					return false;
+				}
+				this->_structCommPartners[_u8CurrCommPartners].txQueue = queueTX;
+				this->_structCommPartners[_u8CurrCommPartners].u8TxQueueLength = u8QueueLengthTx;
+				this->_structCommPartners[_u8CurrCommPartners].semaphoreTxQueue = semaphoreTx;
+			}
+			else
+			{	
+				/* It is possible to establish a connection without a queue (task-notification), 
+					but since the queue was already added to a comm-line, we shouldnt procceed further because the user clearly wanted to add a queue */
+				#ifdef LOG_INFO
+				printf("Queue already exists\n");
+				#endif
+				return false;
+			}
+		}
+		
+		this->_setPartnersName(this->_u8CurrCommPartners,partnersName,FRTTRANSCEIVER_DEFAULTPARTNERNAME);
+
+		this->_assignStorage(this->_u8CurrCommPartners,txLineStorage,tempStorage,sharedStorage,u8Depth);
+		this->_addToPartnerIndex(partner,this->_u8CurrCommPartners);
+		this->_structCommPartners[_u8CurrCommPartners].u8Generation++;
+		this->_u8CurrCommPartners++;
+
+		#if (configUSE_QUEUE_SETS == 1)
+		this->_bRxQueueSetStale = (this->_rxQueueSet != nullptr && queueRX != nullptr) || this->_bRxQueueSetStale;
+		#endif
+		return true;
+	}
+
+	bool FRTTransceiver::addCommPartner(FRTTTaskHandle partner,FRTTSpscRingHandle ringRX,FRTTSpscRingHandle ringTX,const char * partnersName)
+	{
+		return this->_addCommPartner(partner,ringRX,ringTX,partnersName,nullptr,nullptr,nullptr,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE);
+	}
+
+	bool FRTTransceiver::_addCommPartner(FRTTTaskHandle partner,FRTTSpscRingHandle ringRX,FRTTSpscRingHandle ringTX,const char * partnersName,
+					FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth)
+	{
+		if(!this->_bHasValidStruct || this->_u8CurrCommPartners + 1 > this->_u8MaxPartners)
+		{
+			return false;
+		}
+
+		/* Handle should not be nullptr AND no communication structure should be linked to the new partner */
+		if(partner == nullptr || this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true) != -1)
+		{
+			return false;
+		}
+
+		/* A ring has exactly one reader and one writer, so it can only belong to one communication line (ECHO: same ring for rx & tx works) */
+		if((ringRX != nullptr && (this->_ringExists(ringRX,false) == 1 || this->_ringExists(ringRX,true) == 1 || this->_checkValidQueueLength(ringRX->u16Size - 1,u8Depth) == false)) ||
+		   (ringTX != nullptr && (this->_ringExists(ringTX,true) == 1 || this->_ringExists(ringTX,false) == 1 || this->_checkValidQueueLength(ringTX->u16Size - 1,u8Depth) == false)))
+		{
+			#ifdef LOG_INFO
+			printf("Ring already exists OR ring is invalid\n");
+			#endif
+			return false;
+		}
+
+		this->_structCommPartners[_u8CurrCommPartners].commPartner = partner;
+
+		if(ringRX != nullptr)
+		{
+			this->_structCommPartners[_u8CurrCommPartners].rxRing = ringRX;
+			this->_structCommPartners[_u8CurrCommPartners].u8RxQueueLength = ringRX->u16Size - 1;
+		}
+
+		if(ringTX != nullptr)
+		{
+			this->_structCommPartners[_u8CurrCommPartners].txRing = ringTX;
+			this->_structCommPartners[_u8CurrCommPartners].u8TxQueueLength = ringTX->u16Size - 1;
+		}
+
+		this->_setPartnersName(this->_u8CurrCommPartners,partnersName,FRTTRANSCEIVER_DEFAULTPARTNERNAME);
+
+		this->_assignStorage(this->_u8CurrCommPartners,txLineStorage,tempStorage,sharedStorage,u8Depth);
+		this->_addToPartnerIndex(partner,this->_u8CurrCommPartners);
+		this->_structCommPartners[_u8CurrCommPartners].u8Generation++;
+		this->_u8CurrCommPartners++;
+
+		#if (configUSE_QUEUE_SETS == 1)
+		this->_bRxQueueSetStale = (this->_rxQueueSet != nullptr && ringRX != nullptr) || this->_bRxQueueSetStale;
+		#endif
+		return true;
+	}
+
+	bool FRTTransceiver::addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,
+													const char * multiSenderQueueName)
+	{
+		return this->_addMultiSenderPartner(queueRX,u8QueueLengthRx,semaphoreRx,multiSenderQueueName,nullptr,nullptr,nullptr,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE);
+	}
+
+	bool FRTTransceiver::_addMultiSenderPartner(FRTTQueueHandle queueRX,uint8_t u8QueueLengthRx,FRTTSemaphoreHandle semaphoreRx,const char * multiSenderQueueName,
+													FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth)
+	{
+		if(!this->_bHasValidStruct || this->_u8CurrCommPartners + 1 > this->_u8MaxPartners)
+		{
+			return false;
+		}
+
+		if(queueRX != nullptr)
+		{	
+			if(this->_queueExists(queueRX,false) != 1 && this->_queueExists(queueRX,true) != 1)
+			{
+				if(semaphoreRx == nullptr || this->_semaphoreExists(semaphoreRx,true) == 1 	|| this->_semaphoreExists(semaphoreRx,false) == 1
+																							||(this->_checkValidQueueLength(u8QueueLengthRx,u8Depth) == false))
+				{	
+					/* It is possible to establish a connection without a queue (task-notification), 
+					but since the queue was valid, we shouldnt procceed further because the user clearly wanted to add a queue */
+					#ifdef LOG_INFO
+					printf("Queue is valid but the semaphore OR queuelength is invalid!\n");
+					#endif
+					return false;
+				}
+				this->_structCommPartners[_u8CurrCommPartners].rxQueue = queueRX;
+				this->_structCommPartners[_u8CurrCommPartners].u8RxQueueLength = u8QueueLengthRx;
+				this->_structCommPartners[_u8CurrCommPartners].semaphoreRxQueue = semaphoreRx;
+			}
+			else
+			{	
+				/* It is possible to establish a connection without a queue (task-notification), 
+					but since the queue was already added to a comm-line, we shouldnt procceed further because the user clearly wanted to add a queue */
+				#ifdef LOG_INFO
+				printf("Queue already exists\n");
+				#endif
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+
+		this->_setPartnersName(this->_u8CurrCommPartners,multiSenderQueueName,FRTTRANSCEIVER_DEFAULTPARTNERNAMEMULTISENDERQUEUE);
+
+		this->_structCommPartners[_u8CurrCommPartners].bReadOnlyCommunication = true; /* means multisender queue, where we dont send ourselves*/
+
+		if(this->_u8MultiSenderQueues < FRTTRANSCEIVER_MAXMULTISENDERQUEUES)
+		{
+			this->_u8MultiSenderSlots[this->_u8MultiSenderQueues] = this->_u8CurrCommPartners;
+		}
+		this->_u8MultiSenderQueues++;
+		this->_assignStorage(this->_u8CurrCommPartners,txLineStorage,tempStorage,sharedStorage,u8Depth);
+		this->_structCommPartners[_u8CurrCommPartners].u8Generation++;
+		this->_u8CurrCommPartners++;
+
+		#if (configUSE_QUEUE_SETS == 1)
+		this->_bRxQueueSetStale = (this->_rxQueueSet != nullptr) || this->_bRxQueueSetStale;
+		#endif
+		return true;
+	}
+
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	bool FRTTransceiver::writeToQueue(FRTTTaskHandle destination,uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	bool FRTTransceiver::writeToQueue(FRTTTaskHandle destination,uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
+	#endif
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(destination,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+
+		if(pos == -1 || !this->_hasDataInterpreters() || (this->_structCommPartners[pos].txRing == nullptr && this->_structCommPartners[pos].semaphoreTxQueue == nullptr))
+		{
+			#ifdef LOG_INFO
+			printf("You are not allowed to write to a queue \nOne of the following things happened:\n"
+				"-[no communication struct available]\n"
+				"-[no callback functions for (allocating,freeing) data supplied]\n"
+				"-[no semphores supplied]\n"
+				"-[destination task unknown]\n");
+			#endif
+			return false;
+		}
+
+		if((this->_structCommPartners[pos].txQueue == nullptr && this->_structCommPartners[pos].txRing == nullptr) || this->_checkValidQueueLength(this->_structCommPartners[pos].u8TxQueueLength,this->_structCommPartners[pos].u8Depth) == false || data == nullptr)
+		{
+			#ifdef LOG_INFO
+			printf("Action now allowed \nOne of the following things happened:\n"
+				"-[no tx queue supplied]\n"
+				"-[queue length invalid]\n"
+				"-[data pointer null]\n");
+			#endif
+			return false;
+		}
+
+		TickType_t timeToWaitWrite;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeWrite_Ms,timeToWaitWrite) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{  
+			return false;
+		}
+
+		/* c++11 no aggregate initialization possible */
+		struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
+		this->_setSender(tempDataContainerOnQueue);
+		tempDataContainerOnQueue.data = data;
+		tempDataContainerOnQueue.u8DataType = u8DataType;
+		#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+		tempDataContainerOnQueue.u32AdditionalData = u32AdditionalData;
+		#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+		tempDataContainerOnQueue.u64AdditionalData = u64AdditionalData;
+		#endif
+
+		return this->_writeToLine(pos,tempDataContainerOnQueue,timeToWaitWrite,timeToWaitSemaphore);
+	}
+
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	bool FRTTransceiver::writeToQueue(FRTTLine line,uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	bool FRTTransceiver::writeToQueue(FRTTLine line,uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
+	#endif
+	{
+		/* Queue, queue length and semaphore were checked while the communication line was added */
+		if(!this->_hasDataInterpreters() || !this->_isValidLine(line) || (this->_structCommPartners[line.u8Slot].txQueue == nullptr && this->_structCommPartners[line.u8Slot].txRing == nullptr) || data == nullptr)
+		{
+			return false;
+		}
+
+		TickType_t timeToWaitWrite;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeWrite_Ms,timeToWaitWrite) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{  
+			return false;
+		}
+
+		/* c++11 no aggregate initialization possible */
+		struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
+		this->_setSender(tempDataContainerOnQueue);
+		tempDataContainerOnQueue.data = data;
+		tempDataContainerOnQueue.u8DataType = u8DataType;
+		#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+		tempDataContainerOnQueue.u32AdditionalData = u32AdditionalData;
+		#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+		tempDataContainerOnQueue.u64AdditionalData = u64AdditionalData;
+		#endif
+
+		return this->_writeToLine(line.u8Slot,tempDataContainerOnQueue,timeToWaitWrite,timeToWaitSemaphore);
+	}
+
+	#if (FRTTRANSCEIVER_INLINEPAYLOADSIZE > 0)
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	bool FRTTransceiver::writeInlineToQueue(FRTTTaskHandle destination,uint8_t u8DataType,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
+	{
+		return this->writeInlineToQueue(this->getLine(destination),u8DataType,payload,u8Size,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms,u32AdditionalData);
+	}
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	bool FRTTransceiver::writeInlineToQueue(FRTTTaskHandle destination,uint8_t u8DataType,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
+	{
+		return this->writeInlineToQueue(this->getLine(destination),u8DataType,payload,u8Size,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms,u64AdditionalData);
+	}
+	#endif
+
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	bool FRTTransceiver::writeInlineToQueue(FRTTLine line,uint8_t u8DataType,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	bool FRTTransceiver::writeInlineToQueue(FRTTLine line,uint8_t u8DataType,const void * payload,uint8_t u8Size,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
+	#endif
+	{
+		if(!this->_isValidLine(line) || (this->_structCommPartners[line.u8Slot].txQueue == nullptr && this->_structCommPartners[line.u8Slot].txRing == nullptr) || 
+			payload == nullptr || u8Size == 0 || u8Size > FRTTRANSCEIVER_INLINEPAYLOADSIZE)
+		{
+			#ifdef LOG_INFO
+			printf("Nothing sent [invalid line, no tx queue, payload null or size not in [1;FRTTRANSCEIVER_INLINEPAYLOADSIZE]]\n");
+			#endif
+			return false;
+		}
+
+		TickType_t timeToWaitWrite;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeWrite_Ms,timeToWaitWrite) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{  
+			return false;
+		}
+
+		struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
+		this->_setSender(tempDataContainerOnQueue);
+		memcpy(tempDataContainerOnQueue.au8InlinePayload,payload,u8Size);
+		tempDataContainerOnQueue.u8InlineSize = u8Size;
+		tempDataContainerOnQueue.u8Flags = FRTTRANSCEIVER_FLAG_INLINEPAYLOAD;
+		tempDataContainerOnQueue.u8DataType = u8DataType;
+		#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+		tempDataContainerOnQueue.u32AdditionalData = u32AdditionalData;
+		#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+		tempDataContainerOnQueue.u64AdditionalData = u64AdditionalData;
+		#endif
+
+		return this->_writeToLine(line.u8Slot,tempDataContainerOnQueue,timeToWaitWrite,timeToWaitSemaphore);
+	}
+	#endif
+
+	bool FRTTransceiver::_writeToLine(uint8_t u8CommStructPos,FRTTDataContainerOnQueue & dataContainer,TickType_t timeToWaitWrite,TickType_t timeToWaitSemaphore)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+
+		#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+		dataContainer.u32EnqueueTime = FRTTRANSCEIVER_TIMESTAMP();
+		#endif
+
+		/* The ring slot itself holds the data package, so there is nothing to mirror and no semaphore to take */
+		if(commLine.txRing)
+		{
+			int messagesBefore = (commLine.u32TxDoorbellMask != 0 ? this->_getAmountOfMessages(commLine.txRing) : 0);
+
+			if(!this->_ringPush(commLine.txRing,dataContainer,timeToWaitWrite))
+			{
+				return false;
+			}
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(commLine.dataPackagesSent);
+			#endif
+
+			this->_ringDoorbell(u8CommStructPos,messagesBefore);
+			return true;
+		}
+
+		/* Fire-and-forget: the queue copies the data package, nobody looks at a mirror of it. The queue itself is thread safe */
+		if(commLine.bFireAndForget)
+		{
+			int messagesBefore = (commLine.u32TxDoorbellMask != 0 ? this->_getAmountOfMessages(commLine.txQueue) : 0);
+
+			if(xQueueSendToBack(commLine.txQueue,(const void *)&dataContainer,timeToWaitWrite) != pdPASS)
+			{
+				return false;
+			}
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(commLine.dataPackagesSent);
+			#endif
+
+			this->_ringDoorbell(u8CommStructPos,messagesBefore);
+			return true;
+		}
+
+		SemaphoreHandle_t s = commLine.semaphoreTxQueue;
+
+		if(xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
+		{
+			#ifdef LOG_INFO
+			printf("Semaphore was not available before block time expired.\n");
+			#endif
+			return false;
+		}
+
+		uint8_t u8MessagesOnQueue = this->_getAmountOfMessages(commLine.txQueue);
+
+		/* Queue Full. Manual wait without holding the semaphore, otherwise the partner could not read */
+		if(u8MessagesOnQueue >= commLine.u8TxQueueLength)
+		{
+			xSemaphoreGive(s);
+
+			/* does not end when data arrives, so if timeToWaitWrite == MAXWAIT -----> doesnt go further than below code */
+			if(xQueueSendToBack(commLine.txQueue,(const void *)&dataContainer,timeToWaitWrite) != pdPASS)
+			{
+				return false;
+			}
+
+			/* The data package is on the queue and owns its references now. Only the mirror can miss it, that is no reason to report a failure */
+			if(xSemaphoreTake(s,timeToWaitSemaphore) == pdTRUE)
+			{
+				commLine.txLineContainer[commLine.u8TxQueueLength - 1] = dataContainer;
+				this->_clearSharedMirror(commLine.txLineContainer[commLine.u8TxQueueLength - 1]);
+				xSemaphoreGive(s);
+			}
+			else
+			{
+				#ifdef LOG_INFO
+				printf("Semaphore was not available before block time expired. Data package sent, mirror not updated\n");
+				#endif
+			}
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(commLine.dataPackagesSent);
+			#endif
+
+			this->_ringDoorbell(u8CommStructPos,commLine.u8TxQueueLength);
+			return true;
+		}
+
+		/* space left for another element */
+		commLine.txLineContainer[u8MessagesOnQueue] = dataContainer;
+
+		/* At this point we should just be able to put data on the queue without waiting. */
+		FRTTBaseType returnVal = xQueueSendToBack(commLine.txQueue,(const void *)&commLine.txLineContainer[u8MessagesOnQueue],timeToWaitWrite);
+		this->_clearSharedMirror(commLine.txLineContainer[u8MessagesOnQueue]);
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		if(returnVal == pdPASS)
+		{
+			FRTTCountUp(commLine.dataPackagesSent);
+		}
+		#endif
+
+		xSemaphoreGive(s);
+
+		if(returnVal == pdPASS)
+		{
+			this->_ringDoorbell(u8CommStructPos,u8MessagesOnQueue);
+		}
+		return (returnVal == pdPASS);
+	}
+
+
+	int FRTTransceiver::writeBatchToQueue(FRTTTaskHandle destination,const FRTTDataContainerOnQueue * dataContainers,uint8_t u8Count,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(destination,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+
+		if(pos == -1 || !this->_hasDataInterpreters() || (this->_structCommPartners[pos].txRing == nullptr && this->_structCommPartners[pos].semaphoreTxQueue == nullptr))
+		{
+			#ifdef LOG_INFO
+			printf("You are not allowed to write to a queue \nOne of the following things happened:\n"
+				"-[no communication struct available]\n"
+				"-[no callback functions for (allocating,freeing) data supplied]\n"
+				"-[no semphores supplied]\n"
+				"-[destination task unknown]\n");
+			#endif
+			return -1;
+		}
+
+		if((this->_structCommPartners[pos].txQueue == nullptr && this->_structCommPartners[pos].txRing == nullptr) || this->_checkValidQueueLength(this->_structCommPartners[pos].u8TxQueueLength,this->_structCommPartners[pos].u8Depth) == false)
+		{
+			return -1;
+		}
+
+		FRTTLine line = this->_lineAt(pos);
+
+		return this->writeBatchToQueue(line,dataContainers,u8Count,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms);
+	}
+
+	int FRTTransceiver::writeBatchToQueue(FRTTLine line,const FRTTDataContainerOnQueue * dataContainers,uint8_t u8Count,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		if(!this->_hasDataInterpreters() || !this->_isValidLine(line) || (this->_structCommPartners[line.u8Slot].txQueue == nullptr && this->_structCommPartners[line.u8Slot].txRing == nullptr) || dataContainers == nullptr)
+		{
+			return -1;
+		}
+
+		/* All data packages are checked before the first one is sent, so a batch is never cut off by an invalid entry */
+		for(uint8_t u8I = 0;u8I < u8Count;u8I++)
+		{
+			if(dataContainers[u8I].data == nullptr)
+			{
+				#ifdef LOG_INFO
+				printf("Nothing sent [data pointer of a batch entry is null]\n");
+				#endif
+				return -1;
+			}
+		}
+
+		TickType_t timeToWaitWrite;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeWrite_Ms,timeToWaitWrite) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{  
+			return -1;
+		}
+
+		if(u8Count == 0)
+		{
+			return 0;
+		}
+
+		return this->_writeBatchToLine(line.u8Slot,dataContainers,u8Count,timeToWaitWrite,timeToWaitSemaphore);
+	}
+
+	int FRTTransceiver::_writeBatchToLine(uint8_t u8CommStructPos,const FRTTDataContainerOnQueue * dataContainers,uint8_t u8Count,TickType_t timeToWaitWrite,TickType_t timeToWaitSemaphore)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+		uint8_t u8Accepted = 0;
+
+		if(commLine.txRing)
+		{
+			struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
+			int messagesBefore = (commLine.u32TxDoorbellMask != 0 ? this->_getAmountOfMessages(commLine.txRing) : 0);
+
+			for(;u8Accepted < u8Count;u8Accepted++)
+			{
+				tempDataContainerOnQueue = dataContainers[u8Accepted];
+				this->_setSender(tempDataContainerOnQueue);
+				tempDataContainerOnQueue.u8Flags = 0;
+				#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+				tempDataContainerOnQueue.u32EnqueueTime = FRTTRANSCEIVER_TIMESTAMP();
+				#endif
+
+				if(!this->_ringPush(commLine.txRing,tempDataContainerOnQueue,u8Accepted == 0 ? timeToWaitWrite : 0))
+				{
+					break;
+				}
+			}
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(commLine.dataPackagesSent,u8Accepted);
+			#endif
+
+			if(u8Accepted > 0)
+			{
+				this->_ringDoorbell(u8CommStructPos,messagesBefore);
+			}
+			return u8Accepted;
+		}
+
+		/* Queue full. Only the first data package waits, the regular write path does that without holding the semaphore */
+		if(this->_getAmountOfMessages(commLine.txQueue) >= commLine.u8TxQueueLength)
+		{
+			struct FRTTDataContainerOnQueue tempDataContainerOnQueue = dataContainers[0];
+			this->_setSender(tempDataContainerOnQueue);
+			tempDataContainerOnQueue.u8Flags = 0;
+
+			if(!this->_writeToLine(u8CommStructPos,tempDataContainerOnQueue,timeToWaitWrite,timeToWaitSemaphore))
+			{
+				return 0;
+			}
+			u8Accepted++;
+		}
+
+		if(commLine.bFireAndForget)
+		{
+			struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
+			uint8_t u8FirstAccepted = u8Accepted;
+			int messagesBefore = (commLine.u32TxDoorbellMask != 0 ? this->_getAmountOfMessages(commLine.txQueue) : 0);
+
+			for(;u8Accepted < u8Count;u8Accepted++)
+			{
+				tempDataContainerOnQueue = dataContainers[u8Accepted];
+				this->_setSender(tempDataContainerOnQueue);
+				tempDataContainerOnQueue.u8Flags = 0;
+				#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+				tempDataContainerOnQueue.u32EnqueueTime = FRTTRANSCEIVER_TIMESTAMP();
+				#endif
+
+				if(xQueueSendToBack(commLine.txQueue,(const void *)&tempDataContainerOnQueue,0) != pdPASS)
+				{
+					break;
+				}
+			}
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(commLine.dataPackagesSent,u8Accepted - u8FirstAccepted);
+			#endif
+
+			if(u8Accepted > u8FirstAccepted)
+			{
+				this->_ringDoorbell(u8CommStructPos,messagesBefore);
+			}
+			return u8Accepted;
+		}
+
+		SemaphoreHandle_t s = commLine.semaphoreTxQueue;
+
+		if(u8Accepted == u8Count || xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
+		{
+			return u8Accepted;
+		}
+
+		uint8_t u8MessagesOnQueue = this->_getAmountOfMessages(commLine.txQueue);
+		uint8_t u8FirstAccepted = u8Accepted;
+		int messagesBefore = u8MessagesOnQueue;
+
+		for(;u8Accepted < u8Count && u8MessagesOnQueue < commLine.u8TxQueueLength;u8Accepted++,u8MessagesOnQueue++)
+		{
+			commLine.txLineContainer[u8MessagesOnQueue] = dataContainers[u8Accepted];
+			this->_setSender(commLine.txLineContainer[u8MessagesOnQueue]);
+			commLine.txLineContainer[u8MessagesOnQueue].u8Flags = 0;
+			#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+			commLine.txLineContainer[u8MessagesOnQueue].u32EnqueueTime = FRTTRANSCEIVER_TIMESTAMP();
+			#endif
+
+			/* Space was checked above, so there is no need to wait here */
+			if(xQueueSendToBack(commLine.txQueue,(const void *)&commLine.txLineContainer[u8MessagesOnQueue],0) != pdPASS)
+			{
+				break;
+			}
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(commLine.dataPackagesSent);
+			#endif
+		}
+
+		xSemaphoreGive(s);
+
+		if(u8Accepted > u8FirstAccepted)
+		{
+			this->_ringDoorbell(u8CommStructPos,messagesBefore);
+		}
+		return u8Accepted;
+	}
+
+
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	bool FRTTransceiver::databroadcast(uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	bool FRTTransceiver::databroadcast(uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
+	#endif
+	{  
+		
+		if(!this->_bHasValidStruct || this->_getAmountOfQueues(true) <= 0) return false;
+
+		uint8_t u8SuccessCounter = 0;
+		
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners ; u8I++)
+		{
+			if(this->_structCommPartners[u8I].bReadOnlyCommunication == false || this->_structCommPartners[u8I].txQueue != nullptr)
+			{
+				#ifdef FRTTRANSCEIVER_32BITADDITIONALDATA
+				if(this->writeToQueue(this->_structCommPartners[u8I].commPartner,u8DataType,data,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms,u32AdditionalData)){
+				u8SuccessCounter++;
+				}
+				#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+				if(this->writeToQueue(this->_structCommPartners[u8I].commPartner,u8DataType,data,blockTimeWrite_Ms,blockTimeTakeSemaphore_Ms,u64AdditionalData)){
+				u8SuccessCounter++;
+				}
+				#endif
+			}
+		}
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		if(u8SuccessCounter > 0)
+		{
+			FRTTCountUp(this->_broadcastCount);
+		}
+		#endif
+
+		return (u8SuccessCounter == this->_getAmountOfQueues(true));
+	}
+
+
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	uint64_t FRTTransceiver::databroadcastFanOut(uint8_t u8DataType,void * data,int deadline_Ms,uint32_t u32AdditionalData)
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	uint64_t FRTTransceiver::databroadcastFanOut(uint8_t u8DataType,void * data,int deadline_Ms,uint64_t u64AdditionalData)
+	#endif
+	{
+		TickType_t deadline;
+
+		if(!this->_bHasValidStruct || data == nullptr || !this->_toTicks(deadline_Ms,deadline)) return 0;
+
+		/* c++11 no aggregate initialization possible */
+		struct FRTTDataContainerOnQueue tempDataContainerOnQueue;
+		this->_setSender(tempDataContainerOnQueue);
+		tempDataContainerOnQueue.data = data;
+		tempDataContainerOnQueue.u8DataType = u8DataType;
+		#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+		tempDataContainerOnQueue.u32AdditionalData = u32AdditionalData;
+		#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+		tempDataContainerOnQueue.u64AdditionalData = u64AdditionalData;
+		#endif
+
+		uint64_t u64Delivered = 0;
+		uint8_t u8Pending = 0;
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners ; u8I++)
+		{
+			this->_structCommPartners[u8I].bFanOutPending = (this->_structCommPartners[u8I].txQueue != nullptr || this->_structCommPartners[u8I].txRing != nullptr);
+		}
+
+		TickType_t start = xTaskGetTickCount();
+
+		/* First round: nobody waits for anybody. Every further round: only the lines that were full (or busy) */
+		do
+		{
+			u8Pending = 0;
+
+			for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners ; u8I++)
+			{
+				FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+				if(!commLine.bFanOutPending) continue;
+
+				/* True as soon as the queue holds the data package. A busy tx semaphore afterwards must not lead to a second copy in the next round */
+				if(this->_writeToLine(u8I,tempDataContainerOnQueue,0,0))
+				{
+					commLine.bFanOutPending = false;
+					if(u8I < 64) u64Delivered |= ((uint64_t)1 << u8I);
+				}
+				else
+				{
+					u8Pending++;
+				}
+			}
+
+			if(u8Pending == 0 || (deadline != portMAX_DELAY && (xTaskGetTickCount() - start) >= deadline)) break;
+
+			/* give the consumers the chance to make space */
+			vTaskDelay(1);
+
+		} while(true);
+
+		/* Lines that missed the deadline */
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners ; u8I++)
+		{
+			this->_structCommPartners[u8I].bFanOutPending = false;
+		}
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		if(u64Delivered != 0)
+		{
+			FRTTCountUp(this->_broadcastCount);
+		}
+		#endif
+
+		return u64Delivered;
+	}
+
+
+	#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+	bool FRTTransceiver::databroadcastShared(uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint32_t u32AdditionalData)
+	#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+	bool FRTTransceiver::databroadcastShared(uint8_t u8DataType,void * data,int blockTimeWrite_Ms,int blockTimeTakeSemaphore_Ms,uint64_t u64AdditionalData)
+	#endif
+	{
+		int amountOfTxLines = this->_getAmountOfQueues(true);
+
+		if(amountOfTxLines <= 0 || data == nullptr || this->_dataDestroyer == nullptr) return false;
+
+		TickType_t timeToWaitWrite;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeWrite_Ms,timeToWaitWrite) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return false;
+		}
+
+		FRTTSharedPayload * shared = new (std::nothrow) struct FRTTSharedPayload;
+
+		if(!shared)
+		{
+			#ifdef LOG_INFO
+			printf("Shared payload cannot be created [Insufficient heap memory]\n");
+			#endif
+			return false;
+		}
+
+		this->_setSender(shared->payload);
+		shared->payload.data = data;
+		shared->payload.u8DataType = u8DataType;
+		#if defined(FRTTRANSCEIVER_32BITADDITIONALDATA)
+		shared->payload.u32AdditionalData = u32AdditionalData;
+		#elif defined(FRTTRANSCEIVER_64BITADDITIONALDATA)
+		shared->payload.u64AdditionalData = u64AdditionalData;
+		#endif
+		shared->freeCallback = this->_dataDestroyer;
+
+		/* One reference per package + the one of this method. Receivers may release theirs before the loop is done */
+		shared->u32References.store(amountOfTxLines + 1,std::memory_order_relaxed);
+
+		/* c++11 no aggregate initialization possible */
+		struct FRTTDataContainerOnQueue tempDataContainerOnQueue = shared->payload;
+		tempDataContainerOnQueue.data = shared;
+		tempDataContainerOnQueue.u8Flags = FRTTRANSCEIVER_FLAG_SHAREDPAYLOAD;
+
+		int successCounter = 0;
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners ; u8I++)
+		{
+			if(this->_structCommPartners[u8I].txQueue == nullptr && this->_structCommPartners[u8I].txRing == nullptr)
+			{
+				continue;
+			}
+
+			if(this->_writeToLine(u8I,tempDataContainerOnQueue,timeToWaitWrite,timeToWaitSemaphore))
+			{
+				successCounter++;
+			}
+			else
+			{
+				this->_releaseShared(shared);
+			}
+		}
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		if(successCounter > 0)
+		{
+			FRTTCountUp(this->_broadcastCount);
+		}
+		#endif
+
+		this->_releaseShared(shared);
+		return (successCounter == amountOfTxLines);
+	}
+
+	bool FRTTransceiver::readFromQueue(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		if(!this->_bHasValidStruct)
+		{
+			return false;
+		}
+
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1 || !this->_canBufferData(pos) || (this->_structCommPartners[pos].rxRing == nullptr && (this->_structCommPartners[pos].rxQueue == nullptr || this->_structCommPartners[pos].semaphoreRxQueue == nullptr)))
+		{
+			return false;
+
+		}
+
+		TickType_t timeToWaitRead;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeRead_Ms,timeToWaitRead) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return false;
+		}
+
+		return this->_readFromLine(pos,timeToWaitRead,timeToWaitSemaphore);
+	}
+
+	bool FRTTransceiver::readFromQueue(FRTTLine line,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		/* Queue and semaphore were checked while the communication line was added */
+		if(!this->_isValidLine(line) || (this->_structCommPartners[line.u8Slot].rxQueue == nullptr && this->_structCommPartners[line.u8Slot].rxRing == nullptr) || !this->_canBufferData(line.u8Slot))
+		{
+			return false;
+		}
+
+		TickType_t timeToWaitRead;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeRead_Ms,timeToWaitRead) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return false;
+		}
+
+		return this->_readFromLine(line.u8Slot,timeToWaitRead,timeToWaitSemaphore);
+	}
+
+	bool FRTTransceiver::_readFromLine(uint8_t u8CommStructPos,TickType_t timeToWaitRead,TickType_t timeToWaitSemaphore)
+	{
+		/* Only the owner of this object reads from the ring, so the internal buffer needs no semaphore */
+		if(this->_structCommPartners[u8CommStructPos].rxRing)
+		{
+			if(!this->_ringPop(this->_structCommPartners[u8CommStructPos].rxRing,this->_structCommPartners[u8CommStructPos].rxLineContainer,timeToWaitRead))
+			{
+				return false;
+			}
+
+			return this->_moveIntoBuffer(u8CommStructPos);
+		}
+
+		FRTTBaseType returnVal = xQueueReceive(this->_structCommPartners[u8CommStructPos].rxQueue,(void *)&this->_structCommPartners[u8CommStructPos].rxLineContainer,timeToWaitRead);
+
+		/* errQUEUE_EMPTY returned if expression true*/
+		if(!(returnVal == pdPASS))
+		{
+			return false;
+		}
+
+		SemaphoreHandle_t s = this->_structCommPartners[u8CommStructPos].semaphoreRxQueue;
+
+		/* The data package already left the queue. It is dropped, but a shared payload must still lose its reference */
+		if(xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
+		{
+			this->_releaseDiscarded(this->_structCommPartners[u8CommStructPos].rxLineContainer,this->_structCommPartners[u8CommStructPos].bTakeOwnership);
+			return false;
+		}
+
+		bool bBuffered = this->_moveIntoBuffer(u8CommStructPos);
+
+		xSemaphoreGive(s);
+		return bBuffered;
+	}
+
+	int FRTTransceiver::_readFromWaitingLine(bool bSkipQueueSetMembers,TickType_t timeToWaitSemaphore)
+	{
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			/* Rings are always checked, data written before a ring joined the queue set left no event */
+			if((bSkipQueueSetMembers && commLine.bInRxQueueSet && commLine.rxRing == nullptr) || !this->_canBufferData(u8I))
+			{
+				continue;
+			}
+
+			if((commLine.rxRing && this->_getAmountOfMessages(commLine.rxRing) > 0) || (commLine.rxQueue && this->_getAmountOfMessages(commLine.rxQueue) > 0))
+			{
+				if(this->_readFromLine(u8I,0,timeToWaitSemaphore))
+				{
+					return u8I;
+				}
+			}
+		}
+
+		return -1;
+	}
+
+	void FRTTransceiver::setSchedulingPolicy(eFRTTSchedulingPolicy policy)
+	{
+		this->_schedulingPolicy = policy;
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			this->_structCommPartners[u8I].u8Deficit = 0;
+		}
+	}
+
+	bool FRTTransceiver::setLineScheduling(FRTTLine line,uint8_t u8Priority,uint8_t u8Weight)
+	{
+		if(!this->_isValidLine(line) || u8Weight == 0)
+		{
+			return false;
+		}
+
+		this->_structCommPartners[line.u8Slot].u8Priority = u8Priority;
+		this->_structCommPartners[line.u8Slot].u8Weight = u8Weight;
+		return true;
+	}
+
+	int FRTTransceiver::serviceLines(uint8_t u8Budget,int blockTimeTakeSemaphore_Ms)
+	{
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_bHasValidStruct || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return -1;
+		}
+
+		if(u8Budget == 0 || this->_u8CurrCommPartners == 0)
+		{
+			return 0;
+		}
+
+		if(this->_schedulingPolicy == eFRTTSchedulingPolicy::e_STRICTPRIORITY)
+		{
+			return this->_serviceByPriority(u8Budget,timeToWaitSemaphore);
+		}
+		return this->_serviceByWeight(u8Budget,timeToWaitSemaphore);
+	}
+
+	bool FRTTransceiver::_hasWaitingData(uint8_t u8CommStructPos)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+
+		if(!this->_canBufferData(u8CommStructPos))
+		{
+			return false;
+		}
+
+		return (commLine.rxRing && this->_getAmountOfMessages(commLine.rxRing) > 0) || (commLine.rxQueue && this->_getAmountOfMessages(commLine.rxQueue) > 0);
+	}
+
+	bool FRTTransceiver::_canServiceLine(uint8_t u8CommStructPos)
+	{
+		/* Reading into a full buffer would release the oldest entry before the user consumed it */
+		return !this->_structCommPartners[u8CommStructPos].bRxBufferFull && this->_hasWaitingData(u8CommStructPos);
+	}
+
+	int FRTTransceiver::_serviceByPriority(uint8_t u8Budget,TickType_t timeToWaitSemaphore)
+	{
+		uint8_t u8Read = 0;
+
+		while(u8Read < u8Budget)
+		{
+			int best = -1;
+
+			/* Starting at the round-robin position lets lines of the same priority take turns */
+			for(uint8_t u8N = 0; u8N < this->_u8CurrCommPartners; u8N++)
+			{
+				uint8_t u8I = (this->_u8NextServiceLine + u8N) % this->_u8CurrCommPartners;
+
+				if((best == -1 || this->_structCommPartners[u8I].u8Priority > this->_structCommPartners[best].u8Priority) && this->_canServiceLine(u8I))
+				{
+					best = u8I;
+				}
+			}
+
+			if(best == -1 || !this->_readFromLine(best,0,timeToWaitSemaphore))
+			{
+				break;
+			}
+
+			this->_structCommPartners[best].u32ServiceCount++;
+			this->_u8NextServiceLine = (best + 1) % this->_u8CurrCommPartners;
+			u8Read++;
+		}
+
+		return u8Read;
+	}
+
+	int FRTTransceiver::_serviceByWeight(uint8_t u8Budget,TickType_t timeToWaitSemaphore)
+	{
+		uint8_t u8Read = 0;
+		uint8_t u8IdleLines = 0;
+
+		/* Stops after a whole round without any data */
+		while(u8Read < u8Budget && u8IdleLines < this->_u8CurrCommPartners)
+		{
+			uint8_t u8I = this->_u8NextServiceLine;
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			/* A line whose turn was cut off by the budget continues with the credit it has left */
+			if(commLine.u8Deficit == 0)
+			{
+				commLine.u8Deficit = commLine.u8Weight;
+			}
+
+			bool bServed = false;
+
+			while(commLine.u8Deficit > 0 && u8Read < u8Budget && this->_canServiceLine(u8I) && this->_readFromLine(u8I,0,timeToWaitSemaphore))
+			{
+				commLine.u8Deficit--;
+				commLine.u32ServiceCount++;
+				u8Read++;
+				bServed = true;
+			}
+
+			/* Budget used up in the middle of the turn: the line keeps its turn for the next call */
+			if(commLine.u8Deficit > 0 && u8Read == u8Budget && this->_canServiceLine(u8I))
+			{
+				break;
+			}
+
+			/* Turn over. An empty line does not save credit for later */
+			commLine.u8Deficit = 0;
+			this->_u8NextServiceLine = (u8I + 1) % this->_u8CurrCommPartners;
+			u8IdleLines = (bServed ? 0 : u8IdleLines + 1);
+		}
+
+		return u8Read;
+	}
+
+	uint32_t FRTTransceiver::getServiceCount(FRTTLine line)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return 0;
+		}
+		return this->_structCommPartners[line.u8Slot].u32ServiceCount;
+	}
+
+	void FRTTransceiver::resetServiceCounts()
+	{
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			this->_structCommPartners[u8I].u32ServiceCount = 0;
+		}
+	}
+
+	#if (configUSE_QUEUE_SETS == 1)
+	FRTTLine FRTTransceiver::readFromAny(int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		FRTTLine line;
+		TickType_t timeToWaitRead;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_bHasValidStruct || !this->_toTicks(blockTimeRead_Ms,timeToWaitRead) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return line;
+		}
+
+		bool bSetReady = this->_buildRxQueueSet();
+
+		/* Rings (and all rx queues while the queue set can not be built) are checked without waiting */
+		int pos = this->_readFromWaitingLine(bSetReady,timeToWaitSemaphore);
+		TickType_t start = xTaskGetTickCount();
+		TickType_t timeLeft = timeToWaitRead;
+
+		while(pos == -1)
+		{
+			if(bSetReady)
+			{
+				QueueSetMemberHandle_t member = xQueueSelectFromSet(this->_rxQueueSet,timeLeft);
+
+				if(member == nullptr) break;
+
+				pos = this->_readFromSetMember(member,timeToWaitSemaphore);
+			}
+			else
+			{
+				if(timeLeft == 0) break;
+
+				/* No queue set right now (e.g. a rx queue holds data that can not be read yet). Check all lines once per tick */
+				vTaskDelay(1);
+				bSetReady = this->_buildRxQueueSet();
+				pos = this->_readFromWaitingLine(bSetReady,timeToWaitSemaphore);
+			}
+
+			/* Stale event (data package already read otherwise) or nothing found. Wait for the rest of the block-time */
+			if(pos == -1 && timeToWaitRead != portMAX_DELAY)
+			{
+				TickType_t elapsed = xTaskGetTickCount() - start;
+
+				if(elapsed >= timeToWaitRead) break;
+				timeLeft = timeToWaitRead - elapsed;
+			}
+		}
+
+		if(pos != -1)
+		{
+			line = this->_lineAt(pos);
+		}
+		return line;
+	}
+
+	int FRTTransceiver::_readFromSetMember(QueueSetMemberHandle_t member,TickType_t timeToWaitSemaphore)
+	{
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			if(!commLine.bInRxQueueSet) continue;
+
+			if(commLine.rxRing && commLine.rxRing->queueSetSignal == member)
+			{
+				/* The next write posts a new event only after the signal was taken */
+				xSemaphoreTake(commLine.rxRing->queueSetSignal,0);
+			}
+			else if(commLine.rxQueue != member)
+			{
+				continue;
+			}
+
+			return (this->_readFromLine(u8I,0,timeToWaitSemaphore) ? u8I : -1);
+		}
+
+		return -1;
+	}
+
+	bool FRTTransceiver::_buildRxQueueSet()
+	{
+		if(this->_rxQueueSet && !this->_bRxQueueSetStale) return true;
+
+		if(this->_rxQueueSet && !this->_dropRxQueueSet()) return false;
+
+		UBaseType_t setLength = 0;
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			if((commLine.rxQueue == nullptr && commLine.rxRing == nullptr) || !this->_canBufferData(u8I)) continue;
+
+			if(commLine.rxRing)
+			{
+				/* The signal of a ring is a binary semaphore: one event at most */
+				setLength++;
+				continue;
+			}
+
+			/* Only an empty queue can join a queue set */
+			if(this->_getAmountOfMessages(commLine.rxQueue) > 0) return false;
+
+			setLength += commLine.u8RxQueueLength;
+		}
+
+		if(setLength == 0) return false;
+
+		this->_rxQueueSet = xQueueCreateSet(setLength);
+
+		if(this->_rxQueueSet == nullptr)
+		{
+			#ifdef LOG_INFO
+			printf("Queue set cannot be created [Insufficient heap memory]\n");
+			#endif
+			return false;
+		}
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			if((commLine.rxQueue == nullptr && commLine.rxRing == nullptr) || !this->_canBufferData(u8I)) continue;
+
+			if(commLine.rxRing)
+			{
+				/* Only a taken semaphore can join. Data written before the ring is signalled is found by _readFromWaitingLine */
+				xSemaphoreTake(commLine.rxRing->queueSetSignal,0);
+
+				if(xQueueAddToSet(commLine.rxRing->queueSetSignal,this->_rxQueueSet) != pdPASS)
+				{
+					this->_dropRxQueueSet();
+					return false;
+				}
+				commLine.rxRing->bInQueueSet.store(true,std::memory_order_seq_cst);
+			}
+			/* A data package may have arrived in the meantime */
+			else if(xQueueAddToSet(commLine.rxQueue,this->_rxQueueSet) != pdPASS)
+			{
+				this->_dropRxQueueSet();
+				return false;
+			}
+			commLine.bInRxQueueSet = true;
+		}
+
+		this->_bRxQueueSetStale = false;
+		return true;
+	}
+
+	bool FRTTransceiver::_dropRxQueueSet()
+	{
+		bool bAllRemoved = true;
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners; u8I++)
+		{
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			if(!commLine.bInRxQueueSet) continue;
+
+			QueueSetMemberHandle_t member = commLine.rxQueue;
+
+			if(commLine.rxRing)
+			{
+				/* Stop the writer from signalling first, the signal must be taken to leave the set */
+				commLine.rxRing->bInQueueSet.store(false,std::memory_order_seq_cst);
+				xSemaphoreTake(commLine.rxRing->queueSetSignal,0);
+				member = commLine.rxRing->queueSetSignal;
+			}
+
+			if(xQueueRemoveFromSet(member,this->_rxQueueSet) == pdPASS)
+			{
+				commLine.bInRxQueueSet = false;
+			}
+			else
+			{
+				bAllRemoved = false;
+			}
+		}
+
+		if(!bAllRemoved) return false;
+
+		vQueueDelete(this->_rxQueueSet);
+		this->_rxQueueSet = nullptr;
+		return true;
+	}
+	#endif
+
+	int FRTTransceiver::readManyFromQueue(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8MaxCount,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		if(!this->_bHasValidStruct)
+		{
+			return -1;
+		}
+
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1 || !this->_canBufferData(pos) || (this->_structCommPartners[pos].rxRing == nullptr && (this->_structCommPartners[pos].rxQueue == nullptr || this->_structCommPartners[pos].semaphoreRxQueue == nullptr)))
+		{
+			return -1;
+		}
+
+		FRTTLine line = this->_lineAt(pos);
+
+		return this->readManyFromQueue(line,u8MaxCount,blockTimeRead_Ms,blockTimeTakeSemaphore_Ms);
+	}
+
+	int FRTTransceiver::readManyFromQueue(FRTTLine line,uint8_t u8MaxCount,int blockTimeRead_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		if(!this->_isValidLine(line) || (this->_structCommPartners[line.u8Slot].rxQueue == nullptr && this->_structCommPartners[line.u8Slot].rxRing == nullptr) || !this->_canBufferData(line.u8Slot))
+		{
+			return -1;
+		}
+
+		TickType_t timeToWaitRead;
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_toTicks(blockTimeRead_Ms,timeToWaitRead) || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return -1;
+		}
+
+		/* Reading more than the buffer holds would release data of the same call again */
+		if(u8MaxCount > this->_structCommPartners[line.u8Slot].u8RxQueueLength)
+		{
+			u8MaxCount = this->_structCommPartners[line.u8Slot].u8RxQueueLength;
+		}
+
+		if(u8MaxCount == 0)
+		{
+			return 0;
+		}
+
+		return this->_readManyFromLine(line.u8Slot,u8MaxCount,timeToWaitRead,timeToWaitSemaphore);
+	}
+
+	int FRTTransceiver::_readManyFromLine(uint8_t u8CommStructPos,uint8_t u8MaxCount,TickType_t timeToWaitRead,TickType_t timeToWaitSemaphore)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+		uint8_t u8Read = 0;
+		uint8_t u8Buffered = 0;
+
+		/* Only the owner of this object reads from the ring, so the internal buffer needs no semaphore */
+		if(commLine.rxRing)
+		{
+			while(u8Read < u8MaxCount && this->_ringPop(commLine.rxRing,commLine.rxLineContainer,u8Read == 0 ? timeToWaitRead : 0))
+			{
+				u8Buffered += this->_moveIntoBuffer(u8CommStructPos);
+				u8Read++;
+			}
+			return u8Buffered;
+		}
+
+		/* Only the first data package is waited for */
+		if(xQueueReceive(commLine.rxQueue,(void *)&commLine.rxLineContainer,timeToWaitRead) != pdPASS)
+		{
+			return 0;
+		}
+
+		SemaphoreHandle_t s = commLine.semaphoreRxQueue;
+
+		/* The data package already left the queue. It is dropped, but a shared payload must still lose its reference */
+		if(xSemaphoreTake(s,timeToWaitSemaphore) == pdFALSE)
+		{
+			this->_releaseDiscarded(commLine.rxLineContainer,commLine.bTakeOwnership);
+			return 0;
+		}
+
+		do
+		{
+			u8Buffered += this->_moveIntoBuffer(u8CommStructPos);
+			u8Read++;
+		}
+		while(u8Read < u8MaxCount && xQueueReceive(commLine.rxQueue,(void *)&commLine.rxLineContainer,0) == pdPASS);
+
+		xSemaphoreGive(s);
+		return u8Buffered;
+	}
+
+	bool FRTTransceiver::_moveIntoBuffer(uint8_t u8CommStructPos)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+		bool bAllocate = !(commLine.rxLineContainer.u8Flags & (FRTTRANSCEIVER_FLAG_SHAREDPAYLOAD | FRTTRANSCEIVER_FLAG_INLINEPAYLOAD)) && !commLine.bTakeOwnership;
+		FRTTTempDataContainer allocated;
+
+		/* Allocated before the oldest data gets released, a rejected data package must not cost a buffer entry */
+		if(bAllocate)
+		{
+			this->_dataAllocator(commLine.rxLineContainer,allocated);
+
+			if(allocated.u8Flags & FRTTRANSCEIVER_FLAG_REJECTED)
+			{
+				#ifdef LOG_INFO
+				printf("Data package dropped [rejected by the data allocate callback]\n");
+				#endif
+				#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+				FRTTCountUp(commLine.dataPackagesDropped);
+				#endif
+				return false;
+			}
+		}
+
+		/* Here it needs to be checked whether we still have space in the tempcontainer array or not*/
+		if(commLine.bRxBufferFull)
+		{
+			/* remove oldest data, the head simply moves on */
+			this->_releaseSlot(u8CommStructPos,0);
+			this->_closeBufferGap(u8CommStructPos,0);
+			commLine.i16CurrTempcontainerPos--;
+		}
+
+		commLine.i16CurrTempcontainerPos++;
+
+		uint8_t u8Index = this->_bufferIndex(u8CommStructPos,commLine.i16CurrTempcontainerPos);
+		commLine.sharedPayload[u8Index] = nullptr;
+
+		if(commLine.rxLineContainer.u8Flags & FRTTRANSCEIVER_FLAG_SHAREDPAYLOAD)
+		{
+			/* Buffer a view of the shared payload. The reference of the package moves over to the buffer entry */
+			FRTTSharedPayload * shared = (FRTTSharedPayload *)commLine.rxLineContainer.data;
+
+			commLine.tempContainer[u8Index] = shared->payload;
+			#if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+			commLine.tempContainer[u8Index].u8SenderId = commLine.rxLineContainer.u8SenderId;
+			#else
+			commLine.tempContainer[u8Index].senderAddress = commLine.rxLineContainer.senderAddress;
+			#endif
+			commLine.tempContainer[u8Index].u8Flags = commLine.rxLineContainer.u8Flags;
+			commLine.sharedPayload[u8Index] = shared;
+		}
+		/* Inline bytes are copied with the package, neither the allocate nor (later) the free callback is needed */
+		else if(commLine.rxLineContainer.u8Flags & FRTTRANSCEIVER_FLAG_INLINEPAYLOAD)
+		{
+			commLine.tempContainer[u8Index] = commLine.rxLineContainer;
+		}
+		/* With ownership transfer the receiver adopts the senders data as it is. It is freed once the buffer slot is released */
+		else if(commLine.bTakeOwnership)
+		{
+			commLine.tempContainer[u8Index] = commLine.rxLineContainer;
+		}
+		else
+		{
+			commLine.tempContainer[u8Index] = allocated;
+		}
+		commLine.bHasBufferedData = true;
+
+		#if (FRTTRANSCEIVER_INDEXEDDATATYPES > 0)
+		if(commLine.tempContainer[u8Index].u8DataType < FRTTRANSCEIVER_INDEXEDDATATYPES)
+		{
+			commLine.au8DatatypeCount[commLine.tempContainer[u8Index].u8DataType]++;
+		}
+		#endif
+
+		#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+		/* The allocate callback does not have to copy the timestamp */
+		commLine.tempContainer[u8Index].u32EnqueueTime = commLine.rxLineContainer.u32EnqueueTime;
+		this->_recordLatency(commLine.latency.queueWait,commLine.rxLineContainer.u32EnqueueTime);
+		#endif
+
+		if(commLine.i16CurrTempcontainerPos+1 == commLine.u8RxQueueLength)
+		{
+			commLine.bRxBufferFull = true;
+		}
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		FRTTCountUp(commLine.dataPackagesReceived);
+		#endif
+		return true;
+	}
+
+	bool FRTTransceiver::queueFlush(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandle,int blockTimeTakeSemaphore_Ms,bool bTxQueue)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandle);
+
+		unsigned long timeToWaitSemaphore = this->_checkWaitTime(blockTimeTakeSemaphore_Ms);
+
+		if(pos == -1 || timeToWaitSemaphore == -2)
+		{
+			return false;
+		}
+
+		struct FRTTDataContainerOnQueue discarded;
+
+		/* Only the reader of a ring may move its tail, which is the partner for the tx ring. Popping (instead of moving the tail) releases shared payloads */
+		if(!bTxQueue && this->_structCommPartners[pos].rxRing)
+		{
+			while(this->_ringPop(this->_structCommPartners[pos].rxRing,discarded,0))
+			{
+				this->_releaseDiscarded(discarded,this->_structCommPartners[pos].bTakeOwnership);
+			}
+			return true;
+		}
+
+		if(((bTxQueue) && this->_structCommPartners[pos].txQueue == nullptr) || ((!bTxQueue) && this->_structCommPartners[pos].rxQueue == nullptr))
+		{
+			return false;
+		}
+
+		
+		timeToWaitSemaphore = (timeToWaitSemaphore == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitSemaphore));
+
+		FRTTQueueHandle queue = (bTxQueue ? this->_structCommPartners[pos].txQueue : this->_structCommPartners[pos].rxQueue);
+		uint8_t u8QueueLength = (bTxQueue ? this->_structCommPartners[pos].u8TxQueueLength : this->_structCommPartners[pos].u8RxQueueLength);
+
+		/* Received one by one instead of xQueueReset(), shared payloads on the queue would never be released otherwise */
+		/* Only the rx side knows that the data belongs to this object (ownership transfer) */
+		bool bOwned = !bTxQueue && this->_structCommPartners[pos].bTakeOwnership;
+
+		for(uint8_t u8I = 0;u8I < u8QueueLength && xQueueReceive(queue,(void *)&discarded,0) == pdPASS;u8I++)
+		{
+			this->_releaseDiscarded(discarded,bOwned);
+		}
+
+		
+		return true;
+	}
+
+
+
+	bool FRTTransceiver::delOldestDatabuffForLine(FRTTTaskHandle partner)
+	{
+		return this->delDatabuffForLine(partner,eMultiSenderQueue::eMULTISENDERQ0,true,0);
+	}
+	bool FRTTransceiver::delOldestDatabuffForLine(eMultiSenderQueue multiSenderQueue)
+	{
+		return this->delDatabuffForLine(nullptr,multiSenderQueue,false,0);
+	}
+
+	bool FRTTransceiver::delNewestDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return false;
+		}
+		return this->delDatabuffForLine(partner,multiSenderQueue,bUseTaskHandleVar,this->_structCommPartners[pos].i16CurrTempcontainerPos);
+	}
+
+	bool FRTTransceiver::delDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8PositionInBuffer)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1 || !this->_canBufferData(pos))
+		{
+			return false;
+		}
+
+		if(this->_structCommPartners[pos].bHasBufferedData && u8PositionInBuffer <= this->_structCommPartners[pos].i16CurrTempcontainerPos)
+		{
+			this->_releaseSlot(pos,u8PositionInBuffer);
+			
+			if(this->_structCommPartners[pos].i16CurrTempcontainerPos == 0)
+			{
+				this->_structCommPartners[pos].bHasBufferedData = false;
+				this->_structCommPartners[pos].u8BufferHead = 0;
+			}
+			else
+			{
+				this->_closeBufferGap(pos,u8PositionInBuffer);
+			}
+			this->_structCommPartners[pos].i16CurrTempcontainerPos--;
+			this->_structCommPartners[pos].bRxBufferFull = false;
+			return true;
+		}
+		return false;
+	}
+
+
+	bool FRTTransceiver::delAllDatabuffForLine(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */  
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1 || !this->_canBufferData(pos))
+		{
+			return false;
+		}
+
+		if(this->_structCommPartners[pos].bHasBufferedData)
+		{  
+			for(uint8_t u8I = 0;u8I <= this->_structCommPartners[pos].i16CurrTempcontainerPos;u8I++)
+			{
+				this->_releaseSlot(pos,u8I);
+			}
+			this->_structCommPartners[pos].bHasBufferedData = false;
+			this->_structCommPartners[pos].bRxBufferFull = false;
+			this->_structCommPartners[pos].i16CurrTempcontainerPos = -1;
+			this->_structCommPartners[pos].u8BufferHead = 0;
+			return true;
+		}
+		return false;
+	}
+
+
+	int FRTTransceiver::messagesOnQueue(FRTTTaskHandle partner,bool bCheckTxQueue)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+
+		if(pos == -1)
+		{
+			return -1;
+		}
+
+		FRTTSpscRingHandle ring = (bCheckTxQueue ? this->_structCommPartners[pos].txRing:this->_structCommPartners[pos].rxRing);
+		if(ring != nullptr)
+		{
+			return this->_getAmountOfMessages(ring);
+		}
+
+		FRTTQueueHandle temp = (bCheckTxQueue ? this->_structCommPartners[pos].txQueue:this->_structCommPartners[pos].rxQueue);
+		if(temp == nullptr)
+		{
+			return -1;
+		}
+
+		return this->_getAmountOfMessages(temp);
+	}
+
+	int FRTTransceiver::messagesOnQueue(eMultiSenderQueue multiSenderQueue)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(nullptr,multiSenderQueue,false);
+
+		if(pos == -1)
+		{
+			return -1;
+		}
+
+		if(this->_structCommPartners[pos].rxQueue == nullptr)
+		{
+			return -1;
+		}
+
+		return this->_getAmountOfMessages(this->_structCommPartners[pos].rxQueue);
+	}
+
+	bool FRTTransceiver::hasDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return false;
+		}
+
+		return this->_structCommPartners[pos].bHasBufferedData;
+	}
+
+
+	int FRTTransceiver::bufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return -1;
+		}
+
+		return (this->_structCommPartners[pos].bHasBufferedData ? this->_structCommPartners[pos].i16CurrTempcontainerPos + 1:0);
+	}
+
+	int FRTTransceiver::bufferedDataInAllBuffers()
+	{
+		if(!this->_bHasValidStruct) return -1;
+
+		int amountOfDataAvail = 0;
+		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
+		{
+			if(this->_structCommPartners[u8I].bHasBufferedData){
+				amountOfDataAvail += this->_structCommPartners[u8I].i16CurrTempcontainerPos + 1;
+			}
+		}
+		return amountOfDataAvail;
+	}
+
+
+	int FRTTransceiver::_getCommStruct(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{
+		if(!this->_bHasValidStruct) return -1;
+
+		if(bUseTaskHandleVar)
+		{
+			if(!partner)
+			{
+				return -1;
+			}
+
+			/* There is always at least one empty entry in the index, so probing ends */
+			uint16_t u16Pos = this->_hashPartner(partner);
+
+			while(this->_u8PartnerIndex[u16Pos] != 0)
+			{
+				uint8_t u8Slot = this->_u8PartnerIndex[u16Pos] - 1;
+
+				if(this->_structCommPartners[u8Slot].commPartner == partner)
+				{
+					return u8Slot;
+				}
+				u16Pos = (u16Pos + 1) & (FRTTRANSCEIVER_PARTNERINDEXSIZE - 1);
+			}
+
+			if(this->_bPartnerIndexOverflow)
+			{
+				for(int i = 0; i < this->_u8CurrCommPartners;i++)
+				{
+					if(this->_structCommPartners[i].commPartner == partner)
+					{
+					return i;
+					}
+				}
+			}
+			return -1;
+		}
+		else
+		{
+			if(!(static_cast<int8_t>(multiSenderQueue) >= 0 && static_cast<int8_t>(multiSenderQueue) < this->_u8MultiSenderQueues))
+			{
+				return -1;
+			}
+
+			if(static_cast<uint8_t>(multiSenderQueue) < (uint8_t)FRTTRANSCEIVER_MAXMULTISENDERQUEUES)
+			{
+				return this->_u8MultiSenderSlots[static_cast<int8_t>(multiSenderQueue)];
+			}
+
+			/* Only reachable through a casted enumerator beyond FRTTRANSCEIVER_MAXMULTISENDERQUEUES */
+			uint8_t counter = 0;
+
+			for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners;u8I++)
+			{
+				if(this->_structCommPartners[u8I].bReadOnlyCommunication)
+				{
+					if(static_cast<int8_t>(multiSenderQueue) == counter)
+					{
+						return u8I;
+					}
+					else
+					{
+						counter++;
+					}
+				}
+			}
+			return -1;
+		}
+	}
+
+	uint16_t FRTTransceiver::_hashPartner(FRTTTaskHandle partner)
+	{
+		/* Fibonacci hashing. Task handles are aligned addresses, so their lower bits alone would collide */
+		uint32_t u32Hash = (uint32_t)((uintptr_t)partner) * 2654435761u;
+
+		return (uint16_t)((u32Hash >> 16) & (FRTTRANSCEIVER_PARTNERINDEXSIZE - 1));
+	}
+
+	void FRTTransceiver::_addToPartnerIndex(FRTTTaskHandle partner,uint8_t u8CommStructPos)
+	{
+		/* Keep one entry empty, otherwise a lookup for an unknown partner would never end */
+		if((uint16_t)(this->_u8IndexedPartners + 1u) >= (uint16_t)FRTTRANSCEIVER_PARTNERINDEXSIZE)
+		{
+			#ifdef LOG_INFO
+			printf("Partner index full. Lookups for this partner will use a linear scan\n");
+			#endif
+			this->_bPartnerIndexOverflow = true;
+			return;
+		}
+
+		uint16_t u16Pos = this->_hashPartner(partner);
+
+		while(this->_u8PartnerIndex[u16Pos] != 0)
+		{
+			u16Pos = (u16Pos + 1) & (FRTTRANSCEIVER_PARTNERINDEXSIZE - 1);
+		}
+
+		this->_u8PartnerIndex[u16Pos] = u8CommStructPos + 1;
+		this->_u8IndexedPartners++;
+	}
+
+	FRTTLine FRTTransceiver::getLine(FRTTTaskHandle partner)
+	{
+		FRTTLine line;
+		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+
+		if(pos != -1)
+		{
+			line = this->_lineAt(pos);
+		}
+		return line;
+	}
+
+	FRTTLine FRTTransceiver::getLine(eMultiSenderQueue multiSenderQueue)
+	{
+		FRTTLine line;
+		int pos = this->_getCommStruct(nullptr,multiSenderQueue,false);
+
+		if(pos != -1)
+		{
+			line = this->_lineAt(pos);
+		}
+		return line;
+	}
+
+	bool FRTTransceiver::_isValidLine(FRTTLine line)
+	{
+		/* _u8CurrCommPartners is only > 0 with a valid communication struct */
+		return line.owner == this && line.u8Slot < this->_u8CurrCommPartners && this->_structCommPartners[line.u8Slot].u8Generation == line.u8Generation;
+	}
+
+	FRTTLine FRTTransceiver::_lineAt(uint8_t u8CommStructPos)
+	{
+		FRTTLine line;
+		line.u8Slot = u8CommStructPos;
+		line.u8Generation = this->_structCommPartners[u8CommStructPos].u8Generation;
+		line.owner = this;
+		return line;
+	}
+
+	bool FRTTransceiver::_toTicks(int time_ms,TickType_t & ticks)
+	{
+		if(this->_checkWaitTime(time_ms) == -2)
+		{
+			return false;
+		}
+
+		ticks = (time_ms == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(time_ms));
+		return true;
+	}
+
+	int FRTTransceiver::_queueExists(FRTTQueueHandle queue,bool bTxQueue)
+	{
+		if(!queue) return -1;
+
+		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
+		{
+			FRTTQueueHandle toCheck = (bTxQueue ? this->_structCommPartners[u8I].txQueue:this->_structCommPartners[u8I].rxQueue);
+			
+			if(toCheck == queue) return 1;
+		}
+
+		return 0;
+	}
+
+	int FRTTransceiver::_semaphoreExists(FRTTSemaphoreHandle smph,bool bTxSemaphore)
+	{
+		if(!smph) return -1;
+
+		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
+		{
+			SemaphoreHandle_t toCheck = (bTxSemaphore ? this->_structCommPartners[u8I].semaphoreTxQueue:this->_structCommPartners[u8I].semaphoreRxQueue);
+			
+			if(toCheck == smph) return 1;
+		}
+
+		return 0;
+	}
+
+	int FRTTransceiver::_ringExists(FRTTSpscRingHandle ring,bool bTxRing)
+	{
+		if(!ring) return -1;
+
+		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
+		{
+			FRTTSpscRingHandle toCheck = (bTxRing ? this->_structCommPartners[u8I].txRing:this->_structCommPartners[u8I].rxRing);
+			
+			if(toCheck == ring) return 1;
+		}
+
+		return 0;
+	}
+
+	bool FRTTransceiver::_ringPush(FRTTSpscRingHandle ring,const FRTTDataContainerOnQueue & dataContainer,TickType_t timeToWait)
+	{
+		uint32_t u32Head = ring->u32Head.load(std::memory_order_relaxed);
+		uint32_t u32Next = (u32Head + 1) % ring->u16Size;
+		TickType_t startTick = xTaskGetTickCount();
+
+		while(u32Next == ring->u32Tail.load(std::memory_order_acquire))
+		{
+			TickType_t elapsed = xTaskGetTickCount() - startTick;
+
+			if(timeToWait == 0 || (timeToWait != portMAX_DELAY && elapsed >= timeToWait))
+			{
+				return false;
+			}
+
+			/* Park first and check again afterwards. The consumer only gives the semaphore if it sees the flag */
+			ring->bProducerParked.store(true,std::memory_order_seq_cst);
+			if(u32Next == ring->u32Tail.load(std::memory_order_seq_cst))
+			{
+				xSemaphoreTake(ring->spaceAvailable,timeToWait == portMAX_DELAY ? portMAX_DELAY : timeToWait - elapsed);
+			}
+			ring->bProducerParked.store(false,std::memory_order_relaxed);
+		}
+
+		ring->slots[u32Head] = dataContainer;
+		ring->u32Head.store(u32Next,std::memory_order_seq_cst);
+
+		if(ring->bConsumerParked.load(std::memory_order_seq_cst))
+		{
+			xSemaphoreGive(ring->dataAvailable);
+		}
+
+		#if (configUSE_QUEUE_SETS == 1)
+		/* Wakes a reader blocked in readFromAny(). Fails (no second event) while the last signal was not taken yet */
+		if(ring->bInQueueSet.load(std::memory_order_seq_cst))
+		{
+			xSemaphoreGive(ring->queueSetSignal);
+		}
+		#endif
+		return true;
+	}
+
+	bool FRTTransceiver::_ringPop(FRTTSpscRingHandle ring,FRTTDataContainerOnQueue & dataContainer,TickType_t timeToWait)
+	{
+		uint32_t u32Tail = ring->u32Tail.load(std::memory_order_relaxed);
+		TickType_t startTick = xTaskGetTickCount();
+
+		while(u32Tail == ring->u32Head.load(std::memory_order_acquire))
+		{
+			TickType_t elapsed = xTaskGetTickCount() - startTick;
+
+			if(timeToWait == 0 || (timeToWait != portMAX_DELAY && elapsed >= timeToWait))
+			{
+				return false;
+			}
+
+			/* Park first and check again afterwards. The producer only gives the semaphore if it sees the flag */
+			ring->bConsumerParked.store(true,std::memory_order_seq_cst);
+			if(u32Tail == ring->u32Head.load(std::memory_order_seq_cst))
+			{
+				xSemaphoreTake(ring->dataAvailable,timeToWait == portMAX_DELAY ? portMAX_DELAY : timeToWait - elapsed);
+			}
+			ring->bConsumerParked.store(false,std::memory_order_relaxed);
+		}
+
+		dataContainer = ring->slots[u32Tail];
+		ring->u32Tail.store((u32Tail + 1) % ring->u16Size,std::memory_order_seq_cst);
+
+		if(ring->bProducerParked.load(std::memory_order_seq_cst))
+		{
+			xSemaphoreGive(ring->spaceAvailable);
+		}
+		return true;
+	}
+
+	int FRTTransceiver::isDatatypeInBuffer(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,uint8_t u8Datatype)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return -1;
+		}
+
+		return this->_countDatatype(pos,u8Datatype);
+	}
+
+	int FRTTransceiver::isDatatypeInBuffer(FRTTLine line,uint8_t u8Datatype)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return -1;
+		}
+		return this->_countDatatype(line.u8Slot,u8Datatype);
+	}
+
+	int FRTTransceiver::_countDatatype(uint8_t u8CommStructPos,uint8_t u8Datatype)
+	{
+		#if (FRTTRANSCEIVER_INDEXEDDATATYPES > 0)
+		if(u8Datatype < FRTTRANSCEIVER_INDEXEDDATATYPES)
+		{
+			return this->_structCommPartners[u8CommStructPos].au8DatatypeCount[u8Datatype];
+		}
+		#endif
+
+		int counter = 0;
+		if(this->_structCommPartners[u8CommStructPos].bHasBufferedData)
+		{
+			for(uint8_t u8I = 0;u8I <= this->_structCommPartners[u8CommStructPos].i16CurrTempcontainerPos;u8I++)
+			{
+				if(this->_structCommPartners[u8CommStructPos].tempContainer[this->_bufferIndex(u8CommStructPos,u8I)].u8DataType == u8Datatype)
+				{
+					counter++;
+				}
+			}
+		}
+		return counter;
+	}
+
+	int FRTTransceiver::_findDatatype(uint8_t u8CommStructPos,uint8_t u8Datatype,bool bNewest)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+
+		if(!commLine.bHasBufferedData)
+		{
+			return -1;
+		}
+
+		#if (FRTTRANSCEIVER_INDEXEDDATATYPES > 0)
+		if(u8Datatype < FRTTRANSCEIVER_INDEXEDDATATYPES && commLine.au8DatatypeCount[u8Datatype] == 0)
+		{
+			return -1;
+		}
+		#endif
+
+		int newest = commLine.i16CurrTempcontainerPos;
+
+		for(int i = 0; i <= newest; i++)
+		{
+			int position = (bNewest ? newest - i : i);
+
+			if(commLine.tempContainer[this->_bufferIndex(u8CommStructPos,position)].u8DataType == u8Datatype)
+			{
+				return position;
+			}
+		}
+		return -1;
+	}
+
+	const FRTTTempDataContainer * FRTTransceiver::getOldestBufferedDataOfType(FRTTLine line,uint8_t u8Datatype,uint8_t * pu8PositionInBuffer)
+	{
+		int position;
+
+		if(!this->_isValidLine(line) || (position = this->_findDatatype(line.u8Slot,u8Datatype,false)) == -1)
+		{
+			return nullptr;
+		}
+
+		if(pu8PositionInBuffer)
+		{
+			*pu8PositionInBuffer = position;
+		}
+		return (const FRTTTempDataContainer *)&this->_structCommPartners[line.u8Slot].tempContainer[this->_bufferIndex(line.u8Slot,position)];
+	}
+
+	const FRTTTempDataContainer * FRTTransceiver::getNewestBufferedDataOfType(FRTTLine line,uint8_t u8Datatype,uint8_t * pu8PositionInBuffer)
+	{
+		int position;
+
+		if(!this->_isValidLine(line) || (position = this->_findDatatype(line.u8Slot,u8Datatype,true)) == -1)
+		{
+			return nullptr;
+		}
+
+		if(pu8PositionInBuffer)
+		{
+			*pu8PositionInBuffer = position;
+		}
+		return (const FRTTTempDataContainer *)&this->_structCommPartners[line.u8Slot].tempContainer[this->_bufferIndex(line.u8Slot,position)];
+	}
+
+	const FRTTTempDataContainer * FRTTransceiver::getNewestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return nullptr;
+		}
+
+		if(this->_structCommPartners[pos].bHasBufferedData)
+		{
+			return (const FRTTTempDataContainer *)&this->_structCommPartners[pos].tempContainer[this->_bufferIndex(pos,this->_structCommPartners[pos].i16CurrTempcontainerPos)];
+		}
+		return nullptr;
+	}
+
+
+	const FRTTTempDataContainer * FRTTransceiver::getOldestBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return nullptr;
+		}
+
+		if(this->_structCommPartners[pos].bHasBufferedData)
+		{
+			return (const FRTTTempDataContainer *)&this->_structCommPartners[pos].tempContainer[this->_structCommPartners[pos].u8BufferHead];
+		}
+		return nullptr;
+	}
+
+	const FRTTTempDataContainer * FRTTransceiver::getBufferedDataFrom(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar, 
+																																		uint8_t u8PositionInBuffer)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+		
+		if(pos == -1)
+		{
+			return nullptr;
+		}
+
+		if(this->_structCommPartners[pos].bHasBufferedData && u8PositionInBuffer <= this->_structCommPartners[pos].i16CurrTempcontainerPos)
+		{
+			return (const FRTTTempDataContainer *)&this->_structCommPartners[pos].tempContainer[this->_bufferIndex(pos,u8PositionInBuffer)];
+		}
+		
+		return nullptr;
+	}
+
+	bool FRTTransceiver::_canNotify(int pos)
+	{
+		/* check for bReadOnlyComm..(true) unnecessary since commPartner will be nullptr for readOnlyQueues anyways*/
+		if(pos == -1 || this->_structCommPartners[pos].commPartner == nullptr || this->_structCommPartners[pos].bReadOnlyCommunication == true)
+		{
+
+			#ifdef LOG_INFO
+			printf("You are not to notify your partner \nOne of the following things happened:\n"
+				"-[no communication struct available]\n"
+				"-[communication partner address == nullptr AND/OR communication line is a multiSenderQueue]\n");
+			#endif
+			return false;
+		}
+		return true;
+	}
+
+	bool FRTTransceiver::NotifyBasic(FRTTTaskHandle partner)
+	{
+		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+
+		if(!this->_canNotify(pos))
+		{
+			return false;
+		}
+
+		/**
+		 *	From here on we will be fine UNLESS the user provided an invalid FRTTTaskhandle! 
+		 */
+		
+		xTaskNotifyGive(this->_structCommPartners[pos].commPartner);	/* WILL ALWAYS RETURN pdPASS*/
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		FRTTCountUp(this->_tasksNotified);
+		#endif
+		
+		return true;
+	}
+
+	bool FRTTransceiver::NotifyBasic(FRTTLine line)
+	{
+		if(!this->_isValidLine(line) || !this->_canNotify(line.u8Slot))
+		{
+			return false;
+		}
+
+		xTaskNotifyGive(this->_structCommPartners[line.u8Slot].commPartner);	/* WILL ALWAYS RETURN pdPASS*/
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		FRTTCountUp(this->_tasksNotified);
+		#endif
+		
+		return true;
+	}
+
+	bool FRTTransceiver::NotifyExtended(FRTTTaskHandle partner,eFRTTNotifyActions action,uint32_t u32NotificationMask)
+	{
+		int pos = this->_getCommStruct(partner,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+
+		if(!this->_canNotify(pos))
+		{
+			return false;
+		}
+
+		return this->_notifyExtended(pos,action,u32NotificationMask);
+	}
+
+	bool FRTTransceiver::NotifyExtended(FRTTLine line,eFRTTNotifyActions action,uint32_t u32NotificationMask)
+	{
+		if(!this->_isValidLine(line) || !this->_canNotify(line.u8Slot))
+		{
+			return false;
+		}
+
+		return this->_notifyExtended(line.u8Slot,action,u32NotificationMask);
+	}
+
+	void FRTTransceiver::_ringDoorbell(uint8_t u8CommStructPos,int messagesBefore)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+
+		if(commLine.u32TxDoorbellMask == 0 || commLine.commPartner == nullptr || commLine.bReadOnlyCommunication)
+		{
+			return;
+		}
+
+		/**
+		 *	The reader may drain the line between our count and our write, another sender may write between our write and the count after it.
+		 *	Ringing up to one data package before the write covers a second sender racing us. With more senders on a line without a 
+		 *	tx semaphore nothing short of ringing every write is safe (FRTT::eFRTTDoorbell::e_SHAREDTXLINE).
+		 *	Ringing twice is harmless, the bits are only OR'ed into the notification value
+		 */
+		if(!commLine.bSharedTxDoorbell && messagesBefore > 1)
+		{
+			int messagesAfter = commLine.txRing ? this->_getAmountOfMessages(commLine.txRing) : this->_getAmountOfMessages(commLine.txQueue);
+
+			if(messagesAfter != 1)
+			{
+				return;
+			}
+		}
+
+		this->_notifyExtended(u8CommStructPos,eFRTTNotifyActions::e_SetBits,commLine.u32TxDoorbellMask);
+	}
+
+	bool FRTTransceiver::setDoorbell(FRTTLine line,eFRTTDoorbell side,uint32_t u32DoorbellMask)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return false;
+		}
+
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[line.u8Slot];
+
+		if(side == eFRTTDoorbell::e_RXLINE)
+		{
+			if(commLine.rxQueue == nullptr && commLine.rxRing == nullptr)
+			{
+				return false;
+			}
+
+			commLine.u32RxDoorbellMask = u32DoorbellMask;
+			return true;
+		}
+
+		if((commLine.txQueue == nullptr && commLine.txRing == nullptr) || commLine.bReadOnlyCommunication)
+		{
+			return false;
+		}
+
+		commLine.u32TxDoorbellMask = u32DoorbellMask;
+		commLine.bSharedTxDoorbell = (side == eFRTTDoorbell::e_SHAREDTXLINE);
+		return true;
+	}
+
+	int FRTTransceiver::drainDoorbellLines(uint32_t & u32Doorbells,int blockTimeTakeSemaphore_Ms)
+	{
+		TickType_t timeToWaitSemaphore;
+
+		if(!this->_bHasValidStruct || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore))
+		{
+			return -1;
+		}
+
+		uint32_t u32StillRinging = 0;
+		int read = 0;
+
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners && u32Doorbells != 0; u8I++)
+		{
+			FRTTCommunicationPartner & commLine = this->_structCommPartners[u8I];
+
+			if((commLine.u32RxDoorbellMask & u32Doorbells) == 0 || (commLine.rxQueue == nullptr && commLine.rxRing == nullptr) || !this->_canBufferData(u8I))
+			{
+				continue;
+			}
+
+			int lineRead = this->_readManyFromLine(u8I,commLine.u8RxQueueLength,0,timeToWaitSemaphore);
+
+			if(lineRead > 0)
+			{
+				read += lineRead;
+			}
+
+			if(this->_hasWaitingData(u8I))
+			{
+				u32StillRinging |= commLine.u32RxDoorbellMask;
+			}
+		}
+
+		u32Doorbells = u32StillRinging;
+		return read;
+	}
+
+	bool FRTTransceiver::_notifyExtended(uint8_t u8CommStructPos,eFRTTNotifyActions action,uint32_t u32NotificationMask)
+	{
+		return this->_notifyExtended(this->_structCommPartners[u8CommStructPos].commPartner,action,u32NotificationMask);
+	}
+
+	bool FRTTransceiver::_notifyExtended(FRTTTaskHandle task,eFRTTNotifyActions action,uint32_t u32NotificationMask)
+	{
+		if(!(action >= eFRTTNotifyActions::e_NoAction && action <= eFRTTNotifyActions::e_SetValueWithoutOverwrite))
+		{
+			#ifdef LOG_INFO
+			printf("You are not to notify your partner \nOne of the following things happened:\n"
+					"-[eFRTTNotifyAction is invalid in this case. Possible interval: [e_NoAction;e_SetValueWithoutOverwrite]]\n");
+			#endif
+			return false;
+		}
+
+		/**
+		 *	From here on we will be fine UNLESS the user provided an invalid FRTTTaskhandle! 
+		 */
+
+
+		/*
+
+				---> FREERTOS ENUM
+
+			typedef enum
+			{
+				eNoAction = 0,                
+				eSetBits,                     
+				eIncrement,                   
+				eSetValueWithOverwrite,       
+				eSetValueWithoutOverwrite     
+			} eNotifyAction;
+
+		*/
+
+		eNotifyAction freeRtosAction;//= (eNotifyAction)(static_cast<uint8_t>(action) - 2);
+
+		switch(action)
+		{
+			case eFRTTNotifyActions::e_NoAction:
+				freeRtosAction = eNoAction;
+				break;
+			case eFRTTNotifyActions::e_SetBits:
+				freeRtosAction = eSetBits;
+				break;
+			case eFRTTNotifyActions::e_Increment:
+				freeRtosAction = eIncrement;
+				break;
+			case eFRTTNotifyActions::e_SetValueWithOverwrite:
+				freeRtosAction = eSetValueWithOverwrite;
+				break;
+			case eFRTTNotifyActions::e_SetValueWithoutOverwrite:
+				freeRtosAction = eSetValueWithoutOverwrite;
+				break;
+			case eFRTTNotifyActions::e_CLEARCOUNTONEXIT:
+			case eFRTTNotifyActions::e_DECREMENTCOUNTONEXIT:
+			default:
+				/* Wont ever come to this situation because we check it in the if() above (e_CLEARCOUNTON***** not allowed here). 
+														Just so that the c++ compiler for the esp8266 doesnt throw -Werror=switch since we define more enumerators than freertos..!*/
+				freeRtosAction = eNoAction; /* randomly chosen */
+				break;
+		}
+		FRTTBaseType retVal =  xTaskNotify(task,u32NotificationMask,freeRtosAction);
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		if(retVal == pdTRUE) FRTTCountUp(this->_tasksNotified);
+		#endif
+
+		return (retVal == pdFAIL) ? false:true;
+	}
+
+	FRTTransceiver &  FRTTransceiver::NotifyReceiveBasic(eFRTTNotifyActions action,int blockTimeReceive_Ms)
+	{
+
+		blockTimeReceive_Ms = this->_checkWaitTime(blockTimeReceive_Ms);
+		
+		if(blockTimeReceive_Ms == -2 || !(action == eFRTTNotifyActions::e_CLEARCOUNTONEXIT || action == eFRTTNotifyActions::e_DECREMENTCOUNTONEXIT))
+		{  
+			return *this;
+		}
+
+		unsigned long timeToWaitReceive = (blockTimeReceive_Ms == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(blockTimeReceive_Ms));
+		
+		FRTTBaseType clearCount = (action == eFRTTNotifyActions::e_CLEARCOUNTONEXIT ? pdTRUE:pdFALSE);
+
+		uint32_t u32TempNotificationVal = ulTaskNotifyTake(clearCount,(TickType_t)timeToWaitReceive);
+		
+		/* 
+		   FreeRTOS lets the task wait in the blocked state until the notification value != 0 
+		   So value > 0 == notfication received.
+		*/
+
+		#ifdef LOG_INFO
+		if(!u32TempNotificationVal) printf("NotifyReceiveBasic: Nothing received!\n");
+		#endif
+
+		#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+		if(u32TempNotificationVal != 0) FRTTCountUp(this->_notificationsReceived);
+		#endif
+
+		this->_bHasNotification = (u32TempNotificationVal != 0 ? true:false);
+
+		this->_u32NotificationValue = u32TempNotificationVal;
+		return *this;
+	}
+
+	FRTTransceiver & FRTTransceiver::NotifyReceiveExtended(uint32_t u32ClearOnEntryMask,uint32_t u32ClearOnExitMask,int blockTimeReceive_Ms)
+	{
+		int timeToWaitReceive = this->_checkWaitTime(blockTimeReceive_Ms);
+
+		if(timeToWaitReceive == -2)
+		{
+			return *this;
+		}
+
+		timeToWaitReceive = (timeToWaitReceive == FRTTRANSCEIVER_WAITMAX ? portMAX_DELAY : pdMS_TO_TICKS(timeToWaitReceive));
+
+		FRTTBaseType retVal = xTaskNotifyWait(u32ClearOnEntryMask,u32ClearOnExitMask,&this->_u32NotificationValue,timeToWaitReceive);
+
+		if(retVal == pdTRUE)
+		{	
+			this->_bHasNotification = true;
+			#ifdef LOG_INFO
+			printf("Notfication received\n");
+			#endif
+
+			#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+			FRTTCountUp(this->_notificationsReceived);
+			#endif
+		}
+		else
+		{	
+			this->_bHasNotification = false;
+			#ifdef LOG_INFO
+			printf("Nothing received\n");
+			#endif
+		}
+
+		return *this;
+	}
+
+	void FRTTransceiver::setDatatypeTable(const FRTTDatatypeTable * table)
+	{
+		this->_datatypeTable = table;
+	}
+
+	bool FRTTransceiver::setDatatypeTable(FRTTLine line,const FRTTDatatypeTable * table)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return false;
+		}
+
+		this->_structCommPartners[line.u8Slot].datatypeTable = table;
+		return true;
+	}
+
+	int FRTTransceiver::dispatch(FRTTLine line)
+	{
+		if(!this->_isValidLine(line) || !this->_canBufferData(line.u8Slot))
+		{
+			return -1;
+		}
+
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[line.u8Slot];
+		const FRTTDatatypeTable * table = (commLine.datatypeTable ? commLine.datatypeTable : this->_datatypeTable);
+
+		if(table == nullptr)
+		{
+			return -1;
+		}
+
+		if(!commLine.bHasBufferedData)
+		{
+			return 0;
+		}
+
+		int dispatched = commLine.i16CurrTempcontainerPos + 1;
+
+		for(uint8_t u8I = 0; u8I < dispatched; u8I++)
+		{
+			const FRTTTempDataContainer & data = commLine.tempContainer[this->_bufferIndex(line.u8Slot,u8I)];
+
+			table->handlers[data.u8DataType](*this,line,data,table->context);
+			this->_releaseSlot(line.u8Slot,u8I);
+		}
+
+		commLine.bHasBufferedData = false;
+		commLine.bRxBufferFull = false;
+		commLine.i16CurrTempcontainerPos = -1;
+		commLine.u8BufferHead = 0;
+
+		return dispatched;
+	}
+
+	void FRTTransceiver::setNotificationHandlerTable(FRTTNotificationHandler * table)
+	{
+		this->_notificationHandlers = table;
+		this->_u32DispatchMask = 0;
+
+		if(table == nullptr)
+		{
+			return;
+		}
+
+		for(uint8_t u8Bit = 0; u8Bit < FRTTRANSCEIVER_NOTIFICATIONBITS; u8Bit++)
+		{
+			if(table[u8Bit].handler || table[u8Bit].line.u8Slot != FRTTRANSCEIVER_INVALIDLINE)
+			{
+				this->_u32DispatchMask |= (1u << u8Bit);
+			}
+		}
+	}
+
+	bool FRTTransceiver::bindNotificationBit(uint8_t u8Bit,FRTTLine line,fP_notificationHandler handler,void * context)
+	{
+		bool bHasLine = (line.u8Slot != FRTTRANSCEIVER_INVALIDLINE);
+
+		if(this->_notificationHandlers == nullptr || u8Bit >= FRTTRANSCEIVER_NOTIFICATIONBITS || (!bHasLine && handler == nullptr))
+		{
+			return false;
+		}
+
+		if(bHasLine && (!this->_isValidLine(line) || (this->_structCommPartners[line.u8Slot].rxQueue == nullptr && this->_structCommPartners[line.u8Slot].rxRing == nullptr)))
+		{
+			return false;
+		}
+
+		this->unbindNotificationBit(u8Bit);
+
+		this->_notificationHandlers[u8Bit].handler = handler;
+		this->_notificationHandlers[u8Bit].context = context;
+		this->_notificationHandlers[u8Bit].line = line;
+		this->_u32DispatchMask |= (1u << u8Bit);
+
+		if(bHasLine)
+		{
+			this->_structCommPartners[line.u8Slot].u32RxDoorbellMask = (1u << u8Bit);
+		}
+		return true;
+	}
+
+	bool FRTTransceiver::unbindNotificationBit(uint8_t u8Bit)
+	{
+		if(this->_notificationHandlers == nullptr || u8Bit >= FRTTRANSCEIVER_NOTIFICATIONBITS || !(this->_u32DispatchMask & (1u << u8Bit)))
+		{
+			return false;
+		}
+
+		FRTTNotificationHandler & entry = this->_notificationHandlers[u8Bit];
+
+		if(this->_isValidLine(entry.line) && this->_structCommPartners[entry.line.u8Slot].u32RxDoorbellMask == (1u << u8Bit))
+		{
+			this->_structCommPartners[entry.line.u8Slot].u32RxDoorbellMask = 0;
+		}
+
+		entry = FRTTNotificationHandler();
+		this->_u32DispatchMask &= ~(1u << u8Bit);
+		return true;
+	}
+
+	int FRTTransceiver::dispatchNotifications(int blockTimeReceive_Ms,int blockTimeTakeSemaphore_Ms)
+	{
+		TickType_t timeToWaitSemaphore;
+
+		if(this->_notificationHandlers == nullptr || !this->_toTicks(blockTimeTakeSemaphore_Ms,timeToWaitSemaphore) || this->_checkWaitTime(blockTimeReceive_Ms) == -2)
+		{
+			return -1;
+		}
+
+		if(!this->NotifyReceiveExtended(0,this->_u32DispatchMask,blockTimeReceive_Ms).hasNotification())
+		{
+			return 0;
+		}
+
+		uint32_t u32Pending = this->_u32NotificationValue & this->_u32DispatchMask;
+		uint32_t u32Rearm = 0;
+		int dispatched = 0;
+
+		while(u32Pending)
+		{
+			uint8_t u8Bit = __builtin_ctz(u32Pending);
+			u32Pending &= (u32Pending - 1);
+
+			FRTTNotificationHandler & entry = this->_notificationHandlers[u8Bit];
+
+			/* A line that was removed in the meantime is skipped, the handler still runs */
+			if(this->_isValidLine(entry.line) && this->_canBufferData(entry.line.u8Slot))
+			{
+				this->_readManyFromLine(entry.line.u8Slot,this->_structCommPartners[entry.line.u8Slot].u8RxQueueLength,0,timeToWaitSemaphore);
+
+				if(this->_hasWaitingData(entry.line.u8Slot))
+				{
+					u32Rearm |= (1u << u8Bit);
+				}
+			}
+
+			if(entry.handler)
+			{
+				entry.handler(*this,entry.line,entry.context);
+			}
+			dispatched++;
+		}
+
+		/* The sender only rings for an empty line, data left behind would otherwise never be dispatched */
+		if(u32Rearm)
+		{
+			this->_notifyExtended(xTaskGetCurrentTaskHandle(),eFRTTNotifyActions::e_SetBits,u32Rearm);
+		}
+
+		return dispatched;
+	}
+
+	uint32_t FRTTransceiver::getNotificationVal()
+	{
+		return this->_u32NotificationValue;
+	}
+
+	void FRTTransceiver::clearNotificationVal()
+	{
+		this->_u32NotificationValue = 0;
+	}
+
+	bool FRTTransceiver::hasNotification()
+	{
+		return this->_bHasNotification;
+	}
+
+	void FRTTransceiver::addDataAllocateCallback(void(*fP)(const FRTTDataContainerOnQueue &,FRTTTempDataContainer &))
+	{
+		this->_dataAllocator = fP;
+
+		#if (configUSE_QUEUE_SETS == 1)
+		/* Decides which rx lines can be read (see _canBufferData) */
+		this->_bRxQueueSetStale = (this->_rxQueueSet != nullptr) || this->_bRxQueueSetStale;
+		#endif
+	}
+
+
+	void FRTTransceiver::addDataFreeCallback(void (*fP)(FRTTTempDataContainer &))
+	{
+		this->_dataDestroyer = fP;
+
+		#if (configUSE_QUEUE_SETS == 1)
+		this->_bRxQueueSetStale = (this->_rxQueueSet != nullptr) || this->_bRxQueueSetStale;
+		#endif
+	}
+
+	bool FRTTransceiver::setOwnershipTransfer(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,bool bTakeOwnership)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		/* Switching while data is buffered would free data of the other mode with the wrong assumption */
+		if(pos == -1 || this->_structCommPartners[pos].bHasBufferedData)
+		{
+			return false;
+		}
+
+		this->_structCommPartners[pos].bTakeOwnership = bTakeOwnership;
+
+		#if (configUSE_QUEUE_SETS == 1)
+		this->_bRxQueueSetStale = (this->_rxQueueSet != nullptr) || this->_bRxQueueSetStale;
+		#endif
+		return true;
+	}
+
+	bool FRTTransceiver::setFireAndForget(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,bool bFireAndForget)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return false;
+		}
+
+		this->_structCommPartners[pos].bFireAndForget = bFireAndForget;
+		return true;
+	}
+
+	#ifdef FRTTRANSCEIVER_LATENCY_ENABLE
+	bool FRTTransceiver::getLatencyHistograms(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar,FRTTLineLatency & snapshot)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return false;
+		}
+
+		this->_copyLatency(this->_structCommPartners[pos].latency.queueWait,snapshot.queueWait);
+		this->_copyLatency(this->_structCommPartners[pos].latency.untilRelease,snapshot.untilRelease);
+		return true;
+	}
+
+	bool FRTTransceiver::getLatencyHistograms(FRTTLine line,FRTTLineLatency & snapshot)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return false;
+		}
+
+		this->_copyLatency(this->_structCommPartners[line.u8Slot].latency.queueWait,snapshot.queueWait);
+		this->_copyLatency(this->_structCommPartners[line.u8Slot].latency.untilRelease,snapshot.untilRelease);
+		return true;
+	}
+
+	bool FRTTransceiver::resetLatencyHistograms(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return false;
+		}
+
+		this->_clearLatency(this->_structCommPartners[pos].latency.queueWait);
+		this->_clearLatency(this->_structCommPartners[pos].latency.untilRelease);
+		return true;
+	}
+
+	bool FRTTransceiver::resetLatencyHistograms(FRTTLine line)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return false;
+		}
+
+		this->_clearLatency(this->_structCommPartners[line.u8Slot].latency.queueWait);
+		this->_clearLatency(this->_structCommPartners[line.u8Slot].latency.untilRelease);
+		return true;
+	}
+	#endif
+
+
+	const char * FRTTransceiver::_getPartnersName(FRTTTaskHandle partner,eMultiSenderQueue multiSenderQueue,bool bUseTaskHandleVar)
+	{  
+		/* _getCommStruct checks if a valid communication struct is available */
+		int pos = this->_getCommStruct(partner,multiSenderQueue,bUseTaskHandleVar);
+
+		if(pos == -1)
+		{
+			return "";
+		}
+
+		return this->_structCommPartners[pos].partnersName;
+	}
+
+	const char * FRTTransceiver::getPartnersName(FRTTLine line)
+	{
+		if(!this->_isValidLine(line))
+		{
+			return "";
+		}
+
+		return this->_structCommPartners[line.u8Slot].partnersName;
+	}
+
+	void FRTTransceiver::_setPartnersName(uint8_t u8CommStructPos,const char * name,const char * defaultName)
+	{
+		if(name == nullptr || name[0] == '\0')
+		{
+			name = defaultName;
+		}
+
+		/* strncpy() clears the rest of an older name, the last byte terminates a name that was cut off */
+		strncpy(this->_structCommPartners[u8CommStructPos].partnersName,name,FRTTRANSCEIVER_MAXPARTNERNAMELENGTH);
+		this->_structCommPartners[u8CommStructPos].partnersName[FRTTRANSCEIVER_MAXPARTNERNAMELENGTH] = '\0';
+	}
+
+	int FRTTransceiver::_getAmountOfQueues(bool bTxQueue)
+	{
+		if(!this->_bHasValidStruct) return -1;
+
+		int amount = 0;
+		for(uint8_t u8I = 0;u8I < this->_u8CurrCommPartners;u8I++)
+		{
+			if(bTxQueue)
+			{
+				if(!(this->_structCommPartners[u8I].txQueue == nullptr && this->_structCommPartners[u8I].txRing == nullptr)) amount++;
+			}
+			else
+			{
+				if(!(this->_structCommPartners[u8I].rxQueue == nullptr && this->_structCommPartners[u8I].rxRing == nullptr)) amount++;
+			}
+		}
+		return amount;
+	}
+
+	int FRTTransceiver::_checkWaitTime(int time_ms)
+	{
+		/* WAITMAX is defined as -1, If timeMs element of [-infinite;0[, than display error! */
+		if(time_ms < FRTTRANSCEIVER_WAITMAX || (time_ms > FRTTRANSCEIVER_WAITMAX && time_ms < 0))
+		{
+			#ifdef LOG_INFO
+			printf("Nothing sent [invalid wait time specified]\n");
+			#endif
+			return -2;
+		}
+		return time_ms;
+	}
+
+	bool FRTTransceiver::_checkValidQueueLength(uint8_t u8QueueLength,uint8_t u8Depth)
+	{
+		return !(u8QueueLength <= 0 || u8QueueLength > u8Depth);
+	}
+
+	void FRTTransceiver::_assignStorage(uint8_t u8CommStructPos,FRTTDataContainerOnQueue * txLineStorage,FRTTTempDataContainer * tempStorage,FRTTSharedPayload ** sharedStorage,uint8_t u8Depth)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+
+		/* nullptr: the line keeps its embedded buffers of size FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE */
+		commLine.txLineContainer = (txLineStorage ? txLineStorage : commLine.txLineStorage);
+		commLine.tempContainer = (tempStorage ? tempStorage : commLine.tempStorage);
+		commLine.sharedPayload = (sharedStorage ? sharedStorage : commLine.sharedStorage);
+		commLine.u8Depth = u8Depth;
+	}
+
+	uint8_t FRTTransceiver::_bufferIndex(uint8_t u8CommStructPos,uint8_t u8PositionInBuffer)
+	{
+		/* head + position reaches up to 2 * FRTTRANSCEIVER_MAXLINEDEPTH */
+		uint16_t u16Index = (uint16_t)this->_structCommPartners[u8CommStructPos].u8BufferHead + u8PositionInBuffer;
+
+		return (uint8_t)(u16Index >= this->_structCommPartners[u8CommStructPos].u8RxQueueLength ? u16Index - this->_structCommPartners[u8CommStructPos].u8RxQueueLength : u16Index);
+	}
+
+	void FRTTransceiver::_closeBufferGap(uint8_t u8CommStructPos,uint8_t u8PosRemoved)
+	{
+		FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+		uint8_t u8Newest = commLine.i16CurrTempcontainerPos;
+
+		if(u8PosRemoved < u8Newest - u8PosRemoved)
+		{
+			/* fewer elements in front of the gap: move them one step towards the newest entry, the head follows */
+			for(uint8_t u8I = u8PosRemoved; u8I > 0; u8I--)
+			{
+				uint8_t u8To = this->_bufferIndex(u8CommStructPos,u8I);
+				uint8_t u8From = this->_bufferIndex(u8CommStructPos,u8I - 1);
+
+				commLine.tempContainer[u8To] = commLine.tempContainer[u8From];
+				commLine.sharedPayload[u8To] = commLine.sharedPayload[u8From];
+			}
+			commLine.sharedPayload[commLine.u8BufferHead] = nullptr;
+			commLine.u8BufferHead = this->_bufferIndex(u8CommStructPos,1);
+		}
+		else
+		{
+			/* fewer elements behind the gap: move them one step towards the oldest entry */
+			for(uint8_t u8I = u8PosRemoved + 1; u8I <= u8Newest; u8I++)
+			{
+				uint8_t u8To = this->_bufferIndex(u8CommStructPos,u8I - 1);
+				uint8_t u8From = this->_bufferIndex(u8CommStructPos,u8I);
+
+				commLine.tempContainer[u8To] = commLine.tempContainer[u8From];
+				commLine.sharedPayload[u8To] = commLine.sharedPayload[u8From];
+			}
+			commLine.sharedPayload[this->_bufferIndex(u8CommStructPos,u8Newest)] = nullptr;
+		}
+	}
+
+	#ifdef FRTTRANSCEIVER_ANALYTICS_ENABLE
+
+	void FRTTransceiver::_fillLineStatistics(uint8_t u8CommStructPos,FRTTLineStatistics & lineStatistics)
+	{
+		const FRTTCommunicationPartner & commLine = this->_structCommPartners[u8CommStructPos];
+		/* Written by the owner task. A sample is good enough */
+		int16_t i16Newest = commLine.i16CurrTempcontainerPos;
+
+		lineStatistics.commPartner = commLine.commPartner;
+		lineStatistics.u32PackagesSent = commLine.dataPackagesSent.load(std::memory_order_relaxed);
+		lineStatistics.u32PackagesReceived = commLine.dataPackagesReceived.load(std::memory_order_relaxed);
+		lineStatistics.u32PackagesDropped = commLine.dataPackagesDropped.load(std::memory_order_relaxed);
+		lineStatistics.u8TxQueueLength = ((commLine.txQueue || commLine.txRing) ? commLine.u8TxQueueLength : 0);
+		lineStatistics.u8RxQueueLength = ((commLine.rxQueue || commLine.rxRing) ? commLine.u8RxQueueLength : 0);
+		lineStatistics.u8BufferedData = (i16Newest < 0 ? 0 : i16Newest + 1);
+		lineStatistics.bReadOnlyCommunication = commLine.bReadOnlyCommunication;
+		lineStatistics.bRing = (commLine.txRing || commLine.rxRing);
+	}
+
+	uint8_t FRTTransceiver::getStatistics(FRTTTransceiverStatistics & statistics,FRTTLineStatistics * lineStatistics,uint8_t u8MaxLines)
+	{
+		statistics.ownerAddress = this->_ownerAddress;
+		statistics.u8CommPartners = this->_u8CurrCommPartners;
+		statistics.u8MaxPartners = this->_u8MaxPartners;
+		statistics.u8MultiSenderQueues = this->_u8MultiSenderQueues;
+		statistics.u32Broadcasts = this->_broadcastCount.load(std::memory_order_relaxed);
+		statistics.u32NotificationsSent = this->_tasksNotified.load(std::memory_order_relaxed);
+		statistics.u32NotificationsReceived = this->_notificationsReceived.load(std::memory_order_relaxed);
+		statistics.runtimeTicks = xTaskGetTickCount() - this->_runtimeStart;
+
+		if(!this->_bHasValidStruct || lineStatistics == nullptr) return 0;
+
+		uint8_t u8Lines = (this->_u8CurrCommPartners < u8MaxLines ? this->_u8CurrCommPartners : u8MaxLines);
+
+		for(uint8_t u8I = 0; u8I < u8Lines; u8I++)
+		{
+			this->_fillLineStatistics(u8I,lineStatistics[u8I]);
+		}
+
+		return u8Lines;
+	}
+
+	void FRTTransceiver::printCommunicationsSummary()
+	{
+		if(!this->_bHasValidStruct) return;
+
+		FRTTTransceiverStatistics statistics;
+		FRTTLineStatistics lineStatistics;
+
+		this->getStatistics(statistics);
+
+		/* General Infos */
+
+		uint32_t u32RuntimeSec = (uint32_t)(statistics.runtimeTicks / configTICK_RATE_HZ);
+
+		printf("General Infos\n\n");
+		printf("\tOwner address            \t\t%p\n",statistics.ownerAddress == nullptr ? FRTTRANSCEIVER_UNKNOWNADDRESS : statistics.ownerAddress);
+		printf("\tCommunicationpartner     \t\t(%d out of %d)\n",statistics.u8CommPartners,statistics.u8MaxPartners);
+		printf("\t\t- - - > (%d of those read only)\n",statistics.u8MultiSenderQueues);
+		printf("\tMax partners             \t\t%d\n",statistics.u8MaxPartners);
+		printf("\tTX-QUEUE CONNECTIONS	   \t\t%d\n",this->_getAmountOfQueues(true));
+		printf("\tRX-QUEUES CONNECTIONS	   \t\t%d\n",this->_getAmountOfQueues(false));
+		printf("\tData callbacks available \t\t%s\n",this->_hasDataInterpreters() ? "yes":"no");
+		printf("\tBroadcasts made          \t\t%lu\n",(unsigned long)statistics.u32Broadcasts);
+		printf("\tNotifications received   \t\t%lu\n",(unsigned long)statistics.u32NotificationsReceived);
+		printf("\tNotifications sent   	   \t\t%lu\n",(unsigned long)statistics.u32NotificationsSent);
+		printf("\tLast notification value  \t\t%ld\n\n",(long int)this->getNotificationVal());
+		if(u32RuntimeSec >= 60)
+		{
+			printf("\tRunning for [%lu min]\n\n",(unsigned long)(u32RuntimeSec / 60));
+		}
+		else
+		{	
+			printf("\tRunning for [%lu sec]\n\n",(unsigned long)u32RuntimeSec);
+		}
+		/* Communication partners */
+		
+		for(uint8_t u8I = 0; u8I < this->_u8CurrCommPartners;u8I++)
+		{
+			this->_fillLineStatistics(u8I,lineStatistics);
+
+			printf("Line [%d]\n",u8I+1);
+			printf("\tName                    \t\t%s\n",this->_structCommPartners[u8I].partnersName);
+			printf("\tAddress                 \t\t%p\n",lineStatistics.commPartner == nullptr ? FRTTRANSCEIVER_UNKNOWNADDRESS : lineStatistics.commPartner);
+
+			if(!lineStatistics.bReadOnlyCommunication)
+			{
+				printf("\tComm-Type               \t\t%s\n",this->_ownerAddress == lineStatistics.commPartner ? FRTTRANSCEIVER_COMMTYPE3:FRTTRANSCEIVER_COMMTYPE1);
+			}
+			else
+			{
+				printf("\tComm-Type               \t\t%s\n",FRTTRANSCEIVER_COMMTYPE2);
+			}
+			printf("\tTX-LINE                 \t\t%s\n",lineStatistics.u8TxQueueLength == 0 ? "OFF" : (lineStatistics.bRing ? "ON (RING)":"ON"));
+			printf("\t\tLength                %d\n",lineStatistics.u8TxQueueLength);
+			printf("\tRX-LINE                 \t\t%s\n",lineStatistics.u8RxQueueLength == 0 ? "OFF" : (lineStatistics.bRing ? "ON (RING)":"ON"));
+			printf("\t\tLength                %d\n",lineStatistics.u8RxQueueLength);
+			printf("\tPackages sent           \t\t%lu\n",(unsigned long)lineStatistics.u32PackagesSent);
+			printf("\tPackages received       \t\t%lu\n",(unsigned long)lineStatistics.u32PackagesReceived);
+			printf("\tPackages dropped        \t\t%lu\n",(unsigned long)lineStatistics.u32PackagesDropped);
+			printf("\tHas buffered data       \t\t%s\n",lineStatistics.u8BufferedData > 0 ? "YES":"NO");
+			printf("\t\tAmount                %d\n",lineStatistics.u8BufferedData);
+		}
+		printf("\n\n");
+	}
+	#endif
+
+	FRTTransceiver::FRTTransceiver(FRTTTaskHandle ownerAddress, uint8_t u8MaxPartners)//: _bDelete(true), _bHasValidStruct(true)
+	{  
+		/* Can be null. Receivers wont know who you are then....*/
+		this->_ownerAddress = ownerAddress;
+		#if defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+		this->_u8SenderId = FRTTSenderId(ownerAddress);
+		#endif
+		
+		u8MaxPartners = (u8MaxPartners == 0 ? 1:u8MaxPartners);
+
+		this->_u8MaxPartners = u8MaxPartners;
+		this->_structCommPartners = new (std::nothrow) struct FRTTCommunicationPartner[u8MaxPartners];
+
+		if(this->_structCommPartners != nullptr)
+		{
+			this->_bDelete = true;
+			this->_bHasValidStruct = true;
+		}
+	}
+
+	FRTTransceiver::~FRTTransceiver()
+	{
+		#if (configUSE_QUEUE_SETS == 1)
+		/* A queue still holding data can not leave the set. The set is kept then, the queue would point to freed memory otherwise */
+		if(this->_rxQueueSet && !this->_dropRxQueueSet())
+		{
+			#ifdef LOG_INFO
+			printf("Queue set not deleted [rx queue still holds data]\n");
+			#endif
+		}
+		#endif
+
+		if(this->_bDelete)
+		{
+			delete[] this->_structCommPartners;
+		}
+	}
+}
 #endif
\ No newline at end of file
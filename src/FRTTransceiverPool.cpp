@@ -0,0 +1,194 @@
+#ifndef FRTTRANSCEIVERPOOL_CPP
+#define FRTTRANSCEIVERPOOL_CPP
+
+/*!
+ * \file       	FRTTransceiverPool.cpp
+ * \brief      	Fixed-block payload pools implementation
+ * \author     	Xhemail Ramabaja (x.ramabaja@outlook.de)
+ * \version 	   v1.2.0
+ * \copyright  	Copyright 2022 Xhemail Ramabaja
+ */
+
+#include "../include/FRTTransceiverPool.h"
+#include <cstdio>
+#include <cstring>
+
+//#define LOG_INFO
+namespace FRTT {
+
+	/*! \brief Index marking the end of the free stack */
+	#define FRTTRANSCEIVER_POOLEND (0xFFFFu)
+
+	/*! \brief Pool and payload size the ready-made callbacks use for one datatype */
+	struct FRTTPoolRegistryEntry
+	{
+		FRTTPool * pool = nullptr;
+		uint16_t u16PayloadSize = 0;
+	};
+
+	static FRTTPoolRegistryEntry _poolRegistry[FRTTRANSCEIVER_POOLDATATYPES];
+
+	FRTTPool::FRTTPool(void * storage,uint16_t u16BlockSize,uint16_t u16Blocks):	_pu8Storage((uint8_t *)storage),
+																				_u16BlockSize(u16BlockSize),
+																				_u16Blocks(u16Blocks)
+	{
+		if(storage == nullptr || u16BlockSize < sizeof(uint16_t) || u16Blocks == 0 || u16Blocks >= FRTTRANSCEIVER_POOLEND)
+		{
+			#ifdef LOG_INFO
+			printf("Pool dimensions are invalid. Pool is empty\n");
+			#endif
+			this->_u16Blocks = 0;
+			this->_u32Head.store(FRTTRANSCEIVER_POOLEND,std::memory_order_relaxed);
+			return;
+		}
+
+		/* Chain all blocks: block i points to block i + 1 */
+		for(uint16_t u16I = 0; u16I < u16Blocks; u16I++)
+		{
+			uint16_t u16Next = (u16I + 1 < u16Blocks ? u16I + 1 : FRTTRANSCEIVER_POOLEND);
+			memcpy(this->_pu8Storage + (uint32_t)u16I * u16BlockSize,&u16Next,sizeof(uint16_t));
+		}
+
+		this->_u32Head.store(0,std::memory_order_release);
+	}
+
+	void * FRTTPool::allocate()
+	{
+		uint32_t u32Head = this->_u32Head.load(std::memory_order_acquire);
+		uint16_t u16Next;
+
+		do
+		{
+			uint16_t u16Index = (uint16_t)(u32Head & 0xFFFFu);
+
+			if(u16Index == FRTTRANSCEIVER_POOLEND)
+			{
+				this->_u32Exhausted.fetch_add(1,std::memory_order_relaxed);
+				#ifdef LOG_INFO
+				printf("Pool exhausted (block size %u)\n",this->_u16BlockSize);
+				#endif
+				return nullptr;
+			}
+
+			/* May read a block another task just took. The tag makes the exchange below fail in that case */
+			memcpy(&u16Next,this->_pu8Storage + (uint32_t)u16Index * this->_u16BlockSize,sizeof(uint16_t));
+
+		} while(!this->_u32Head.compare_exchange_weak(u32Head,((u32Head & 0xFFFF0000u) + 0x10000u) | u16Next,std::memory_order_acq_rel,std::memory_order_acquire));
+
+		uint16_t u16InUse = this->_u16InUse.fetch_add(1,std::memory_order_relaxed) + 1;
+		uint16_t u16HighWater = this->_u16HighWater.load(std::memory_order_relaxed);
+
+		while(u16InUse > u16HighWater && !this->_u16HighWater.compare_exchange_weak(u16HighWater,u16InUse,std::memory_order_relaxed));
+
+		return this->_pu8Storage + (uint32_t)(u32Head & 0xFFFFu) * this->_u16BlockSize;
+	}
+
+	void FRTTPool::release(void * block)
+	{
+		if(!this->owns(block))
+		{
+			#ifdef LOG_INFO
+			if(block) printf("Block does not belong to this pool\n");
+			#endif
+			return;
+		}
+
+		uint16_t u16Index = (uint16_t)(((uint8_t *)block - this->_pu8Storage) / this->_u16BlockSize);
+		uint32_t u32Head = this->_u32Head.load(std::memory_order_relaxed);
+
+		do
+		{
+			uint16_t u16Next = (uint16_t)(u32Head & 0xFFFFu);
+			memcpy(block,&u16Next,sizeof(uint16_t));
+
+		} while(!this->_u32Head.compare_exchange_weak(u32Head,((u32Head & 0xFFFF0000u) + 0x10000u) | u16Index,std::memory_order_release,std::memory_order_relaxed));
+
+		this->_u16InUse.fetch_sub(1,std::memory_order_relaxed);
+	}
+
+	bool FRTTPool::owns(const void * block) const
+	{
+		const uint8_t * pu8Block = (const uint8_t *)block;
+
+		if(block == nullptr || pu8Block < this->_pu8Storage || pu8Block >= this->_pu8Storage + (uint32_t)this->_u16Blocks * this->_u16BlockSize)
+		{
+			return false;
+		}
+
+		return ((pu8Block - this->_pu8Storage) % this->_u16BlockSize) == 0;
+	}
+
+	FRTTPoolStatistics FRTTPool::getStatistics() const
+	{
+		FRTTPoolStatistics statistics;
+
+		statistics.u16BlockSize = this->_u16BlockSize;
+		statistics.u16Blocks = this->_u16Blocks;
+		statistics.u16InUse = this->_u16InUse.load(std::memory_order_relaxed);
+		statistics.u16HighWater = this->_u16HighWater.load(std::memory_order_relaxed);
+		statistics.u32Exhausted = this->_u32Exhausted.load(std::memory_order_relaxed);
+
+		return statistics;
+	}
+
+	void FRTTPool::resetStatistics()
+	{
+		this->_u16HighWater.store(this->_u16InUse.load(std::memory_order_relaxed),std::memory_order_relaxed);
+		this->_u32Exhausted.store(0,std::memory_order_relaxed);
+	}
+
+	bool FRTTPoolRegister(uint8_t u8DataType,FRTTPool & pool,uint16_t u16PayloadSize)
+	{
+		if(u8DataType >= FRTTRANSCEIVER_POOLDATATYPES || u16PayloadSize == 0 || u16PayloadSize > pool.blockSize())
+		{
+			#ifdef LOG_INFO
+			printf("Datatype or payload size invalid for the pool\n");
+			#endif
+			return false;
+		}
+
+		_poolRegistry[u8DataType].pool = &pool;
+		_poolRegistry[u8DataType].u16PayloadSize = u16PayloadSize;
+		return true;
+	}
+
+	void FRTTPoolAllocateCallback(const FRTTDataContainerOnQueue & orig,FRTTTempDataContainer & temp)
+	{
+		temp = orig;
+		temp.data = nullptr;
+
+		if(orig.u8DataType >= FRTTRANSCEIVER_POOLDATATYPES || _poolRegistry[orig.u8DataType].pool == nullptr || orig.data == nullptr)
+		{
+			#ifdef LOG_INFO
+			printf("No pool registered for datatype %u\n",orig.u8DataType);
+			#endif
+			temp.u8Flags |= FRTTRANSCEIVER_FLAG_REJECTED;
+			return;
+		}
+
+		void * block = _poolRegistry[orig.u8DataType].pool->allocate();
+
+		if(block)
+		{
+			memcpy(block,orig.data,_poolRegistry[orig.u8DataType].u16PayloadSize);
+			temp.data = block;
+		}
+		else
+		{
+			/* Pool exhausted, the data package is dropped instead of buffered without data */
+			temp.u8Flags |= FRTTRANSCEIVER_FLAG_REJECTED;
+		}
+	}
+
+	void FRTTPoolFreeCallback(FRTTTempDataContainer & temp)
+	{
+		if(temp.data == nullptr || temp.u8DataType >= FRTTRANSCEIVER_POOLDATATYPES || _poolRegistry[temp.u8DataType].pool == nullptr)
+		{
+			return;
+		}
+
+		_poolRegistry[temp.u8DataType].pool->release(temp.data);
+		temp.data = nullptr;
+	}
+}
+#endif
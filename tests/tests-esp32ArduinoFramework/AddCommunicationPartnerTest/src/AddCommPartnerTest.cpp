@@ -1,160 +1,279 @@
-
-#include <AUnit.h>
-#include "FRTTransceiver.h"
-#include "AddCommPartnerTest.h"
-
-using namespace aunit;
-
-/* No need to check the dynamic version since the library handles everything on its own without us getting access from the outside */
-#if (DYNAMIC_STRUCTARRAY == 0)
-test(constructor)
-{
-    
-        FRTTCommunicationPartner partners5[1];
-
-        FRTTransceiver comm4(T_VALID,nullptr,15);          /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously  */
-        FRTTransceiver comm5(T_VALID,&partners5[0],0);     /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously  */
-
-        assertEqual(comm4.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,PARTNERNAME),false);   /* we didnt provide a valid communication struct (see ~2 lines above)           */
-        assertEqual(comm5.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,PARTNERNAME),false);   /* we didnt provide a valid struct length (see ~2 lines above)                  */
-    
-}
-#endif
-
-
-test(allPossibleParams)
-{   
-    #if (DYNAMIC_STRUCTARRAY == 1)
-    FRTTransceiver comm(T_VALID,5); /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
-    #else
-    FRTTCommunicationPartner partners[5];
-    FRTTransceiver comm(T_VALID,&partners[0],5);    /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
-    #endif
-
-    /* Partner tasks must be distinguishable */
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID2,1,S_VALID2,PARTNERNAME),true);                       /* 4 Left   */     
-    assertEqual(comm.addCommPartner(T_VALID2,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),true);          /* 3 LEFT   */ 
-
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID,1,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);           /* RX Queue exists               (rx)    */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID2,1,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* RX Queue exists               (tx)    */  
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* SEM-RX nullptr                        */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);            /* SEM-exists butt already taken (rx)    */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID2,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);           /* SEM-exists butt already taken (tx)    */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,700,S_VALID3,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);         /* wrong queue length                    */
-
-    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID,0,S_INVALID,PARTNERNAME_EMPTY),false);           /* TX Queue exists               (rx)    */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID2,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* TX Queue exists               (tx)    */  
-    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* SEM-RX nullptr                        */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,0,S_VALID,PARTNERNAME_EMPTY),false);            /* SEM-exists butt already taken (rx)    */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,0,S_VALID2,PARTNERNAME_EMPTY),false);           /* SEM-exists butt already taken (tx)    */
-    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,152,S_VALID3,PARTNERNAME_EMPTY),false);         /* wrong queue length                    */
-
-    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),true);        /* 2 LEFT   */
-    assertEqual(comm.addCommPartner(T_VALID4,Q_INVALID,0,S_INVALID,Q_VALID4,2,S_VALID4,PARTNERNAME_EMPTY),true);        /* 1 LEFT   */
-    assertEqual(comm.addCommPartner(T_VALID5,Q_VALID5,1,S_VALID5,Q_VALID6,2,S_VALID6,PARTNERNAME_EMPTY),true);          /* 0 LEFT   */
-    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
-    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
-    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
-    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
-
-    #if (DYNAMIC_STRUCTARRAY == 1)
-    FRTTransceiver comm2(T_VALID,6); /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
-    #else
-    FRTTCommunicationPartner partners2[6];
-    FRTTransceiver comm2(T_VALID,&partners2[0],6);    /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
-    #endif
-
-
-    
-    assertEqual(comm2.addCommPartner(T_VALID,Q_INVALID,0,S_INVALID,Q_VALID3,1,S_VALID3,PARTNERNAME),true);  /* 5 left, to have tx queue & semph */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID,1,S_VALID,PARTNERNAME),true);                           /* 4 left */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID2,1,S_VALID2,PARTNERNAME),true);                         /* 3 left */
-
-    assertEqual(comm2.addMultiSenderPartner(Q_INVALID,0,S_INVALID,PARTNERNAME),false);                      /* Queue nullptr        */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID,0,S_INVALID,PARTNERNAME),false);                        /* Queue exists rx      */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID3,0,S_INVALID,PARTNERNAME),false);                       /* Queue exists tx      */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,0,S_INVALID,PARTNERNAME),false);                       /* SMPH nullptr         */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,0,S_VALID3,PARTNERNAME),false);                        /* SMPH exists tx       */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,0,S_VALID2,PARTNERNAME),false);                        /* SMPH exists rx       */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,124,S_VALID4,PARTNERNAME),false);                      /* wrong queue length   */
-
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,1,S_VALID4,PARTNERNAME),true);                         /* 2 left */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID5,1,S_VALID5,PARTNERNAME),true);                         /* 1 left */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6),true);                                     /* 0 left */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6),false);                                    /* 0 left */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6),false);                                    /* 0 left */
-}
-
-                              
-test(combinedAdditionToCommunicationList)
-{
-    #if (DYNAMIC_STRUCTARRAY == 1)
-    FRTTransceiver comm(T_VALID,4); // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
-    #else
-    FRTTCommunicationPartner partners[4];
-    FRTTransceiver comm(T_VALID,&partners[0],4);    // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
-    #endif
-
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),true);
-    assertEqual(comm.addMultiSenderPartner(Q_VALID2,1,S_VALID2,PARTNERNAME),true);
-
-    assertEqual(comm.addMultiSenderPartner(Q_INVALID,1,S_INVALID,PARTNERNAME),false); 
-    assertEqual(comm.addCommPartner(T_INVALID,Q_INVALID,1,S_INVALID,Q_INVALID,1,S_INVALID,PARTNERNAME),false);
-
-    assertEqual(comm.addMultiSenderPartner(Q_VALID3,1,S_VALID3,PARTNERNAME),true);
-    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID4,1,S_VALID4,Q_VALID5,1,S_VALID5,PARTNERNAME),true);
-
-    assertEqual(comm.addMultiSenderPartner(Q_VALID,1,S_VALID,PARTNERNAME),false);
-    assertEqual(comm.addCommPartner(T_VALID + 0x2,Q_VALID,1,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),false);
-}
-
-                                   
-test(queueLengthTest)
-{
-    /* Only works with FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE == 3*/
-
-    #if (DYNAMIC_STRUCTARRAY == 1)
-    FRTTransceiver comm(T_VALID,2); // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
-    #else
-    FRTTCommunicationPartner partners[2];
-    FRTTransceiver comm(T_VALID,&partners[0],2);    // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
-    #endif
-
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,4,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),false);
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID,4,S_VALID,PARTNERNAME),false);
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,0,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),false);
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID,0,S_VALID,PARTNERNAME),false);
-
-    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE,S_VALID,Q_VALID2,1,S_VALID2,PARTNERNAME),true);        /* 1 LEFT */
-
-    assertEqual(comm.addMultiSenderPartner(Q_VALID3,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE + 1,S_VALID3,PARTNERNAME),false);
-    assertEqual(comm.addMultiSenderPartner(Q_VALID3,0,S_VALID3,PARTNERNAME),false);
-
-    assertEqual(comm.addMultiSenderPartner(Q_VALID3,2,S_VALID3,PARTNERNAME),true);                                                               /* 0 Left */
-
-
-    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID4,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE,S_VALID4,Q_VALID5,1,S_VALID5,PARTNERNAME),false);     /* 0 Left...*/
-}
-
-
-void setup()
-{
-    vTaskDelay(pdMS_TO_TICKS(2500));
-    Serial.begin(115200);               // For the internal printer of TestRunner
-    while(!Serial);                     
-    log_i("\n\n");
-    
-    log_i("This test should produce the following:");
-    #if (DYNAMIC_STRUCTARRAY == 0)
-    log_i("4 passed, 0 failed, 0 skipped, 0 timed out, out of 4 test(s).");
-    #elif (DYNAMIC_STRUCTARRAY == 1 )
-    log_i("3 passed, 0 failed, 0 skipped, 0 timed out, out of 3 test(s).");
-    #endif
-    log_i("----------\n\n");
-}
-
-
-void loop()
-{
-    TestRunner::run();
+
+#include <AUnit.h>
+#include "FRTTransceiver.h"
+#include "AddCommPartnerTest.h"
+
+using namespace aunit;
+
+/* No need to check the dynamic version since the library handles everything on its own without us getting access from the outside */
+#if (DYNAMIC_STRUCTARRAY == 0)
+test(constructor)
+{
+    
+        FRTTCommunicationPartner partners5[1];
+
+        FRTTransceiver comm4(T_VALID,nullptr,15);          /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously  */
+        FRTTransceiver comm5(T_VALID,&partners5[0],0);     /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously  */
+
+        assertEqual(comm4.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,PARTNERNAME),false);   /* we didnt provide a valid communication struct (see ~2 lines above)           */
+        assertEqual(comm5.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,PARTNERNAME),false);   /* we didnt provide a valid struct length (see ~2 lines above)                  */
+    
+}
+#endif
+
+
+test(allPossibleParams)
+{   
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,5); /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
+    #else
+    FRTTCommunicationPartner partners[5];
+    FRTTransceiver comm(T_VALID,&partners[0],5);    /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
+    #endif
+
+    /* Partner tasks must be distinguishable */
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID2,1,S_VALID2,PARTNERNAME),true);                       /* 4 Left   */     
+    assertEqual(comm.addCommPartner(T_VALID2,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),true);          /* 3 LEFT   */ 
+
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID,1,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);           /* RX Queue exists               (rx)    */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID2,1,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* RX Queue exists               (tx)    */  
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* SEM-RX nullptr                        */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);            /* SEM-exists butt already taken (rx)    */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID2,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);           /* SEM-exists butt already taken (tx)    */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,700,S_VALID3,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);         /* wrong queue length                    */
+
+    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID,0,S_INVALID,PARTNERNAME_EMPTY),false);           /* TX Queue exists               (rx)    */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID2,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* TX Queue exists               (tx)    */  
+    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,0,S_INVALID,PARTNERNAME_EMPTY),false);          /* SEM-RX nullptr                        */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,0,S_VALID,PARTNERNAME_EMPTY),false);            /* SEM-exists butt already taken (rx)    */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,0,S_VALID2,PARTNERNAME_EMPTY),false);           /* SEM-exists butt already taken (tx)    */
+    assertEqual(comm.addCommPartner(T_VALID3,Q_INVALID,0,S_INVALID,Q_VALID3,152,S_VALID3,PARTNERNAME_EMPTY),false);         /* wrong queue length                    */
+
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),true);        /* 2 LEFT   */
+    assertEqual(comm.addCommPartner(T_VALID4,Q_INVALID,0,S_INVALID,Q_VALID4,2,S_VALID4,PARTNERNAME_EMPTY),true);        /* 1 LEFT   */
+    assertEqual(comm.addCommPartner(T_VALID5,Q_VALID5,1,S_VALID5,Q_VALID6,2,S_VALID6,PARTNERNAME_EMPTY),true);          /* 0 LEFT   */
+    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
+    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
+    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
+    assertEqual(comm.addCommPartner(T_VALID6,Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),false);     /* Should block right away: no more connections   */
+
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm2(T_VALID,6); /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
+    #else
+    FRTTCommunicationPartner partners2[6];
+    FRTTransceiver comm2(T_VALID,&partners2[0],6);    /* In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously */
+    #endif
+
+
+    
+    assertEqual(comm2.addCommPartner(T_VALID,Q_INVALID,0,S_INVALID,Q_VALID3,1,S_VALID3,PARTNERNAME),true);  /* 5 left, to have tx queue & semph */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID,1,S_VALID,PARTNERNAME),true);                           /* 4 left */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID2,1,S_VALID2,PARTNERNAME),true);                         /* 3 left */
+
+    assertEqual(comm2.addMultiSenderPartner(Q_INVALID,0,S_INVALID,PARTNERNAME),false);                      /* Queue nullptr        */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID,0,S_INVALID,PARTNERNAME),false);                        /* Queue exists rx      */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID3,0,S_INVALID,PARTNERNAME),false);                       /* Queue exists tx      */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,0,S_INVALID,PARTNERNAME),false);                       /* SMPH nullptr         */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,0,S_VALID3,PARTNERNAME),false);                        /* SMPH exists tx       */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,0,S_VALID2,PARTNERNAME),false);                        /* SMPH exists rx       */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,124,S_VALID4,PARTNERNAME),false);                      /* wrong queue length   */
+
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID4,1,S_VALID4,PARTNERNAME),true);                         /* 2 left */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID5,1,S_VALID5,PARTNERNAME),true);                         /* 1 left */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6),true);                                     /* 0 left */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6),false);                                    /* 0 left */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6),false);                                    /* 0 left */
+}
+
+                              
+test(combinedAdditionToCommunicationList)
+{
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,4); // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
+    #else
+    FRTTCommunicationPartner partners[4];
+    FRTTransceiver comm(T_VALID,&partners[0],4);    // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
+    #endif
+
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),true);
+    assertEqual(comm.addMultiSenderPartner(Q_VALID2,1,S_VALID2,PARTNERNAME),true);
+
+    assertEqual(comm.addMultiSenderPartner(Q_INVALID,1,S_INVALID,PARTNERNAME),false); 
+    assertEqual(comm.addCommPartner(T_INVALID,Q_INVALID,1,S_INVALID,Q_INVALID,1,S_INVALID,PARTNERNAME),false);
+
+    assertEqual(comm.addMultiSenderPartner(Q_VALID3,1,S_VALID3,PARTNERNAME),true);
+    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID4,1,S_VALID4,Q_VALID5,1,S_VALID5,PARTNERNAME),true);
+
+    assertEqual(comm.addMultiSenderPartner(Q_VALID,1,S_VALID,PARTNERNAME),false);
+    assertEqual(comm.addCommPartner(T_VALID + 0x2,Q_VALID,1,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),false);
+}
+
+                                   
+test(queueLengthTest)
+{
+    /* Only works with FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE == 3*/
+
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,2); // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
+    #else
+    FRTTCommunicationPartner partners[2];
+    FRTTransceiver comm(T_VALID,&partners[0],2);    // In this current version of the library it doesnt matter if we add a valid owners address or not. A task can work anonymously 
+    #endif
+
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,4,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),false);
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID,4,S_VALID,PARTNERNAME),false);
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,0,S_VALID,Q_VALID,1,S_VALID,PARTNERNAME),false);
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,Q_VALID,0,S_VALID,PARTNERNAME),false);
+
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE,S_VALID,Q_VALID2,1,S_VALID2,PARTNERNAME),true);        /* 1 LEFT */
+
+    assertEqual(comm.addMultiSenderPartner(Q_VALID3,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE + 1,S_VALID3,PARTNERNAME),false);
+    assertEqual(comm.addMultiSenderPartner(Q_VALID3,0,S_VALID3,PARTNERNAME),false);
+
+    assertEqual(comm.addMultiSenderPartner(Q_VALID3,2,S_VALID3,PARTNERNAME),true);                                                               /* 0 Left */
+
+
+    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID4,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE,S_VALID4,Q_VALID5,1,S_VALID5,PARTNERNAME),false);     /* 0 Left...*/
+}
+
+
+test(partnerLookup)
+{
+    /* More partners than FRTTRANSCEIVER_PARTNERINDEXSIZE, so that some of them are only reachable via the linear fallback */
+
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,FRTTRANSCEIVER_PARTNERINDEXSIZE + 8);
+    #else
+    FRTTCommunicationPartner partners[FRTTRANSCEIVER_PARTNERINDEXSIZE + 8];
+    FRTTransceiver comm(T_VALID,&partners[0],FRTTRANSCEIVER_PARTNERINDEXSIZE + 8);
+    #endif
+
+    for(uintptr_t u8I = 1; u8I <= FRTTRANSCEIVER_PARTNERINDEXSIZE + 8;u8I++)
+    {
+        assertEqual(comm.addCommPartner((FRTTTaskHandle)(u8I * 0x10),Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID,PARTNERNAME_EMPTY),true);
+    }
+
+    for(uintptr_t u8I = 1; u8I <= FRTTRANSCEIVER_PARTNERINDEXSIZE + 8;u8I++)
+    {
+        assertEqual(comm.bufferedDataFrom((FRTTTaskHandle)(u8I * 0x10),eMultiSenderQueue::eNOMULTIQSELECTED,true),0);     /* Partner known, no data                */
+        assertEqual(comm.addCommPartner((FRTTTaskHandle)(u8I * 0x10),Q_INVALID,0,S_INVALID,Q_INVALID,0,S_INVALID),false); /* Partner already added                */
+    }
+
+    assertEqual(comm.bufferedDataFrom((FRTTTaskHandle)0x8,eMultiSenderQueue::eNOMULTIQSELECTED,true),-1);                   /* Unknown partner                      */
+    assertEqual(comm.bufferedDataFrom(T_INVALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),-1);                             /* nullptr is never a partner           */
+}
+
+
+test(lineStorageDepth)
+{
+    /* Lines with their own storage are limited by its depth instead of FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE */
+
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,3);
+    #else
+    FRTTCommunicationPartner partners[3];
+    FRTTransceiver comm(T_VALID,&partners[0],3);
+    #endif
+
+    static FRTTLineStorage<64> telemetry;
+    static FRTTLineStorage<1> control;
+
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,65,S_VALID,Q_VALID2,1,S_VALID2,telemetry,PARTNERNAME),false);                /* DEEPER THAN STORAGE */
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,64,S_VALID,Q_VALID2,64,S_VALID2,telemetry,PARTNERNAME),true);                /* 2 LEFT */
+
+    assertEqual(comm.addMultiSenderPartner(Q_VALID3,2,S_VALID3,control,PARTNERNAME),false);                                     /* DEEPER THAN STORAGE */
+    assertEqual(comm.addMultiSenderPartner(Q_VALID3,1,S_VALID3,control,PARTNERNAME),true);                                      /* 1 LEFT */
+
+    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID4,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE + 1,S_VALID4,nullptr,0,nullptr,PARTNERNAME),false);   /* EMBEDDED STORAGE */
+    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID4,FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE,S_VALID4,nullptr,0,nullptr,PARTNERNAME),true);       /* 0 LEFT */
+}
+
+test(partnerNames)
+{
+    /* Names are copied into the line, cut off at FRTTRANSCEIVER_MAXPARTNERNAMELENGTH and replaced by the default names when missing */
+
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,4);
+    #else
+    FRTTCommunicationPartner partners[4];
+    FRTTransceiver comm(T_VALID,&partners[0],4);
+    #endif
+
+    char name[FRTTRANSCEIVER_MAXPARTNERNAMELENGTH + 8];
+    memset(name,'N',sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+
+    assertEqual(comm.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,PARTNERNAME),true);
+    assertEqual(comm.addCommPartner(T_VALID2,Q_VALID2,1,S_VALID2,nullptr,0,nullptr),true);
+    assertEqual(comm.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,nullptr,0,nullptr,name),true);
+    assertEqual(comm.addMultiSenderPartner(Q_VALID4,1,S_VALID4),true);
+
+    name[0] = 'X';                                                                                                              /* CALLER BUFFER IS NOT REFERENCED */
+
+    assertEqual(strcmp(comm.getPartnersName(comm.getLine(T_VALID)),PARTNERNAME),0);
+    assertEqual(strcmp(comm.getPartnersName(comm.getLine(T_VALID2)),FRTTRANSCEIVER_DEFAULTPARTNERNAME),0);
+    assertEqual(strlen(comm.getPartnersName(comm.getLine(T_VALID3))),(size_t)FRTTRANSCEIVER_MAXPARTNERNAMELENGTH);            /* CUT OFF */
+    assertEqual(comm.getPartnersName(comm.getLine(T_VALID3))[0],'N');
+    assertEqual(strcmp(comm.getPartnersName(comm.getLine(eMultiSenderQueue::eMULTISENDERQ0)),FRTTRANSCEIVER_DEFAULTPARTNERNAMEMULTISENDERQUEUE),0);
+    assertEqual(strcmp(comm.getPartnersName(comm.getLine(T_VALID4)),""),0);                                                     /* UNKNOWN LINE */
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+void staticTask(void * parameter)
+{
+    vTaskDelete(NULL);
+}
+
+test(staticAllocation)
+{
+    /* Queues, semaphores and tasks in memory fixed at link time */
+
+    #if (DYNAMIC_STRUCTARRAY == 1)
+    FRTTransceiver comm(T_VALID,1);
+    #else
+    FRTTCommunicationPartner partners[1];
+    FRTTransceiver comm(T_VALID,&partners[0],1);
+    #endif
+
+    static FRTTStaticQueue<2> queueStorage;
+    static FRTTStaticSemaphore semaphoreStorage;
+    static FRTTStaticTask<2048> taskStorage;
+    FRTTTaskHandle task = nullptr;
+
+    assertTrue(FRTTCreateQueueStatic(0,queueStorage.au8Storage,&queueStorage.queueBuffer) == nullptr);                          /* INVALID LENGTH */
+    assertTrue(FRTTCreateQueueStatic(2,nullptr,&queueStorage.queueBuffer) == nullptr);                                           /* NO STORAGE */
+
+    FRTTQueueHandle queue = FRTTCreateQueueStatic(queueStorage);
+    FRTTSemaphoreHandle semaphore = FRTTCreateSemaphoreStatic(semaphoreStorage);
+
+    assertTrue(queue != nullptr);
+    assertTrue(semaphore != nullptr);
+    assertEqual(comm.addCommPartner(T_VALID,queue,2,semaphore,nullptr,0,nullptr,PARTNERNAME),true);
+
+    assertEqual(FRTTCreateTaskStatic(staticTask,"STATIC",taskStorage,nullptr,1,&task,0),true);
+    assertTrue(task != nullptr);
+}
+#endif
+
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    while(!Serial);                     
+    log_i("\n\n");
+    
+    log_i("This test should produce the following:");
+    #if (DYNAMIC_STRUCTARRAY == 0)
+    log_i("8 passed, 0 failed, 0 skipped, 0 timed out, out of 8 test(s).");
+    #elif (DYNAMIC_STRUCTARRAY == 1 )
+    log_i("7 passed, 0 failed, 0 skipped, 0 timed out, out of 7 test(s).");
+    #endif
+    log_i("----------\n\n");
+}
+
+
+void loop()
+{
+    TestRunner::run();
 }
\ No newline at end of file
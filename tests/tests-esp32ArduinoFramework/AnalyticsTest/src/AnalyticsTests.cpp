@@ -0,0 +1,223 @@
+#include <AUnit.h>
+#include "AnalyticsTests.h"
+
+using namespace aunit;
+
+#if (DYNAMIC_STRUCTARRAY == 1)
+FRTTransceiver comm(T_VALID,1);
+FRTTransceiver comm2(T_VALID,2);
+#else
+FRTTCommunicationPartner partner[1];
+FRTTransceiver comm(T_VALID,&partner[0],1);
+FRTTCommunicationPartner partner2[2];
+FRTTransceiver comm2(T_VALID,&partner2[0],2);
+#endif
+
+test(latencyHistograms_TEST1)
+{
+    /* Every read and every release is one sample, the buckets add up to the amount of samples */
+    comm.addDataAllocateCallback(dataAllocator);
+    comm.addDataFreeCallback(destroyer);
+
+    assertEqual(comm.addCommPartner(T_VALID,QUEUE,3,SMPHR,QUEUE,3,SMPHR,PARTNERNAME),true);
+
+    int values[3] = {1,2,3};
+    FRTTLineLatency snapshot;
+
+    assertEqual(comm.getLatencyHistograms(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,snapshot),true);
+    assertEqual(snapshot.queueWait.u32Samples,(uint32_t)0);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)0);
+
+    for(uint8_t u8I = 0;u8I < 3;u8I++)
+    {
+        assertEqual(comm.writeToQueue(T_VALID,eINTPTR,&values[u8I],100,100,0),true);
+    }
+    assertEqual(comm.readManyFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,3,100,100),3);
+
+    assertEqual(comm.getLatencyHistograms(comm.getLine(T_VALID),snapshot),true);
+    assertEqual(snapshot.queueWait.u32Samples,(uint32_t)3);
+    assertEqual(sumOfBuckets(snapshot.queueWait),(uint32_t)3);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)0);                                     /* NOTHING RELEASED YET */
+    assertEqual(sumOfBuckets(snapshot.untilRelease),(uint32_t)0);
+
+    assertEqual(comm.delOldestDatabuffForLine(T_VALID),true);
+    assertEqual(comm.getLatencyHistograms(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,snapshot),true);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)1);
+
+    assertEqual(comm.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm.getLatencyHistograms(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,snapshot),true);
+    assertEqual(snapshot.queueWait.u32Samples,(uint32_t)3);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)3);
+    assertEqual(sumOfBuckets(snapshot.untilRelease),(uint32_t)3);
+    assertTrue(snapshot.untilRelease.u32Max >= snapshot.queueWait.u32Max);                        /* RELEASED AFTER THE READ */
+
+    assertEqual(comm.resetLatencyHistograms(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm.getLatencyHistograms(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,snapshot),true);
+    assertEqual(snapshot.queueWait.u32Samples,(uint32_t)0);
+    assertEqual(snapshot.queueWait.u32Max,(uint32_t)0);
+    assertEqual(sumOfBuckets(snapshot.queueWait),(uint32_t)0);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)0);
+    assertEqual(sumOfBuckets(snapshot.untilRelease),(uint32_t)0);
+
+    assertEqual(comm.writeToQueue(T_VALID,eINTPTR,&values[0],100,100,0),true);
+    assertEqual(comm.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);
+    assertEqual(comm.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm.getLatencyHistograms(comm.getLine(T_VALID),snapshot),true);
+    assertEqual(snapshot.queueWait.u32Samples,(uint32_t)1);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)1);
+
+    assertEqual(comm.resetLatencyHistograms(comm.getLine(T_VALID)),true);                           /* SAME RESET BY HANDLE */
+    assertEqual(comm.getLatencyHistograms(comm.getLine(T_VALID),snapshot),true);
+    assertEqual(snapshot.queueWait.u32Samples,(uint32_t)0);
+    assertEqual(snapshot.untilRelease.u32Samples,(uint32_t)0);
+    assertEqual(comm.resetLatencyHistograms(FRTTLine()),false);
+}
+
+test(statistics_TEST2)
+{
+    /* Per-line counters after a known amount of writes, reads and drops */
+    comm2.addDataAllocateCallback(rejectingAllocator);
+    comm2.addDataFreeCallback(destroyer);
+
+    FRTTTransceiverStatistics statistics;
+    FRTTLineStatistics lineStatistics[2];
+
+    assertEqual(comm2.getStatistics(statistics,lineStatistics,2),(uint8_t)0);                     /* NO LINES YET */
+    assertEqual(comm2.addCommPartner(T_VALID,QUEUE2,3,SMPHR2,QUEUE2,3,SMPHR2,PARTNERNAME),true);
+
+    int values[3] = {1,2,3};
+
+    assertEqual(comm2.writeToQueue(T_VALID,eINTPTR,&values[0],100,100,0),true);
+    assertEqual(comm2.writeToQueue(T_VALID,eREJECTED,&values[1],100,100,0),true);
+    assertEqual(comm2.writeToQueue(T_VALID,eINTPTR,&values[2],100,100,0),true);
+    assertEqual(comm2.readManyFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,3,100,100),2);
+
+    assertEqual(comm2.getStatistics(statistics),(uint8_t)0);                                       /* NO ARRAY SUPPLIED */
+    assertTrue(statistics.ownerAddress == T_VALID);
+    assertEqual(statistics.u8CommPartners,(uint8_t)1);
+    assertEqual(statistics.u8MaxPartners,(uint8_t)2);
+    assertEqual(statistics.u8MultiSenderQueues,(uint8_t)0);
+    assertEqual(statistics.u32Broadcasts,(uint32_t)0);
+
+    assertEqual(comm2.getStatistics(statistics,lineStatistics,2),(uint8_t)1);
+    assertTrue(lineStatistics[0].commPartner == T_VALID);
+    assertEqual(lineStatistics[0].u32PackagesSent,(uint32_t)3);
+    assertEqual(lineStatistics[0].u32PackagesReceived,(uint32_t)2);
+    assertEqual(lineStatistics[0].u32PackagesDropped,(uint32_t)1);
+    assertEqual(lineStatistics[0].u8TxQueueLength,(uint8_t)3);
+    assertEqual(lineStatistics[0].u8RxQueueLength,(uint8_t)3);
+    assertEqual(lineStatistics[0].u8BufferedData,(uint8_t)2);
+    assertEqual(lineStatistics[0].bReadOnlyCommunication,false);
+    assertEqual(lineStatistics[0].bRing,false);
+
+    assertEqual(comm2.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm2.getStatistics(statistics,lineStatistics,1),(uint8_t)1);
+    assertEqual(lineStatistics[0].u8BufferedData,(uint8_t)0);
+    assertEqual(lineStatistics[0].u32PackagesReceived,(uint32_t)2);                                /* COUNTERS SURVIVE THE DELETE */
+}
+
+test(notificationRearm_TEST3)
+{
+    /* A bound bit only belongs to the rx side of the line, the rearm of dispatchNotifications() is counted like any other notification */
+    FRTTTaskHandle self = xTaskGetCurrentTaskHandle();
+    FRTTransceiver commSelf(self,1);
+    FRTTNotificationHandler table[FRTTRANSCEIVER_NOTIFICATIONBITS];
+    FRTTTransceiverStatistics statistics;
+
+    commSelf.addDataAllocateCallback(dataAllocator);
+    commSelf.addDataFreeCallback(destroyer);
+
+    assertEqual(commSelf.addCommPartner(self,QUEUE3,2,SMPHR3,QUEUE3,3,SMPHR3,"ECHO"),true);                   /* rx buffer smaller than the queue */
+
+    FRTTLine line = commSelf.getLine(self);
+    int values[3] = {1,2,3};
+
+    commSelf.setNotificationHandlerTable(table);
+    assertEqual(commSelf.bindNotificationBit(2,line,countingHandler,nullptr),true);
+    commSelf.NotifyReceiveExtended(0xFFFFFFFF,0x0,0);
+
+    for(uint8_t u8I = 0;u8I < 3;u8I++)
+    {
+        assertEqual(commSelf.writeToQueue(line,eINTPTR,&values[u8I],0,0,0),true);
+    }
+    assertEqual(commSelf.dispatchNotifications(0,0),0);                                                          /* OWN WRITES DO NOT RING */
+    commSelf.getStatistics(statistics);
+    assertEqual(statistics.u32NotificationsSent,(uint32_t)0);
+
+    assertEqual(commSelf.NotifyExtended(line,eFRTTNotifyActions::e_SetBits,0x4),true);
+    assertEqual(commSelf.dispatchNotifications(0,0),1);                                                          /* READS 2, 1 LEFT: REARMED */
+    assertEqual(commSelf.messagesOnQueue(self,false),1);
+    commSelf.getStatistics(statistics);
+    assertEqual(statistics.u32NotificationsSent,(uint32_t)2);
+
+    assertEqual(commSelf.delAllDatabuffForLine(self,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(commSelf.dispatchNotifications(0,0),1);
+    assertEqual(commSelf.messagesOnQueue(self,false),0);
+    assertEqual(commSelf.dispatchNotifications(0,0),0);
+    commSelf.getStatistics(statistics);
+    assertEqual(statistics.u32NotificationsSent,(uint32_t)2);
+
+    assertEqual(commSelf.delAllDatabuffForLine(self,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    commSelf.setNotificationHandlerTable(nullptr);                                                               /* table lives on this stack frame */
+}
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    while(!Serial);
+    log_i("\n\n");
+
+    QUEUE = FRTTCreateQueue(3);
+    SMPHR = FRTTCreateSemaphore();
+    QUEUE2 = FRTTCreateQueue(3);
+    SMPHR2 = FRTTCreateSemaphore();
+    QUEUE3 = FRTTCreateQueue(3);
+    SMPHR3 = FRTTCreateSemaphore();
+
+    TestRunner::setTimeout(0);          // Let the tests run as long as possible (~18Hrs)
+
+    log_i("This test should produce the following:");
+    log_i("3 passed, 0 failed, 0 skipped, 0 timed out, out of 3 test(s).");
+    log_i("----------\n\n");
+}
+
+
+void loop()
+{
+    TestRunner::run();
+}
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    temp.data = orig.data;
+    temp.u32AdditionalData = orig.u32AdditionalData;
+    temp.u8DataType = orig.u8DataType;
+}
+void destroyer(FRTTTempDataContainer & temp)
+{
+    /* nothing to do */
+}
+void countingHandler(FRTTransceiver & transceiver,FRTTLine line,void * context)
+{
+    /* nothing to do, the line was read before */
+}
+void rejectingAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    if(orig.u8DataType == eREJECTED)
+    {
+        temp.u8Flags |= FRTTRANSCEIVER_FLAG_REJECTED;
+        return;
+    }
+    dataAllocator(orig,temp);
+}
+
+uint32_t sumOfBuckets(const FRTTLatencyHistogram & histogram)
+{
+    uint32_t u32Sum = 0;
+    for(uint8_t u8I = 0;u8I < FRTTRANSCEIVER_LATENCYBUCKETS;u8I++)
+    {
+        u32Sum += histogram.au32Buckets[u8I];
+    }
+    return u32Sum;
+}
@@ -0,0 +1,29 @@
+#include "FRTTransceiver.h"
+
+using namespace FRTT;
+
+#define DYNAMIC_STRUCTARRAY 1
+
+#define PARTNERNAME         ("ABC")
+
+enum Datatypes
+{
+    eINTPTR = 0,
+    eREJECTED
+};
+
+FRTTTaskHandle T_VALID = (FRTTTaskHandle) 0x1;
+
+FRTTQueueHandle QUEUE;
+FRTTSemaphoreHandle SMPHR;
+FRTTQueueHandle QUEUE2;
+FRTTSemaphoreHandle SMPHR2;
+FRTTQueueHandle QUEUE3;
+FRTTSemaphoreHandle SMPHR3;
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp);
+void destroyer(FRTTTempDataContainer & temp);
+void countingHandler(FRTTransceiver & transceiver,FRTTLine line,void * context);
+void rejectingAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp);
+
+uint32_t sumOfBuckets(const FRTTLatencyHistogram & histogram);
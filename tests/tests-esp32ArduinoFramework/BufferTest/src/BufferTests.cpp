@@ -1,420 +1,984 @@
-
-#include <AUnit.h>
-#include "BufferTests.h"
-
-using namespace aunit;
-
-#if (DYNAMIC_STRUCTARRAY == 1)
-FRTTransceiver comm1(T_VALID,1);
-FRTTransceiver comm2(T_VALID,1);
-FRTTransceiver comm3(T_VALID,1);
-FRTTransceiver comm4(T_VALID,1);               
-FRTTransceiver comm5(T_VALID,2);                
-FRTTransceiver comm6(T_VALID,1);                
-#else
-FRTTCommunicationPartner partner1[1];
-FRTTCommunicationPartner partner2[1];
-FRTTCommunicationPartner partner3[1];
-FRTTCommunicationPartner partner4[1];
-FRTTCommunicationPartner partner5[2];
-FRTTCommunicationPartner partner6[1];
-
-FRTTransceiver comm1(T_VALID,&partner1[0],1);
-FRTTransceiver comm2(T_VALID,&partner2[0],1);
-FRTTransceiver comm3(T_VALID,&partner3[0],1);
-FRTTransceiver comm4(T_VALID,&partner4[0],1);
-FRTTransceiver comm5(T_VALID,&partner5[0],2);
-FRTTransceiver comm6(T_VALID,&partner6[0],1);
-#endif
-
-
-test(manualDeleteBufferPositions_TEST1)
-{
-    /* Manual deletion of buffer position.*/
-
-    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
-    comm1.addDataAllocateCallback(dataAllocator);
-    comm1.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-
-    int writeOperation1 = 1;
-    int writeOperation2 = 2;
-    int writeOperation3 = 3;
-
-    assertEqual(comm1.addCommPartner(TASK1,QUEUE,3,SMPHR,QUEUE,3,SMPHR,("ECHO")),true);
-
-    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);
-
-    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-
-    assertEqual(comm1.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);
-    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);
-    assertEqual(comm1.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
-
-    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);
-    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);
-    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);
-
-    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-
-    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,3),false);   /* Index too big (0,1,2 possible) */
-    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2),true);    /* newest data */
-    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);    /* oldest */
-    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);    /* remaining data*/
-
-    assertEqual(comm1.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
-
-    assertEqual(comm1.delDatabuffForLine((FRTTTaskHandle)(T_VALID + 0xA),eMultiSenderQueue::eNOMULTIQSELECTED,true,0),false);  /* Unknown address */
-    comm1.~FRTTransceiver();
-}
-
-test(manualDeleteAllData_TEST2)
-{
-    /*  Manual deletion of all buffer position at once */
-
-
-    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
-    comm2.addDataAllocateCallback(dataAllocator);
-    comm2.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-
-    int writeOperation1 = 1;
-    int writeOperation2 = 2;
-    int writeOperation3 = 3;
-
-    assertEqual(comm2.addCommPartner(TASK1,QUEUE2,3,SMPHR2,QUEUE2,3,SMPHR2,("ECHO")),true);
-
-    assertEqual(comm2.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);
-    assertEqual(comm2.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);
-    assertEqual(comm2.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);
-
-    assertEqual(comm2.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-    assertEqual(comm2.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-    assertEqual(comm2.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
-
-    assertEqual(comm2.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);
-
-    assertEqual(comm2.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
-    assertEqual(comm2.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
-    assertEqual(comm2.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);
-
-    assertEqual(comm2.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false); /* Nothing to flush */
-    assertEqual(comm2.delAllDatabuffForLine((FRTTTaskHandle)(T_VALID + 0xA),eMultiSenderQueue::eNOMULTIQSELECTED,true),false); /* Unknown address  */
-    comm2.~FRTTransceiver();
-}
-
-test(bufferRearrangement_TEST3)
-{
-    /* Manual deletion of buffer position. Checks if buffer rearranges it self in the right order */
-    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
-    comm3.addDataAllocateCallback(dataAllocator);
-    comm3.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-
-    int writeOperation1 = 0;
-    int writeOperation2 = 2;
-    int writeOperation3 = 4;
-
-    assertEqual(comm3.addCommPartner(TASK1,QUEUE3,3,SMPHR3,QUEUE3,3,SMPHR3,("ECHO")),true);
-    assertEqual(comm3.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);                                           /* POS 0 - writeOperation1 variable */
-    assertEqual(comm3.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);                                           /* POS 1 - writeOperation2 variable*/
-    assertEqual(comm3.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);                                           /* POS 2 - writeOperation3 variable*/
-
-    assertEqual(comm3.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                     /* MOVED INTO BUFFER */
-    assertEqual(comm3.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                     /* MOVED INTO BUFFER */
-    assertEqual(comm3.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                     /* MOVED INTO BUFFER */
-
-    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),true);                      /* POS 1 REMOVED (writeOperation2 variable)*/
-    assertEqual(*((int *)comm3.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),4);        /* SHOULD BE writeOperation3 value */
-
-    // POSITIONS LEFT: POS0 (writeOperation1), POS1 (writeOperation3)
-
-    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);                      /* POS 0 REMOVED (writeOperation1 variable)*/
-    assertEqual(*((int *)comm3.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),4);        /* SHOULD BE writeOperation3 value */
-
-    // POSITIONS LEFT: POS0 (writeOperation3)
-
-    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);                      /* POS 0 REMOVED (writeOperation3 variable)*/
-    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),false);                     /* NO BUFFER LEFT, SO FALSE */
-    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),false);                     /* NO BUFFER LEFT, SO FALSE */  
-    comm3.~FRTTransceiver();
-}
-
-test(bufferRearrangement2_TEST4)
-{
-    /* Manual deletion of buffer position. Checks if buffer rearranges it self in the right way. 
-       Reading more data from the queue than the buffers can hold will make the library automatically delete the oldest data and rearrange the buffer new (shift positions )
-    */
-
-    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
-    comm4.addDataAllocateCallback(dataAllocator);
-    comm4.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-
-    int writeOperation1 = 0;
-    int writeOperation2 = 2;
-    int writeOperation3 = 4;
-    int writeOperation4 = 6;
-    int writeOperation5 = 8;
-    int writeOperation6 = 10;
-
-    assertEqual(comm4.addCommPartner(TASK1,QUEUE4,3,SMPHR4,QUEUE4,3,SMPHR4,("ECHO")),true);
-
-    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);                                               /* POS 0 - writeOperation1 variable */
-    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);                                               /* POS 1 - writeOperation2 variable */
-    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);                                               /* POS 2 - writeOperation3 variable */
-
-    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER */
-    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER */
-    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER */
-
-    // BUFFER: POS0 (writeOperation1), POS1 (writeOperation2), POS2 (writeOperation3) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
-
-    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation4,100,100,0),true);                                               /* POS 0 - writeOperation4 variable */
-    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation5,100,100,0),true);                                               /* POS 1 - writeOperation5 variable */
-    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation6,100,100,0),true);                                               /* POS 2 - writeOperation6 variable */
-    
-    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER 
-                                                                                                                                            POS0 REMOVED, NEW DATA ON POS2*/
-    
-    // BUFFER: POS0 (writeOperation2), POS1 (writeOperation3), POS2 (writeOperation4) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
-
-    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),2);            /* SHOULD BE writeOperation2 value */ 
-
-    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER 
-                                                                                                                                             POS0 REMOVED, NEW DATA ON POS2*/
-
-    // BUFFER: POS0 (writeOperation3), POS1 (writeOperation4), POS2 (writeOperation5) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
-
-    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),4);            /* SHOULD BE writeOperation3 value */
-
-    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER 
-                                                                                                                                             POS0 REMOVED, NEW DATA ON POS2*/
-
-    // BUFFER: POS0 (writeOperation4), POS1 (writeOperation5), POS2 (writeOperation6) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
-
-    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),6);            /* SHOULD BE writeOperation4 value */
-    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),8);            /* SHOULD BE writeOperation5 value */
-    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2)->data),10);           /* SHOULD BE writeOperation6 value */
-    comm4.~FRTTransceiver();
-}
-
-
-test(bufferTools_TEST5)
-{
-    /*  Checks if some important methods work as expected */
-    /*  Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
-
-    comm5.addDataAllocateCallback(dataAllocator);
-    comm5.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-    FRTTTaskHandle TASK2 = (FRTTTaskHandle)(T_VALID + 0x2);
-
-    int writeOperation1 = 0;
-    std::string writeOperation2("writeOperation2");
-    char * writeOperation3 = "writeOperation3";
-    int writeOperation4 = 6;
-    int writeOperation5 = 8;
-    int writeOperation6 = 10;
-
-    assertEqual(comm5.addCommPartner(TASK1,QUEUE5,3,SMPHR5,QUEUE5,3,SMPHR5,("ECHO")),true);
-    assertEqual(comm5.addCommPartner(TASK2,QUEUE6,3,SMPHR6,QUEUE6,3,SMPHR6,("ECHO2")),true);
-
-    assertEqual(comm5.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,0),true);
-    assertEqual(comm5.writeToQueue(TASK1,(uint8_t)Datatypes::eSTRINGPTR,&writeOperation2,100,100,0),true);                          
-    assertEqual(comm5.writeToQueue(TASK1,(uint8_t)Datatypes::eCHARPTR,&writeOperation3[0],100,100,0),true);
-
-    assertEqual(comm5.writeToQueue(TASK2,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,0),true);
-    assertEqual(comm5.writeToQueue(TASK2,(uint8_t)Datatypes::eSTRINGPTR,&writeOperation2,100,100,0),true);
-    assertEqual(comm5.writeToQueue(TASK2,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,0),true); 
-
-    assertEqual(comm5.bufferedDataInAllBuffers(),0);
-    assertEqual(comm5.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* NO DATA IN BUFFER */
-    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* NO DATA IN BUFFER */ 
-
-    assertEqual(comm5.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM1 */
-
-    assertEqual(comm5.bufferedDataInAllBuffers(),1);                                                                            /* DATA IN ALL BUFFER: 1 */
-    assertEqual(comm5.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                                       /* DATA IN BUFFER */
-    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* NO DATA IN BUFFER */ 
-    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);                                     /* SHOULD HAVE 1 MESSAGE IN BUFFER*/
-    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);                                     /* SHOULD HAVE 0 MESSAGES IN BUFFER*/
-
-    assertEqual(comm5.readFromQueue(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM2*/                        
-
-    assertEqual(comm5.bufferedDataInAllBuffers(),2);                                                                            /* DATA IN ALL BUFFER: 2 */
-    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                                       /* NOW WE HAVE DATA IN BUFFER */
-    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);                                     /* SHOULD STILL HAVE 1 MESSAGE IN BUFFER*/
-    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);                                     /* SHOULD HAVE 1 MESSAGE IN BUFFER*/
-
-    assertEqual(comm5.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM1*/
-    assertEqual(comm5.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM1*/
-    assertEqual(comm5.readFromQueue(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM2*/
-    assertEqual(comm5.readFromQueue(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM2*/
-
-    assertEqual(comm5.bufferedDataInAllBuffers(),6);                                                                            /* DATA IN ALL BUFFER: 6 */
-
-    /* Datatypes in buffer for COMM1 -> POS0 (eINTPTR), POS1 (eSTRINGPTR), POS2 (eCHARPTR)*/
-    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eINTPTR),1);       /* One pointer to int expected */
-    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eSTRINGPTR),1);    /* One pointer to std::string expected */
-    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eCHARPTR),1);      /* One pointer to c-string expected */
-
-    /* Datatypes in buffer for COMM2 -> POS0 (eINTPTR), POS1 (eSTRINGPTR), POS2 (eINTPTR)*/
-    assertEqual(comm5.isDatatypeInBuffer(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eINTPTR),2);       /* TWO pointer to int expected */
-    assertEqual(comm5.isDatatypeInBuffer(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eSTRINGPTR),1);    /* One pointer to std::string expected */
-    assertEqual(comm5.isDatatypeInBuffer(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eCHARPTR),0);      /* ZERO pointer to c-string expected */
-
-    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);                                     /* SHOULD HAVE 3 MESSAGE IN BUFFER*/
-    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);                                     /* SHOULD HAVE 3 MESSAGE IN BUFFER*/
-
-    assertEqual(comm5.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                             /* FLUSH BUFFER COMM1*/
-
-    /* Datatypes in buffer for COMM1 -> POS0 (EMPTY), POS1 (EMPTY), POS2 (EMPTY)*/
-    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eINTPTR),0);       /* ZERO pointer to int expected */
-    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eSTRINGPTR),0);    /* ZERO pointer to std::string expected */
-    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eCHARPTR),0);      /* ZERO pointer to c-string expected */
-
-    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);                                     /* SHOULD HAVE 0 MESSAGE IN BUFFER*/
-    assertEqual(comm5.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* DATE REMOVED -> NO DATA IN  BUFFER */
-    assertEqual(comm5.bufferedDataInAllBuffers(),3);                                                                            /* DATA IN ALL BUFFER: 3 */
-    assertEqual(comm5.delAllDatabuffForLine(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                             /* FLUSH BUFFER COMM2*/
-
-    assertEqual(comm5.bufferedDataInAllBuffers(),0);                                                                            /* DATA IN ALL BUFFER: 0 */
-    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);                                     /* SHOULD HAVE 0 MESSAGE IN BUFFER*/
-    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* DATE REMOVED -> NO DATA IN  BUFFER */
-    comm5.~FRTTransceiver();
-    
-}
-
-test(bufferData_TEST6)
-{
-    /*  Checks if the library passes/reads data in the right order */
-    /*  Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
-    comm6.addDataAllocateCallback(dataAllocator);
-    comm6.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
-
-    int a = 15;
-    std::string cppString("This is a cpp string.");
-    char * charptr = "This is a c string";
-
-
-    assertEqual(comm6.addCommPartner(TASK1,QUEUE7,3,SMPHR7,QUEUE7,3,SMPHR7,"ECHO2"),true);
-
-    assertEqual(comm6.writeToQueue(TASK1,(uint8_t)Datatypes::eCHARPTR,&charptr[0],100,100,500),true);                
-    assertEqual(comm6.writeToQueue(TASK1,(uint8_t)Datatypes::eSTRINGPTR,&cppString,100,100,1000),true);                                                                                     
-    assertEqual(comm6.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&a,100,100,1500),true);  
-
-    assertEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),nullptr);                    /* NO DATA IN BUFFER POS 0*/
-    assertEqual(comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* SAME AS ABOVE */
-    assertEqual(comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* SAME AS ABOVE */
-
-    assertEqual(comm6.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                    /* MOVE INTO BUFFER */
-    assertEqual(comm6.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                    /* MOVE INTO BUFFER */   
-    assertEqual(comm6.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                    /* MOVE INTO BUFFER */
-
-    assertEqual(comm6.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);
-
-    assertNotEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),nullptr);                    /* WILL NOT BE NULL */
-    assertNotEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),nullptr);                    /* WILL NOT BE NULL */
-    assertNotEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2),nullptr);                    /* WILL NOT BE NULL */
-    assertNotEqual(comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* WILL NOT BE NULL */
-    assertNotEqual(comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* WILL NOT BE NULL */
-
-    /* Datatypes in buffer -> POS0 (eCHARPTR)(add.Data = 500), POS1 (eSTRINGPTR)(add.Data = 1000), POS2 (eINTPTR)(add.Data = 1500)*/
-
-    const FRTTTempDataContainer * t1 = comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0);    /* OLDEST DATA */
-    const FRTTTempDataContainer * t2 = comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1);
-    const FRTTTempDataContainer * t3 = comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2);    /* NEWEST DATA */
-    
-    assertEqual(t1->senderAddress,TASK1);                       
-    assertEqual(t1->u32AdditionalData,(uint32_t)500);
-    assertEqual(t1->u8DataType,(uint8_t)Datatypes::eCHARPTR);
-    assertEqual((char*)t1->data,(char *)"This is a c string");
-
-    assertEqual(t2->senderAddress,TASK1);
-    assertEqual(t2->u32AdditionalData,(uint32_t)1000);
-    assertEqual(t2->u8DataType,(uint8_t)Datatypes::eSTRINGPTR);
-    assertEqual(((std::string *)t2->data)->c_str(),"This is a cpp string.");
-
-    assertEqual(t3->senderAddress,TASK1);
-    assertEqual(t3->u32AdditionalData,(uint32_t)1500);
-    assertEqual(t3->u8DataType,(uint8_t)Datatypes::eINTPTR);
-    assertEqual(*((int *)t3->data),15);
-
-    /* Same tests as with t1 and t3 pointer but with getOldestBufferedData/getNewestBufferedData methods */
-
-    assertEqual(((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->senderAddress,TASK1);
-    assertEqual(((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u32AdditionalData,(uint32_t)500);
-    assertEqual(((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u8DataType,(uint8_t)Datatypes::eCHARPTR);
-    assertEqual((char*)((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->data,(char *)"This is a c string");
-
-    assertEqual(((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->senderAddress,TASK1);
-    assertEqual(((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u32AdditionalData,(uint32_t)1500);
-    assertEqual(((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u8DataType,(uint8_t)Datatypes::eINTPTR);
-    assertEqual(*((int *)((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->data),15);
-
-    assertEqual(comm6.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);   /* FLUSH BUFFER */
-    assertEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),nullptr);                        /* NO DATA IN BUFFER POS 0*/
-    assertEqual(comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                    /* SAME AS ABOVE */
-    assertEqual(comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                    /* SAME AS ABOVE */
-}
-
-void setup()
-{
-    vTaskDelay(pdMS_TO_TICKS(2500));
-    Serial.begin(115200);               // For the internal printer of TestRunner
-    while(!Serial);                     
-    log_i("\n\n");
-
-
-    QUEUE = FRTTCreateQueue(3);
-    QUEUE2 = FRTTCreateQueue(3);
-    QUEUE3 = FRTTCreateQueue(3);
-    QUEUE4 = FRTTCreateQueue(3);
-
-    QUEUE5 = FRTTCreateQueue(3);
-    QUEUE6 = FRTTCreateQueue(3);
-    QUEUE7 = FRTTCreateQueue(3);
-
-    SMPHR = FRTTCreateSemaphore();
-    SMPHR2 = FRTTCreateSemaphore();
-    SMPHR3 = FRTTCreateSemaphore();
-    SMPHR4 = FRTTCreateSemaphore();
-    
-    SMPHR5 = FRTTCreateSemaphore();
-    SMPHR6 = FRTTCreateSemaphore();
-    SMPHR7 = FRTTCreateSemaphore();
-
-    log_i("This test should produce the following:");
-    log_i("6 passed, 0 failed, 0 skipped, 0 timed out, out of 6 test(s).");
-    log_i("----------\n\n");
-}
-
-
-
-void loop()
-{
-    TestRunner::run();
-} 
-
-
-void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
-{
-    temp.data = orig.data;
-    temp.senderAddress = orig.senderAddress;
-    temp.u32AdditionalData = orig.u32AdditionalData;
-    temp.u8DataType = orig.u8DataType;
-}
-void destroyer(FRTTTempDataContainer & temp)
-{
-      /* nothing to do */      
-}
\ No newline at end of file
+
+#include <AUnit.h>
+#include "BufferTests.h"
+
+using namespace aunit;
+
+#if (DYNAMIC_STRUCTARRAY == 1)
+FRTTransceiver comm1(T_VALID,1);
+FRTTransceiver comm2(T_VALID,1);
+FRTTransceiver comm3(T_VALID,1);
+FRTTransceiver comm4(T_VALID,1);               
+FRTTransceiver comm5(T_VALID,2);                
+FRTTransceiver comm6(T_VALID,1);                
+FRTTransceiver comm7(T_VALID,1);                
+FRTTransceiver comm8(T_VALID,1);                
+FRTTransceiver comm9(T_VALID,1);                
+FRTTransceiver comm10(T_VALID,1);
+FRTTransceiver comm11(T_VALID,1);
+FRTTransceiver comm12(T_VALID,1);
+FRTTransceiver comm13(T_VALID,1);
+FRTTransceiver comm14(T_VALID,1);
+FRTTransceiver comm15(T_VALID,1);
+FRTTransceiver comm16(T_VALID,1);
+FRTTransceiver comm17(T_VALID,1);
+FRTTransceiver comm18(T_VALID,1);
+#else
+FRTTCommunicationPartner partner1[1];
+FRTTCommunicationPartner partner2[1];
+FRTTCommunicationPartner partner3[1];
+FRTTCommunicationPartner partner4[1];
+FRTTCommunicationPartner partner5[2];
+FRTTCommunicationPartner partner6[1];
+FRTTCommunicationPartner partner7[1];
+FRTTCommunicationPartner partner8[1];
+FRTTCommunicationPartner partner9[1];
+FRTTCommunicationPartner partner10[1];
+FRTTCommunicationPartner partner11[1];
+FRTTCommunicationPartner partner12[1];
+FRTTCommunicationPartner partner13[1];
+FRTTCommunicationPartner partner14[1];
+FRTTCommunicationPartner partner15[1];
+FRTTCommunicationPartner partner16[1];
+FRTTCommunicationPartner partner17[1];
+FRTTCommunicationPartner partner18[1];
+
+FRTTransceiver comm1(T_VALID,&partner1[0],1);
+FRTTransceiver comm2(T_VALID,&partner2[0],1);
+FRTTransceiver comm3(T_VALID,&partner3[0],1);
+FRTTransceiver comm4(T_VALID,&partner4[0],1);
+FRTTransceiver comm5(T_VALID,&partner5[0],2);
+FRTTransceiver comm6(T_VALID,&partner6[0],1);
+FRTTransceiver comm7(T_VALID,&partner7[0],1);
+FRTTransceiver comm8(T_VALID,&partner8[0],1);
+FRTTransceiver comm9(T_VALID,&partner9[0],1);
+FRTTransceiver comm10(T_VALID,&partner10[0],1);
+FRTTransceiver comm11(T_VALID,&partner11[0],1);
+FRTTransceiver comm12(T_VALID,&partner12[0],1);
+FRTTransceiver comm13(T_VALID,&partner13[0],1);
+FRTTransceiver comm14(T_VALID,&partner14[0],1);
+FRTTransceiver comm15(T_VALID,&partner15[0],1);
+FRTTransceiver comm16(T_VALID,&partner16[0],1);
+FRTTransceiver comm17(T_VALID,&partner17[0],1);
+FRTTransceiver comm18(T_VALID,&partner18[0],1);
+#endif
+
+
+test(manualDeleteBufferPositions_TEST1)
+{
+    /* Manual deletion of buffer position.*/
+
+    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
+    comm1.addDataAllocateCallback(dataAllocator);
+    comm1.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+
+    int writeOperation1 = 1;
+    int writeOperation2 = 2;
+    int writeOperation3 = 3;
+
+    assertEqual(comm1.addCommPartner(TASK1,QUEUE,3,SMPHR,QUEUE,3,SMPHR,("ECHO")),true);
+
+    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);
+
+    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+
+    assertEqual(comm1.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);
+    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);
+    assertEqual(comm1.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
+
+    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);
+    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);
+    assertEqual(comm1.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);
+
+    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm1.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+
+    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,3),false);   /* Index too big (0,1,2 possible) */
+    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2),true);    /* newest data */
+    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);    /* oldest */
+    assertEqual(comm1.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);    /* remaining data*/
+
+    assertEqual(comm1.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
+
+    assertEqual(comm1.delDatabuffForLine((FRTTTaskHandle)(T_VALID + 0xA),eMultiSenderQueue::eNOMULTIQSELECTED,true,0),false);  /* Unknown address */
+    comm1.~FRTTransceiver();
+}
+
+test(manualDeleteAllData_TEST2)
+{
+    /*  Manual deletion of all buffer position at once */
+
+
+    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
+    comm2.addDataAllocateCallback(dataAllocator);
+    comm2.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+
+    int writeOperation1 = 1;
+    int writeOperation2 = 2;
+    int writeOperation3 = 3;
+
+    assertEqual(comm2.addCommPartner(TASK1,QUEUE2,3,SMPHR2,QUEUE2,3,SMPHR2,("ECHO")),true);
+
+    assertEqual(comm2.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);
+    assertEqual(comm2.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);
+    assertEqual(comm2.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);
+
+    assertEqual(comm2.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm2.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm2.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+
+    assertEqual(comm2.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);
+
+    assertEqual(comm2.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm2.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
+    assertEqual(comm2.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);
+
+    assertEqual(comm2.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false); /* Nothing to flush */
+    assertEqual(comm2.delAllDatabuffForLine((FRTTTaskHandle)(T_VALID + 0xA),eMultiSenderQueue::eNOMULTIQSELECTED,true),false); /* Unknown address  */
+    comm2.~FRTTransceiver();
+}
+
+test(bufferRearrangement_TEST3)
+{
+    /* Manual deletion of buffer position. Checks if buffer rearranges it self in the right order */
+    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
+    comm3.addDataAllocateCallback(dataAllocator);
+    comm3.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+
+    int writeOperation1 = 0;
+    int writeOperation2 = 2;
+    int writeOperation3 = 4;
+
+    assertEqual(comm3.addCommPartner(TASK1,QUEUE3,3,SMPHR3,QUEUE3,3,SMPHR3,("ECHO")),true);
+    assertEqual(comm3.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);                                           /* POS 0 - writeOperation1 variable */
+    assertEqual(comm3.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);                                           /* POS 1 - writeOperation2 variable*/
+    assertEqual(comm3.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);                                           /* POS 2 - writeOperation3 variable*/
+
+    assertEqual(comm3.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                     /* MOVED INTO BUFFER */
+    assertEqual(comm3.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                     /* MOVED INTO BUFFER */
+    assertEqual(comm3.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                     /* MOVED INTO BUFFER */
+
+    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),true);                      /* POS 1 REMOVED (writeOperation2 variable)*/
+    assertEqual(*((int *)comm3.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),4);        /* SHOULD BE writeOperation3 value */
+
+    // POSITIONS LEFT: POS0 (writeOperation1), POS1 (writeOperation3)
+
+    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);                      /* POS 0 REMOVED (writeOperation1 variable)*/
+    assertEqual(*((int *)comm3.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),4);        /* SHOULD BE writeOperation3 value */
+
+    // POSITIONS LEFT: POS0 (writeOperation3)
+
+    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);                      /* POS 0 REMOVED (writeOperation3 variable)*/
+    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),false);                     /* NO BUFFER LEFT, SO FALSE */
+    assertEqual(comm3.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),false);                     /* NO BUFFER LEFT, SO FALSE */  
+    comm3.~FRTTransceiver();
+}
+
+test(bufferRearrangement2_TEST4)
+{
+    /* Manual deletion of buffer position. Checks if buffer rearranges it self in the right way. 
+       Reading more data from the queue than the buffers can hold will make the library automatically delete the oldest data and rearrange the buffer new (shift positions )
+    */
+
+    /* Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
+    comm4.addDataAllocateCallback(dataAllocator);
+    comm4.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+
+    int writeOperation1 = 0;
+    int writeOperation2 = 2;
+    int writeOperation3 = 4;
+    int writeOperation4 = 6;
+    int writeOperation5 = 8;
+    int writeOperation6 = 10;
+
+    assertEqual(comm4.addCommPartner(TASK1,QUEUE4,3,SMPHR4,QUEUE4,3,SMPHR4,("ECHO")),true);
+
+    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation1,100,100,0),true);                                               /* POS 0 - writeOperation1 variable */
+    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation2,100,100,0),true);                                               /* POS 1 - writeOperation2 variable */
+    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation3,100,100,0),true);                                               /* POS 2 - writeOperation3 variable */
+
+    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER */
+    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER */
+    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER */
+
+    // BUFFER: POS0 (writeOperation1), POS1 (writeOperation2), POS2 (writeOperation3) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
+
+    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation4,100,100,0),true);                                               /* POS 0 - writeOperation4 variable */
+    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation5,100,100,0),true);                                               /* POS 1 - writeOperation5 variable */
+    assertEqual(comm4.writeToQueue(TASK1,0,&writeOperation6,100,100,0),true);                                               /* POS 2 - writeOperation6 variable */
+    
+    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER 
+                                                                                                                                            POS0 REMOVED, NEW DATA ON POS2*/
+    
+    // BUFFER: POS0 (writeOperation2), POS1 (writeOperation3), POS2 (writeOperation4) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
+
+    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),2);            /* SHOULD BE writeOperation2 value */ 
+
+    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER 
+                                                                                                                                             POS0 REMOVED, NEW DATA ON POS2*/
+
+    // BUFFER: POS0 (writeOperation3), POS1 (writeOperation4), POS2 (writeOperation5) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
+
+    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),4);            /* SHOULD BE writeOperation3 value */
+
+    assertEqual(comm4.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                         /* MOVED INTO BUFFER 
+                                                                                                                                             POS0 REMOVED, NEW DATA ON POS2*/
+
+    // BUFFER: POS0 (writeOperation4), POS1 (writeOperation5), POS2 (writeOperation6) ---> BUFFER FULL, POS0 IS THE OLDEST DATA
+
+    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0)->data),6);            /* SHOULD BE writeOperation4 value */
+    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),8);            /* SHOULD BE writeOperation5 value */
+    assertEqual(*((int *)comm4.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2)->data),10);           /* SHOULD BE writeOperation6 value */
+    comm4.~FRTTransceiver();
+}
+
+
+test(bufferTools_TEST5)
+{
+    /*  Checks if some important methods work as expected */
+    /*  Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
+
+    comm5.addDataAllocateCallback(dataAllocator);
+    comm5.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+    FRTTTaskHandle TASK2 = (FRTTTaskHandle)(T_VALID + 0x2);
+
+    int writeOperation1 = 0;
+    std::string writeOperation2("writeOperation2");
+    char * writeOperation3 = "writeOperation3";
+    int writeOperation4 = 6;
+    int writeOperation5 = 8;
+    int writeOperation6 = 10;
+
+    assertEqual(comm5.addCommPartner(TASK1,QUEUE5,3,SMPHR5,QUEUE5,3,SMPHR5,("ECHO")),true);
+    assertEqual(comm5.addCommPartner(TASK2,QUEUE6,3,SMPHR6,QUEUE6,3,SMPHR6,("ECHO2")),true);
+
+    assertEqual(comm5.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,0),true);
+    assertEqual(comm5.writeToQueue(TASK1,(uint8_t)Datatypes::eSTRINGPTR,&writeOperation2,100,100,0),true);                          
+    assertEqual(comm5.writeToQueue(TASK1,(uint8_t)Datatypes::eCHARPTR,&writeOperation3[0],100,100,0),true);
+
+    assertEqual(comm5.writeToQueue(TASK2,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,0),true);
+    assertEqual(comm5.writeToQueue(TASK2,(uint8_t)Datatypes::eSTRINGPTR,&writeOperation2,100,100,0),true);
+    assertEqual(comm5.writeToQueue(TASK2,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,0),true); 
+
+    assertEqual(comm5.bufferedDataInAllBuffers(),0);
+    assertEqual(comm5.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* NO DATA IN BUFFER */
+    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* NO DATA IN BUFFER */ 
+
+    assertEqual(comm5.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM1 */
+
+    assertEqual(comm5.bufferedDataInAllBuffers(),1);                                                                            /* DATA IN ALL BUFFER: 1 */
+    assertEqual(comm5.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                                       /* DATA IN BUFFER */
+    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* NO DATA IN BUFFER */ 
+    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);                                     /* SHOULD HAVE 1 MESSAGE IN BUFFER*/
+    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);                                     /* SHOULD HAVE 0 MESSAGES IN BUFFER*/
+
+    assertEqual(comm5.readFromQueue(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM2*/                        
+
+    assertEqual(comm5.bufferedDataInAllBuffers(),2);                                                                            /* DATA IN ALL BUFFER: 2 */
+    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                                       /* NOW WE HAVE DATA IN BUFFER */
+    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);                                     /* SHOULD STILL HAVE 1 MESSAGE IN BUFFER*/
+    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),1);                                     /* SHOULD HAVE 1 MESSAGE IN BUFFER*/
+
+    assertEqual(comm5.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM1*/
+    assertEqual(comm5.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM1*/
+    assertEqual(comm5.readFromQueue(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM2*/
+    assertEqual(comm5.readFromQueue(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                             /* MOVED INTO BUFFER COMM2*/
+
+    assertEqual(comm5.bufferedDataInAllBuffers(),6);                                                                            /* DATA IN ALL BUFFER: 6 */
+
+    /* Datatypes in buffer for COMM1 -> POS0 (eINTPTR), POS1 (eSTRINGPTR), POS2 (eCHARPTR)*/
+    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eINTPTR),1);       /* One pointer to int expected */
+    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eSTRINGPTR),1);    /* One pointer to std::string expected */
+    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eCHARPTR),1);      /* One pointer to c-string expected */
+
+    /* Datatypes in buffer for COMM2 -> POS0 (eINTPTR), POS1 (eSTRINGPTR), POS2 (eINTPTR)*/
+    assertEqual(comm5.isDatatypeInBuffer(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eINTPTR),2);       /* TWO pointer to int expected */
+    assertEqual(comm5.isDatatypeInBuffer(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eSTRINGPTR),1);    /* One pointer to std::string expected */
+    assertEqual(comm5.isDatatypeInBuffer(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eCHARPTR),0);      /* ZERO pointer to c-string expected */
+
+    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);                                     /* SHOULD HAVE 3 MESSAGE IN BUFFER*/
+    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);                                     /* SHOULD HAVE 3 MESSAGE IN BUFFER*/
+
+    assertEqual(comm5.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                             /* FLUSH BUFFER COMM1*/
+
+    /* Datatypes in buffer for COMM1 -> POS0 (EMPTY), POS1 (EMPTY), POS2 (EMPTY)*/
+    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eINTPTR),0);       /* ZERO pointer to int expected */
+    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eSTRINGPTR),0);    /* ZERO pointer to std::string expected */
+    assertEqual(comm5.isDatatypeInBuffer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,(uint8_t)Datatypes::eCHARPTR),0);      /* ZERO pointer to c-string expected */
+
+    assertEqual(comm5.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);                                     /* SHOULD HAVE 0 MESSAGE IN BUFFER*/
+    assertEqual(comm5.hasDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* DATE REMOVED -> NO DATA IN  BUFFER */
+    assertEqual(comm5.bufferedDataInAllBuffers(),3);                                                                            /* DATA IN ALL BUFFER: 3 */
+    assertEqual(comm5.delAllDatabuffForLine(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);                             /* FLUSH BUFFER COMM2*/
+
+    assertEqual(comm5.bufferedDataInAllBuffers(),0);                                                                            /* DATA IN ALL BUFFER: 0 */
+    assertEqual(comm5.bufferedDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);                                     /* SHOULD HAVE 0 MESSAGE IN BUFFER*/
+    assertEqual(comm5.hasDataFrom(TASK2,eMultiSenderQueue::eNOMULTIQSELECTED,true),false);                                      /* DATE REMOVED -> NO DATA IN  BUFFER */
+    comm5.~FRTTransceiver();
+    
+}
+
+test(bufferData_TEST6)
+{
+    /*  Checks if the library passes/reads data in the right order */
+    /*  Is an echo communication, same tests can be made with normal communication/multi-sender-queue  */
+    comm6.addDataAllocateCallback(dataAllocator);
+    comm6.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int a = 15;
+    std::string cppString("This is a cpp string.");
+    char * charptr = "This is a c string";
+
+
+    assertEqual(comm6.addCommPartner(TASK1,QUEUE7,3,SMPHR7,QUEUE7,3,SMPHR7,"ECHO2"),true);
+
+    assertEqual(comm6.writeToQueue(TASK1,(uint8_t)Datatypes::eCHARPTR,&charptr[0],100,100,500),true);                
+    assertEqual(comm6.writeToQueue(TASK1,(uint8_t)Datatypes::eSTRINGPTR,&cppString,100,100,1000),true);                                                                                     
+    assertEqual(comm6.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&a,100,100,1500),true);  
+
+    assertEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),nullptr);                    /* NO DATA IN BUFFER POS 0*/
+    assertEqual(comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* SAME AS ABOVE */
+    assertEqual(comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* SAME AS ABOVE */
+
+    assertEqual(comm6.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                    /* MOVE INTO BUFFER */
+    assertEqual(comm6.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                    /* MOVE INTO BUFFER */   
+    assertEqual(comm6.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                    /* MOVE INTO BUFFER */
+
+    assertEqual(comm6.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);
+
+    assertNotEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),nullptr);                    /* WILL NOT BE NULL */
+    assertNotEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),nullptr);                    /* WILL NOT BE NULL */
+    assertNotEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2),nullptr);                    /* WILL NOT BE NULL */
+    assertNotEqual(comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* WILL NOT BE NULL */
+    assertNotEqual(comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                /* WILL NOT BE NULL */
+
+    /* Datatypes in buffer -> POS0 (eCHARPTR)(add.Data = 500), POS1 (eSTRINGPTR)(add.Data = 1000), POS2 (eINTPTR)(add.Data = 1500)*/
+
+    const FRTTTempDataContainer * t1 = comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0);    /* OLDEST DATA */
+    const FRTTTempDataContainer * t2 = comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1);
+    const FRTTTempDataContainer * t3 = comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,2);    /* NEWEST DATA */
+    
+    assertEqual(t1->senderAddress,TASK1);                       
+    assertEqual(t1->u32AdditionalData,(uint32_t)500);
+    assertEqual(t1->u8DataType,(uint8_t)Datatypes::eCHARPTR);
+    assertEqual((char*)t1->data,(char *)"This is a c string");
+
+    assertEqual(t2->senderAddress,TASK1);
+    assertEqual(t2->u32AdditionalData,(uint32_t)1000);
+    assertEqual(t2->u8DataType,(uint8_t)Datatypes::eSTRINGPTR);
+    assertEqual(((std::string *)t2->data)->c_str(),"This is a cpp string.");
+
+    assertEqual(t3->senderAddress,TASK1);
+    assertEqual(t3->u32AdditionalData,(uint32_t)1500);
+    assertEqual(t3->u8DataType,(uint8_t)Datatypes::eINTPTR);
+    assertEqual(*((int *)t3->data),15);
+
+    /* Same tests as with t1 and t3 pointer but with getOldestBufferedData/getNewestBufferedData methods */
+
+    assertEqual(((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->senderAddress,TASK1);
+    assertEqual(((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u32AdditionalData,(uint32_t)500);
+    assertEqual(((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u8DataType,(uint8_t)Datatypes::eCHARPTR);
+    assertEqual((char*)((const FRTTTempDataContainer *)comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->data,(char *)"This is a c string");
+
+    assertEqual(((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->senderAddress,TASK1);
+    assertEqual(((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u32AdditionalData,(uint32_t)1500);
+    assertEqual(((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->u8DataType,(uint8_t)Datatypes::eINTPTR);
+    assertEqual(*((int *)((const FRTTTempDataContainer *)comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true))->data),15);
+
+    assertEqual(comm6.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);   /* FLUSH BUFFER */
+    assertEqual(comm6.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),nullptr);                        /* NO DATA IN BUFFER POS 0*/
+    assertEqual(comm6.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                    /* SAME AS ABOVE */
+    assertEqual(comm6.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),nullptr);                    /* SAME AS ABOVE */
+}
+
+test(ringData_TEST7)
+{
+    /*  Same as bufferData_TEST6 but the echo communication uses a single-producer/single-consumer ring instead of a queue */
+    comm7.addDataAllocateCallback(dataAllocator);
+    comm7.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int a = 1;
+    int b = 2;
+    int c = 3;
+    int d = 4;
+
+    assertEqual(comm7.addCommPartner(TASK1,RING,RING,"ECHO-RING"),true);
+
+    assertEqual(comm7.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&a,100,100,1),true);
+    assertEqual(comm7.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&b,100,100,2),true);
+    assertEqual(comm7.writeToQueue(comm7.getLine(TASK1),(uint8_t)Datatypes::eINTPTR,&c,100,100,3),true);
+    assertEqual(comm7.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&d,10,10,4),false);                              /* RING FULL */
+    assertEqual(comm7.messagesOnQueue(TASK1,false),3);
+
+    assertEqual(comm7.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                   /* MOVE INTO BUFFER */
+    assertEqual(comm7.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&d,10,10,4),true);                               /* SPACE AGAIN */
+    assertEqual(comm7.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm7.readFromQueue(comm7.getLine(TASK1),500,500),true);
+    assertEqual(comm7.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);                   /* BUFFER FULL -> OLDEST (a) RELEASED */
+    assertEqual(comm7.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,10,10),false);                    /* RING EMPTY */
+
+    assertEqual(*((int *)comm7.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),2);
+    assertEqual(*((int *)comm7.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),4);
+    assertEqual(comm7.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u32AdditionalData,(uint32_t)4);
+
+    assertEqual(comm7.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&a,100,100,1),true);
+    assertEqual(comm7.queueFlush(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,true),false);                    /* ONLY THE READER FLUSHES A RING */
+    assertEqual(comm7.queueFlush(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,false),true);
+    assertEqual(comm7.messagesOnQueue(TASK1,false),0);
+    assertEqual(comm7.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(batchWrite_TEST8)
+{
+    /*  Writes several data packages with one call. Only as many as fit on the queue are accepted */
+    comm8.addDataAllocateCallback(dataAllocator);
+    comm8.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int values[4] = {10,20,30,40};
+    FRTTDataContainerOnQueue batch[4];
+
+    for(uint8_t u8I = 0;u8I < 4;u8I++)
+    {
+        batch[u8I].data = &values[u8I];
+        batch[u8I].u8DataType = (uint8_t)Datatypes::eINTPTR;
+        batch[u8I].u32AdditionalData = u8I;
+    }
+
+    assertEqual(comm8.addCommPartner(TASK1,QUEUE8,3,SMPHR8,QUEUE8,3,SMPHR8,"ECHO-BATCH"),true);
+
+    assertEqual(comm8.writeBatchToQueue(TASK1,&batch[0],4,100,100),3);                                                 /* QUEUE LENGTH 3 -> LAST ONE REJECTED */
+    assertEqual(comm8.writeBatchToQueue(TASK1,&batch[3],1,10,10),0);                                                  /* QUEUE FULL */
+    assertEqual(comm8.messagesOnQueue(TASK1,true),3);
+
+    assertEqual(comm8.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm8.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm8.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+
+    assertEqual(*((int *)comm8.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),10);   /* ORDER KEPT */
+    assertEqual(*((int *)comm8.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),30);
+    assertEqual(comm8.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->senderAddress,T_VALID);
+
+    batch[1].data = nullptr;
+    assertEqual(comm8.writeBatchToQueue(comm8.getLine(TASK1),&batch[0],2,100,100),-1);                                 /* INVALID ENTRY -> NOTHING SENT */
+    assertEqual(comm8.messagesOnQueue(TASK1,true),0);
+    assertEqual(comm8.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(bufferWrapAround_TEST9)
+{
+    /*  The internal buffer is circular. Old data gets evicted without moving the rest, positions stay relative to the oldest entry */
+    comm9.addDataAllocateCallback(dataAllocator);
+    comm9.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int values[5] = {10,20,30,40,50};
+
+    assertEqual(comm9.addCommPartner(TASK1,QUEUE9,3,SMPHR9,QUEUE9,3,SMPHR9,"ECHO-WRAP"),true);
+
+    for(uint8_t u8I = 0;u8I < 5;u8I++)
+    {
+        assertEqual(comm9.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[u8I],100,100,0),true);
+        assertEqual(comm9.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);      /* 10 AND 20 EVICTED */
+    }
+
+    assertEqual(*((int *)comm9.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),30);
+    assertEqual(*((int *)comm9.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),40);
+    assertEqual(*((int *)comm9.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),50);
+
+    assertEqual(comm9.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1),true);                   /* 40 REMOVED */
+    assertEqual(*((int *)comm9.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),30);
+    assertEqual(*((int *)comm9.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),50);
+    assertEqual(comm9.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),2);
+
+    assertEqual(comm9.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(datatypeDispatch_TEST10)
+{
+    /*  Every buffered data package goes to the handler of its datatype (oldest first), the buffer is empty afterwards */
+    comm10.addDataAllocateCallback(dataAllocator);
+    comm10.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    static FRTTDatatypeTable table;
+    int sum = 0;
+    int values[3] = {1,20,300};
+
+    assertEqual(comm10.addCommPartner(TASK1,QUEUE10,3,SMPHR10,QUEUE10,3,SMPHR10,"ECHO-DISPATCH"),true);
+
+    FRTTLine line = comm10.getLine(TASK1);
+
+    assertEqual(comm10.dispatch(line),-1);                                                                          /* NO TABLE */
+
+    table.handlers[(uint8_t)Datatypes::eINTPTR] = sumHandler;
+    table.context = &sum;
+    comm10.setDatatypeTable(&table);
+
+    assertEqual(comm10.dispatch(line),0);                                                                           /* NOTHING BUFFERED */
+
+    assertEqual(comm10.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[0],100,100,0),true);
+    assertEqual(comm10.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR + 1,&values[1],100,100,0),true);              /* NO HANDLER, IGNORED */
+    assertEqual(comm10.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[2],100,100,0),true);
+    assertEqual(comm10.readManyFromQueue(line,3,100,100),3);
+
+    assertEqual(comm10.dispatch(line),3);
+    assertEqual(sum,301);
+    assertEqual(comm10.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),0);
+
+    comm10.setDatatypeTable(nullptr);
+}
+
+test(datatypeIndex_TEST11)
+{
+    /*  Typed queries follow insertions, evictions and deletions of the buffer */
+    comm11.addDataAllocateCallback(dataAllocator);
+    comm11.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int values[5] = {10,20,30,40,50};
+    uint8_t types[5] = {(uint8_t)Datatypes::eINTPTR,(uint8_t)Datatypes::eCHARPTR,(uint8_t)Datatypes::eINTPTR,(uint8_t)Datatypes::eRANDOM1,200};
+    uint8_t u8Position = 0;
+
+    assertEqual(comm11.addCommPartner(TASK1,QUEUE11,3,SMPHR11,QUEUE11,3,SMPHR11,"ECHO-INDEX"),true);
+
+    FRTTLine line = comm11.getLine(TASK1);
+
+    for(uint8_t u8I = 0;u8I < 5;u8I++)
+    {
+        assertEqual(comm11.writeToQueue(TASK1,types[u8I],&values[u8I],100,100,0),true);
+        assertEqual(comm11.readFromQueue(line,100,100),true);                                                      /* 10 AND 20 EVICTED */
+    }
+
+    assertEqual(comm11.isDatatypeInBuffer(line,(uint8_t)Datatypes::eINTPTR),1);
+    assertEqual(comm11.isDatatypeInBuffer(line,(uint8_t)Datatypes::eCHARPTR),0);
+    assertEqual(comm11.isDatatypeInBuffer(line,200),1);                                                            /* NOT INDEXED, SCANNED */
+    assertTrue(comm11.getOldestBufferedDataOfType(line,(uint8_t)Datatypes::eCHARPTR) == nullptr);
+
+    assertEqual(*((int *)comm11.getNewestBufferedDataOfType(line,(uint8_t)Datatypes::eRANDOM1,&u8Position)->data),40);
+    assertEqual(u8Position,(uint8_t)1);
+    assertEqual(comm11.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,u8Position),true);      /* 40 REMOVED */
+    assertEqual(comm11.isDatatypeInBuffer(line,(uint8_t)Datatypes::eRANDOM1),0);
+
+    assertEqual(*((int *)comm11.getOldestBufferedDataOfType(line,200,&u8Position)->data),50);
+    assertEqual(u8Position,(uint8_t)1);
+
+    assertEqual(comm11.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm11.isDatatypeInBuffer(line,(uint8_t)Datatypes::eINTPTR),0);
+}
+
+test(inlinePayload_TEST12)
+{
+    /*  Small payloads are copied into the data package, the allocate callback is not needed for them */
+    comm12.addDataAllocateCallback(dataAllocator);
+    comm12.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    uint8_t au8Bytes[FRTTRANSCEIVER_INLINEPAYLOADSIZE + 1];
+    for(uint8_t u8I = 0;u8I < sizeof(au8Bytes);u8I++)
+    {
+        au8Bytes[u8I] = u8I + 1;
+    }
+    int writeOperation = 42;
+
+    assertEqual(comm12.addCommPartner(TASK1,QUEUE12,3,SMPHR12,QUEUE12,3,SMPHR12,"ECHO-INLINE"),true);
+
+    FRTTLine line = comm12.getLine(TASK1);
+
+    assertEqual(comm12.writeInlineToQueue(line,(uint8_t)Datatypes::eRANDOM1,au8Bytes,sizeof(au8Bytes),100,100,0),false);   /* TOO BIG */
+    assertEqual(comm12.writeInlineToQueue(line,(uint8_t)Datatypes::eRANDOM1,nullptr,1,100,100,0),false);
+    assertEqual(comm12.writeInlineToQueue(TASK1,(uint8_t)Datatypes::eRANDOM1,au8Bytes,FRTTRANSCEIVER_INLINEPAYLOADSIZE,100,100,7),true);
+    assertEqual(comm12.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&writeOperation,100,100,8),true);
+    assertEqual(comm12.readFromQueue(line,100,100),true);
+    assertEqual(comm12.readFromQueue(line,100,100),true);
+
+    const FRTTTempDataContainer * inlineData = comm12.getOldestBufferedDataOfType(line,(uint8_t)Datatypes::eRANDOM1);
+    assertTrue(inlineData != nullptr);
+    assertEqual(inlineData->u8InlineSize,(uint8_t)FRTTRANSCEIVER_INLINEPAYLOADSIZE);
+    assertEqual(inlineData->u32AdditionalData,(uint32_t)7);
+    assertEqual(memcmp(FRTTGetPayload(*inlineData),au8Bytes,FRTTRANSCEIVER_INLINEPAYLOADSIZE),0);
+
+    /* Pointer packages are still allocated */
+    assertEqual(*((const int *)FRTTGetPayload(*comm12.getNewestBufferedDataOfType(line,(uint8_t)Datatypes::eINTPTR))),42);
+
+    assertEqual(comm12.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(fireAndForget_TEST13)
+{
+    /*  Fire-and-forget writes do not need the tx semaphore */
+    comm13.addDataAllocateCallback(dataAllocator);
+    comm13.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int writeOperation1 = 1;
+    int writeOperation2 = 2;
+
+    assertEqual(comm13.addCommPartner(TASK1,QUEUE13,3,SMPHR13,QUEUE13,3,SMPHR13,"ECHO-FIREANDFORGET"),true);
+    assertEqual(comm13.setFireAndForget(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true,true),false);                /* UNKNOWN PARTNER */
+
+    assertEqual(xSemaphoreTake(SMPHR13,0),pdTRUE);                                                                    /* SEMAPHORE HELD BY SOMEONE ELSE */
+    assertEqual(comm13.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&writeOperation1,0,0,0),false);
+
+    assertEqual(comm13.setFireAndForget(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,true),true);
+    assertEqual(comm13.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&writeOperation1,0,0,0),true);
+    assertEqual(comm13.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&writeOperation2,0,0,0),true);
+    xSemaphoreGive(SMPHR13);
+
+    assertEqual(comm13.readManyFromQueue(comm13.getLine(TASK1),3,100,100),2);
+    assertEqual(*((int *)comm13.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),1);
+    assertEqual(*((int *)comm13.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),2);
+
+    assertEqual(comm13.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(lineHandle_TEST14)
+{
+    /*  Writes and reads through a FRTT::FRTTLine. Handles of other objects are rejected */
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int writeOperation1 = 1;
+    int writeOperation2 = 2;
+
+    FRTTCommunicationPartner otherPartner[1];
+    FRTTransceiver other(T_VALID,&otherPartner[0],1);
+
+    assertEqual(comm14.addCommPartner(TASK1,QUEUE14,3,SMPHR14,QUEUE14,3,SMPHR14,"ECHO-LINE"),true);
+
+    FRTTLine line = comm14.getLine(TASK1);
+
+    assertEqual(comm14.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,1),false);               /* NO CALLBACKS YET */
+
+    comm14.addDataAllocateCallback(dataAllocator);
+    comm14.addDataFreeCallback(destroyer);
+
+    assertEqual(comm14.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&writeOperation1,100,100,1),true);
+    assertEqual(comm14.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&writeOperation2,100,100,2),true);
+    assertEqual(comm14.messagesOnQueue(TASK1,true),2);
+    assertEqual(comm14.readFromQueue(line,100,100),true);
+    assertEqual(comm14.readFromQueue(line,100,100),true);
+
+    assertEqual(*((int *)comm14.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),1);
+    assertEqual(*((int *)comm14.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),2);
+    assertEqual(comm14.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u32AdditionalData,(uint32_t)2);
+
+    /* Same slot and generation, but created by another object */
+    other.addDataAllocateCallback(dataAllocator);
+    other.addDataFreeCallback(destroyer);
+    assertEqual(other.addCommPartner(TASK1,QUEUE14,3,SMPHR14,QUEUE14,3,SMPHR14,"ECHO-OTHER"),true);
+    FRTTLine otherLine = other.getLine(TASK1);
+    assertEqual(otherLine.u8Slot,line.u8Slot);
+    assertTrue(otherLine != line);
+    assertEqual(comm14.writeToQueue(otherLine,(uint8_t)Datatypes::eINTPTR,&writeOperation1,0,0,0),false);
+    assertEqual(comm14.readFromQueue(otherLine,0,0),false);
+    assertEqual(comm14.messagesOnQueue(TASK1,true),0);
+
+    assertEqual(comm14.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(readMany_TEST15)
+{
+    /*  Reads several data packages with one call. Only the first one is waited for, a full buffer releases its oldest data */
+    comm15.addDataAllocateCallback(dataAllocator);
+    comm15.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int values[5] = {10,20,30,40,50};
+
+    assertEqual(comm15.addCommPartner(TASK1,QUEUE15,3,SMPHR15,QUEUE15,3,SMPHR15,"ECHO-MANY"),true);
+
+    FRTTLine line = comm15.getLine(TASK1);
+
+    assertEqual(comm15.readManyFromQueue(line,3,10,10),0);                                                            /* EMPTY LINE */
+    assertEqual(comm15.readManyFromQueue(line,0,10,10),0);
+
+    for(uint8_t u8I = 0;u8I < 3;u8I++)
+    {
+        assertEqual(comm15.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[u8I],100,100,u8I),true);
+    }
+
+    assertEqual(comm15.readManyFromQueue(line,2,100,100),2);                                                          /* PARTIAL READ */
+    assertEqual(comm15.messagesOnQueue(TASK1,true),1);
+    assertEqual(comm15.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),2);
+    assertEqual(comm15.readManyFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,10,100,100),1);              /* ONLY ONE LEFT */
+    assertEqual(*((int *)comm15.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),10);
+    assertEqual(*((int *)comm15.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),30);
+
+    assertEqual(comm15.delNewestDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);             /* BUFFER NEARLY FULL (10,20) */
+    assertEqual(comm15.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[3],100,100,3),true);
+    assertEqual(comm15.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[4],100,100,4),true);
+    assertEqual(comm15.readManyFromQueue(line,3,100,100),2);                                                          /* 10 RELEASED */
+    assertEqual(comm15.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),3);
+    assertEqual(*((int *)comm15.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),20);
+    assertEqual(*((int *)comm15.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,1)->data),40);
+    assertEqual(*((int *)comm15.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),50);
+    assertEqual(comm15.readManyFromQueue(line,3,10,10),0);
+
+    assertEqual(comm15.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(ownershipTransfer_TEST16)
+{
+    /*  With ownership transfer the buffer keeps the senders pointer. Only the free callback runs, once per buffer entry */
+    comm16.addDataAllocateCallback(countingAllocator);
+    comm16.addDataFreeCallback(countingDestroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    int values[5] = {10,20,30,40,50};
+
+    assertEqual(comm16.addCommPartner(TASK1,QUEUE16,3,SMPHR16,QUEUE16,3,SMPHR16,"ECHO-OWNERSHIP"),true);
+    assertEqual(comm16.setOwnershipTransfer(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true,true),false);        /* UNKNOWN PARTNER */
+    assertEqual(comm16.setOwnershipTransfer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,true),true);
+
+    for(uint8_t u8I = 0;u8I < 3;u8I++)
+    {
+        assertEqual(comm16.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[u8I],100,100,u8I),true);
+        assertEqual(comm16.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);
+    }
+
+    assertEqual(u8AllocateCalls,(uint8_t)0);
+    assertEqual(u8FreeCalls,(uint8_t)0);
+    assertTrue(comm16.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data == &values[0]);  /* SENDERS POINTER */
+    assertTrue(comm16.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data == &values[2]);
+    assertEqual(comm16.setOwnershipTransfer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,false),false);          /* DATA BUFFERED */
+
+    assertEqual(comm16.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[3],100,100,3),true);
+    assertEqual(comm16.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);               /* BUFFER FULL -> 10 RELEASED */
+    assertEqual(u8FreeCalls,(uint8_t)1);
+    assertTrue(lastFreedData == &values[0]);
+
+    assertEqual(comm16.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,0),true);               /* 20 RELEASED */
+    assertEqual(u8FreeCalls,(uint8_t)2);
+    assertTrue(lastFreedData == &values[1]);
+
+    assertEqual(comm16.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);              /* 30 AND 40 RELEASED */
+    assertEqual(u8FreeCalls,(uint8_t)4);
+    assertEqual(u8AllocateCalls,(uint8_t)0);
+
+    assertEqual(comm16.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[3],100,100,3),true);
+    assertEqual(comm16.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[4],100,100,4),true);
+    assertEqual(comm16.queueFlush(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,false),true);                /* RX FLUSH -> 40 AND 50 RELEASED */
+    assertEqual(u8FreeCalls,(uint8_t)6);
+    assertTrue(lastFreedData == &values[4]);
+
+    assertEqual(comm16.setOwnershipTransfer(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,false),true);
+    assertEqual(comm16.writeToQueue(TASK1,(uint8_t)Datatypes::eINTPTR,&values[4],100,100,4),true);
+    assertEqual(comm16.readFromQueue(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);               /* ALLOCATED AGAIN */
+    assertEqual(u8AllocateCalls,(uint8_t)1);
+
+    assertEqual(comm16.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(u8FreeCalls,(uint8_t)7);
+}
+
+test(deepLineStorage_TEST17)
+{
+    /*  Buffer positions beyond 127 of a deep communication line. Written until the circular buffer wrapped around once */
+    comm17.addDataAllocateCallback(dataAllocator);
+    comm17.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    static FRTTLineStorage<200> storage;
+    static int values[300];
+
+    assertEqual(comm17.addCommPartner(TASK1,QUEUE17,200,SMPHR17,QUEUE17,200,SMPHR17,storage,"ECHO-DEEP"),true);
+
+    FRTTLine line = comm17.getLine(TASK1);
+
+    for(uint16_t u16I = 0;u16I < 200;u16I++)
+    {
+        values[u16I] = u16I;
+        assertEqual(comm17.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&values[u16I],0,0,u16I),true);
+    }
+    assertEqual(comm17.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&values[0],0,0,0),false);                       /* QUEUE FULL */
+
+    for(uint16_t u16I = 0;u16I < 200;u16I++)
+    {
+        assertEqual(comm17.readFromQueue(line,0,0),true);
+    }
+
+    assertEqual(comm17.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),200);                        /* BUFFER FULL */
+    assertEqual(*((int *)comm17.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,150)->data),150);
+    assertEqual(*((int *)comm17.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),199);
+
+    for(uint16_t u16I = 200;u16I < 300;u16I++)
+    {
+        values[u16I] = u16I;
+        assertEqual(comm17.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&values[u16I],0,0,u16I),true);
+        assertEqual(comm17.readFromQueue(line,0,0),true);                                                            /* OLDEST RELEASED */
+    }
+
+    assertEqual(comm17.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),200);
+    assertEqual(*((int *)comm17.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),100);
+    assertEqual(*((int *)comm17.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,150)->data),250);   /* HEAD + POSITION > 255 */
+    assertEqual(*((int *)comm17.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),299);
+    assertEqual(comm17.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u32AdditionalData,(uint32_t)299);
+    assertEqual(comm17.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,200),nullptr);
+
+    assertEqual(comm17.delDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,180),true);                /* 280 REMOVED */
+    assertEqual(*((int *)comm17.getBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true,180)->data),281);
+    assertEqual(comm17.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),199);
+
+    assertEqual(comm17.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(deepRing_TEST18)
+{
+    /*  A ring longer than FRTTRANSCEIVER_MAXELEMENTSIZEONQUEUE only fits a line with its own storage */
+    comm18.addDataAllocateCallback(dataAllocator);
+    comm18.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID);
+
+    static FRTTLineStorage<64> storage;
+    static int values[64];
+
+    assertTrue(RING18 != nullptr);
+    assertEqual(comm18.addCommPartner(TASK1,RING18,RING18,"ECHO-RING"),false);                                      /* EMBEDDED STORAGE TOO SHORT */
+    assertEqual(comm18.addCommPartner(TASK1,RING18,RING18,storage,"ECHO-RING"),true);
+
+    FRTTLine line = comm18.getLine(TASK1);
+
+    for(uint8_t u8I = 0;u8I < 64;u8I++)
+    {
+        values[u8I] = u8I;
+        assertEqual(comm18.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&values[u8I],0,0,u8I),true);
+    }
+    assertEqual(comm18.writeToQueue(line,(uint8_t)Datatypes::eINTPTR,&values[0],0,0,0),false);                       /* RING FULL */
+    assertEqual(comm18.messagesOnQueue(TASK1,false),64);
+
+    for(uint8_t u8I = 0;u8I < 64;u8I++)
+    {
+        assertEqual(comm18.readFromQueue(line,0,0),true);
+    }
+
+    assertEqual(comm18.bufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),64);
+    assertEqual(*((int *)comm18.getOldestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),0);
+    assertEqual(*((int *)comm18.getNewestBufferedDataFrom(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),63);
+
+    assertEqual(comm18.delAllDatabuffForLine(TASK1,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    while(!Serial);                     
+    log_i("\n\n");
+
+
+    QUEUE = FRTTCreateQueue(3);
+    QUEUE2 = FRTTCreateQueue(3);
+    QUEUE3 = FRTTCreateQueue(3);
+    QUEUE4 = FRTTCreateQueue(3);
+
+    QUEUE5 = FRTTCreateQueue(3);
+    QUEUE6 = FRTTCreateQueue(3);
+    QUEUE7 = FRTTCreateQueue(3);
+
+    SMPHR = FRTTCreateSemaphore();
+    SMPHR2 = FRTTCreateSemaphore();
+    SMPHR3 = FRTTCreateSemaphore();
+    SMPHR4 = FRTTCreateSemaphore();
+    
+    SMPHR5 = FRTTCreateSemaphore();
+    SMPHR6 = FRTTCreateSemaphore();
+    SMPHR7 = FRTTCreateSemaphore();
+
+    RING = FRTTCreateSpscRing(3);
+
+    QUEUE8 = FRTTCreateQueue(3);
+    SMPHR8 = FRTTCreateSemaphore();
+
+    QUEUE9 = FRTTCreateQueue(3);
+    SMPHR9 = FRTTCreateSemaphore();
+
+    QUEUE10 = FRTTCreateQueue(3);
+    SMPHR10 = FRTTCreateSemaphore();
+
+    QUEUE11 = FRTTCreateQueue(3);
+    SMPHR11 = FRTTCreateSemaphore();
+
+    QUEUE12 = FRTTCreateQueue(3);
+    SMPHR12 = FRTTCreateSemaphore();
+
+    QUEUE13 = FRTTCreateQueue(3);
+    SMPHR13 = FRTTCreateSemaphore();
+
+    QUEUE14 = FRTTCreateQueue(3);
+    SMPHR14 = FRTTCreateSemaphore();
+
+    QUEUE15 = FRTTCreateQueue(3);
+    SMPHR15 = FRTTCreateSemaphore();
+
+    QUEUE16 = FRTTCreateQueue(3);
+    SMPHR16 = FRTTCreateSemaphore();
+
+    QUEUE17 = FRTTCreateQueue(200);
+    SMPHR17 = FRTTCreateSemaphore();
+
+    RING18 = FRTTCreateSpscRing(64);
+
+    log_i("This test should produce the following:");
+    log_i("18 passed, 0 failed, 0 skipped, 0 timed out, out of 18 test(s).");
+    log_i("----------\n\n");
+}
+
+
+
+void loop()
+{
+    TestRunner::run();
+} 
+
+
+void sumHandler(FRTTransceiver & transceiver,FRTTLine line,const FRTTTempDataContainer & data,void * context)
+{
+    *((int *)context) += *((int *)data.data);
+}
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    temp.data = orig.data;
+    temp.senderAddress = orig.senderAddress;
+    temp.u32AdditionalData = orig.u32AdditionalData;
+    temp.u8DataType = orig.u8DataType;
+}
+void destroyer(FRTTTempDataContainer & temp)
+{
+      /* nothing to do */      
+}
+
+void countingAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    u8AllocateCalls++;
+    dataAllocator(orig,temp);
+}
+void countingDestroyer(FRTTTempDataContainer & temp)
+{
+    u8FreeCalls++;
+    lastFreedData = temp.data;
+}
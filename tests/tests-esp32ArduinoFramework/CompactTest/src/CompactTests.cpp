@@ -0,0 +1,145 @@
+#include <AUnit.h>
+#include "CompactTests.h"
+
+using namespace aunit;
+
+/* Every object registers the id of its owner task while it is constructed */
+#if (DYNAMIC_STRUCTARRAY == 1)
+FRTTransceiver comm(T_VALID,2);
+FRTTransceiver commSender(T_VALID2,1);
+FRTTransceiver commSender2(T_VALID2,1);
+#else
+FRTTCommunicationPartner partner[2];
+FRTTransceiver comm(T_VALID,&partner[0],2);
+FRTTCommunicationPartner partnerSender[1];
+FRTTransceiver commSender(T_VALID2,&partnerSender[0],1);
+FRTTCommunicationPartner partnerSender2[1];
+FRTTransceiver commSender2(T_VALID2,&partnerSender2[0],1);
+#endif
+
+test(compactLayout_TEST1)
+{
+    /* The 8 bit sender id replaces the task handle, the data package still has no padding */
+    assertEqual((uint32_t)sizeof(FRTTDataContainerOnQueue),FRTTPackedDataContainerSize);
+    assertTrue(FRTTPackedDataContainerSize < FRTTAlignUp(FRTTPackedDataContainerSize - sizeof(uint8_t) + sizeof(FRTTTaskHandle),alignof(FRTTDataContainerOnQueue)));
+
+    assertEqual(FRTTSenderId(nullptr),(uint8_t)0);
+    assertTrue(FRTTSenderAddress(0) == nullptr);
+    assertTrue(FRTTSenderAddress(FRTTSenderId(T_VALID)) == T_VALID);
+}
+
+test(senderOfBufferedData_TEST2)
+{
+    /* The buffered entry resolves to the task handle of the writer */
+    comm.addDataAllocateCallback(dataAllocator);
+    comm.addDataFreeCallback(destroyer);
+    commSender.addDataAllocateCallback(dataAllocator);
+    commSender.addDataFreeCallback(destroyer);
+
+    assertEqual(comm.addCommPartner(T_VALID2,QUEUE,3,SMPHR,nullptr,0,nullptr,"SENDER"),true);
+    assertEqual(commSender.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE,3,SMPHR,"RECEIVER"),true);
+
+    int value = 1;
+
+    assertEqual(commSender.writeToQueue(T_VALID,eINTPTR,&value,100,100,0),true);
+    assertEqual(comm.readFromQueue(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);
+
+    const FRTTTempDataContainer * buffered = comm.getNewestBufferedDataFrom(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+    assertTrue(buffered != nullptr);
+    assertEqual(buffered->u8SenderId,FRTTSenderId(T_VALID2));
+    assertTrue(FRTTGetSender(*buffered) == T_VALID2);
+
+    assertEqual(comm.delAllDatabuffForLine(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+test(sharedSenderId_TEST3)
+{
+    /* Two objects of the same task stamp the same id (commSender2 writes on a multi-sender queue of comm) */
+    commSender2.addDataAllocateCallback(dataAllocator);
+    commSender2.addDataFreeCallback(destroyer);
+
+    assertEqual(comm.addMultiSenderPartner(QUEUE2,3,SMPHR2,"MULTI"),true);
+    assertEqual(commSender2.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE2,3,SMPHR2,"RECEIVER"),true);
+
+    int value = 2;
+
+    assertEqual(commSender2.writeToQueue(T_VALID,eINTPTR,&value,100,100,0),true);
+    assertEqual(comm.readFromQueue(nullptr,eMultiSenderQueue::eMULTISENDERQ0,false,100,100),true);
+
+    const FRTTTempDataContainer * buffered = comm.getNewestBufferedDataFrom(nullptr,eMultiSenderQueue::eMULTISENDERQ0,false);
+    assertTrue(buffered != nullptr);
+    assertNotEqual(buffered->u8SenderId,(uint8_t)0);
+    assertEqual(buffered->u8SenderId,FRTTSenderId(T_VALID2));
+    assertTrue(FRTTGetSender(*buffered) == T_VALID2);
+
+    assertEqual(comm.delAllDatabuffForLine(nullptr,eMultiSenderQueue::eMULTISENDERQ0,false),true);
+}
+
+test(unknownSender_TEST4)
+{
+    /* Runs last: fills the registry. Tasks without an id send the unknown sender (id 0), known ids keep working */
+    for(uint16_t u16I = 0;u16I < FRTTRANSCEIVER_SENDERIDS;u16I++)
+    {
+        FRTTSenderId((FRTTTaskHandle)(uintptr_t)(0x100 + u16I));
+    }
+    assertEqual(FRTTSenderId((FRTTTaskHandle)(uintptr_t)(0x100 + FRTTRANSCEIVER_SENDERIDS)),(uint8_t)0);
+    assertTrue(FRTTSenderAddress(FRTTSenderId(T_VALID2)) == T_VALID2);
+
+    FRTTransceiver commLate(T_LATE,1);
+
+    commLate.addDataAllocateCallback(dataAllocator);
+    commLate.addDataFreeCallback(destroyer);
+
+    assertEqual(commLate.addCommPartner(T_LATE,QUEUE3,3,SMPHR3,QUEUE3,3,SMPHR3,"ECHO"),true);
+
+    int value = 3;
+
+    assertEqual(commLate.writeToQueue(T_LATE,eINTPTR,&value,100,100,0),true);
+    assertEqual(commLate.readFromQueue(T_LATE,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),true);
+
+    const FRTTTempDataContainer * buffered = commLate.getNewestBufferedDataFrom(T_LATE,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+    assertTrue(buffered != nullptr);
+    assertEqual(buffered->u8SenderId,(uint8_t)0);
+    assertTrue(FRTTGetSender(*buffered) == nullptr);
+
+    assertEqual(commLate.delAllDatabuffForLine(T_LATE,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+}
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    while(!Serial);
+    log_i("\n\n");
+
+    QUEUE = FRTTCreateQueue(3);
+    SMPHR = FRTTCreateSemaphore();
+    QUEUE2 = FRTTCreateQueue(3);
+    SMPHR2 = FRTTCreateSemaphore();
+    QUEUE3 = FRTTCreateQueue(3);
+    SMPHR3 = FRTTCreateSemaphore();
+
+    TestRunner::setTimeout(0);          // Let the tests run as long as possible (~18Hrs)
+
+    log_i("This test should produce the following:");
+    log_i("4 passed, 0 failed, 0 skipped, 0 timed out, out of 4 test(s).");
+    log_i("----------\n\n");
+}
+
+
+void loop()
+{
+    TestRunner::run();
+}
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    temp.data = orig.data;
+    temp.u32AdditionalData = orig.u32AdditionalData;
+    temp.u8DataType = orig.u8DataType;
+    temp.u8SenderId = orig.u8SenderId;
+}
+void destroyer(FRTTTempDataContainer & temp)
+{
+    /* nothing to do */
+}
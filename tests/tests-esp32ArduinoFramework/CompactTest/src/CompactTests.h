@@ -0,0 +1,29 @@
+#include "FRTTransceiver.h"
+
+using namespace FRTT;
+
+#if !defined(FRTTRANSCEIVER_COMPACTDATAPACKAGE)
+#error "CompactTest needs FRTTRANSCEIVER_COMPACTDATAPACKAGE (see build_flags in platformio.ini)"
+#endif
+
+#define DYNAMIC_STRUCTARRAY 1
+
+enum Datatypes
+{
+    eINTPTR = 0
+};
+
+FRTTTaskHandle T_VALID = (FRTTTaskHandle) 0x1;
+FRTTTaskHandle T_VALID2 = (FRTTTaskHandle) 0x2;
+FRTTTaskHandle T_VALID3 = (FRTTTaskHandle) 0x3;
+FRTTTaskHandle T_LATE = (FRTTTaskHandle) 0x4;
+
+FRTTQueueHandle QUEUE;
+FRTTSemaphoreHandle SMPHR;
+FRTTQueueHandle QUEUE2;
+FRTTSemaphoreHandle SMPHR2;
+FRTTQueueHandle QUEUE3;
+FRTTSemaphoreHandle SMPHR3;
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp);
+void destroyer(FRTTTempDataContainer & temp);
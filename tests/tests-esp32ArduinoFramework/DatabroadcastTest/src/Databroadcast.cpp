@@ -1,153 +1,251 @@
-
-#include <AUnit.h>
-#include "Databroadcast.h"
-
-using namespace aunit;
-
-#if (DYNAMIC_STRUCTARRAY == 1)
-FRTTransceiver comm1(T_VALID,5);
-FRTTransceiver comm2(T_VALID,5);  
-FRTTransceiver comm3(T_VALID,2);                
-FRTTransceiver comm4(T_VALID,3);                
-#else
-FRTTCommunicationPartner partners1[5];
-FRTTCommunicationPartner partners2[5];
-FRTTCommunicationPartner partners3[2];
-FRTTCommunicationPartner partners4[3];
-
-FRTTransceiver comm1(T_VALID,&partners1[0],5);
-FRTTransceiver comm2(T_VALID,&partners2[0],5);  
-FRTTransceiver comm3(T_VALID,&partners3[0],2);                
-FRTTransceiver comm4(T_VALID,&partners4[0],3);               
-#endif
-
-test(twoOutOfFourTxQueuesDB)
-{   
-    comm1.addDataAllocateCallback(dataAllocator);
-    comm1.addDataFreeCallback(destroyer);
-
-    uint8_t u8Data = 15;
-
-    assertEqual(comm1.addCommPartner(T_VALID,nullptr,0,nullptr,Q_VALID,1,S_VALID,"1"),true);                    /* TX QUEUE ADDED */
-    assertEqual(comm1.addCommPartner(T_VALID2,nullptr,0,nullptr,Q_VALID2,1,S_VALID2,"2"),true);                 /* TX QUEUE ADDED */
-
-    assertEqual(comm1.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,nullptr,0,nullptr,"RX-1"),true);              /* RX QUEUE ADDED */
-    assertEqual(comm1.addCommPartner(T_VALID4,Q_VALID4,1,S_VALID4,nullptr,0,nullptr,"RX-2"),true);              /* RX QUEUE ADDED */
-
-    assertEqual(comm1.addMultiSenderPartner(Q_VALID5,1,S_VALID5,"MULTI-1"),true);                               /* Multi-Sender-Queue added */
-    assertEqual(comm1.addMultiSenderPartner(Q_VALID5,1,S_VALID6,"MULTI-2"),false);                              /* Multi-Sender-Queue adde, no connetions left, will fail */
-
-    assertEqual(comm1.databroadcast(0,&u8Data,500,500,0),true);             /* broadcast to two tx-queues (500ms waittime for the write operation, 500ms waittime for semaphore) */
-    /* broadcast towards two tx-queues (2ms waittime for the write operation, 2ms waittime for semaphore). Will fail since we already posted data to those queues*/
-    assertEqual(comm1.databroadcast(0,&u8Data,2,2,0),false); 
-}
-
-test(noTxQueuesForDatabroadcast)
-{
-    comm2.addDataAllocateCallback(dataAllocator);
-    comm2.addDataFreeCallback(destroyer);
-
-    uint8_t u8Data = 15;
-
-    assertEqual(comm2.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,"RX-1"),true);         /* RX QUEUE ADDED */
-    assertEqual(comm2.addCommPartner(T_VALID2,Q_VALID2,1,S_VALID2,nullptr,0,nullptr,"RX-2"),true);      /* RX QUEUE ADDED */
-
-    assertEqual(comm2.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,nullptr,0,nullptr,"RX-3"),true);      /* RX QUEUE ADDED */
-    assertEqual(comm2.addCommPartner(T_VALID4,Q_VALID4,1,S_VALID4,nullptr,0,nullptr,"RX-4"),true);      /* RX QUEUE ADDED */
-
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID5,1,S_VALID5,"MULTI-1"),true);                       /* Multi-Sender-Queue */
-    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6,"MULTI-2"),false);                      /* Multi-Sender-Queue, no connections left, will fail */
-
-    assertEqual(comm2.databroadcast(0,&u8Data,500,500,0),false);                                        /* Gonna fail, since we do not have a tx queue */
-    assertEqual(comm2.databroadcast(0,&u8Data,2,2,0),false);                                            /* Gonna fail again, since we still do not have a tx queue */
-}
-
-test(oneOfTwoTxQueuesDB)
-{
-    comm3.addDataAllocateCallback(dataAllocator);
-    comm3.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-    FRTTTaskHandle TASK2 = (FRTTTaskHandle)(T_VALID + 0x6);
-
-    uint8_t u8Data = 15;
-    assertEqual(comm3.addCommPartner(T_VALID,nullptr,0,nullptr,Q_VALID6,1,S_VALID6,"TX-1"),true);          /* TX QUEUE ADDED */
-    assertEqual(comm3.addCommPartner(T_VALID2,Q_VALID,1,S_VALID,nullptr,0,nullptr,"RX-1"),true);        /* RX QUEUE ADDED */
-
-    assertEqual(comm3.databroadcast(0,&u8Data,500,500,0),true); /* One tx queue for databroadcasting available */
-}
-
-test(threeOfThreeTxQueuesDB)
-{
-    comm4.addDataAllocateCallback(dataAllocator);
-    comm4.addDataFreeCallback(destroyer);
-
-    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
-    FRTTTaskHandle TASK2 = (FRTTTaskHandle)(T_VALID + 0x2);
-    FRTTTaskHandle TASK3 = (FRTTTaskHandle)(T_VALID + 0x3);
-
-    uint8_t u8Data = 15;
-    
-    assertEqual(comm4.addCommPartner(TASK1,nullptr,0,nullptr,Q_VALID7,1,S_VALID7,"1"),true);    /* TX QUEUE ADDED */
-    assertEqual(comm4.addCommPartner(TASK2,nullptr,0,nullptr,Q_VALID8,1,S_VALID8,"2"),true);    /* TX QUEUE ADDED */
-    assertEqual(comm4.addCommPartner(TASK3,nullptr,0,nullptr,Q_VALID9,1,S_VALID9,"3"),true);    /* TX QUEUE ADDED */
-
-    assertEqual(comm4.databroadcast(0,&u8Data,500,500,0),true); /* 3 tx queues. everything must pass. */
-}
-
-void setup()
-{
-    vTaskDelay(pdMS_TO_TICKS(2500));
-    Serial.begin(115200);               // For the internal printer of TestRunner
-    while(!Serial);                     
-    log_i("\n\n");
-    
-    Q_VALID = FRTTCreateQueue(1);
-    Q_VALID2 = FRTTCreateQueue(1);
-    Q_VALID3 = FRTTCreateQueue(1);
-    Q_VALID4 = FRTTCreateQueue(1);
-    Q_VALID5 = FRTTCreateQueue(1);
-    Q_VALID6 = FRTTCreateQueue(1);
-    Q_VALID7 = FRTTCreateQueue(1);
-    Q_VALID8 = FRTTCreateQueue(1);
-    Q_VALID9 = FRTTCreateQueue(1);
-
-    S_VALID = FRTTCreateSemaphore();
-    S_VALID2 = FRTTCreateSemaphore();
-    S_VALID3 = FRTTCreateSemaphore();
-    S_VALID4 = FRTTCreateSemaphore();
-    S_VALID5 = FRTTCreateSemaphore();
-    S_VALID6 = FRTTCreateSemaphore();
-    S_VALID7 = FRTTCreateSemaphore();
-    S_VALID8 = FRTTCreateSemaphore();
-    S_VALID9 = FRTTCreateSemaphore();
-
-
-
-    TestRunner::setTimeout(0);          // Let the tests run as long as possible (~18Hrs)
-
-    log_i("This test should produce the following:");
-    log_i("4 passed, 0 failed, 0 skipped, 0 timed out, out of 4 test(s).");
-    log_i("----------\n\n");
-
-    
-}
-
-
-void loop()
-{
-    TestRunner::run();
-} 
-
-
-void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
-{
-    temp.data = orig.data;
-    temp.senderAddress = orig.senderAddress;
-    temp.u32AdditionalData = orig.u32AdditionalData;
-    temp.u8DataType = orig.u8DataType;
-}
-void destroyer(FRTTTempDataContainer & temp)
-{
-      /* nothing to do */      
+
+#include <AUnit.h>
+#include "Databroadcast.h"
+
+using namespace aunit;
+
+#if (DYNAMIC_STRUCTARRAY == 1)
+FRTTransceiver comm1(T_VALID,5);
+FRTTransceiver comm2(T_VALID,5);  
+FRTTransceiver comm3(T_VALID,2);                
+FRTTransceiver comm4(T_VALID,3);                
+FRTTransceiver comm5(T_VALID,2);
+FRTTransceiver comm6(T_VALID2,1);
+FRTTransceiver comm7(T_VALID3,1);
+FRTTransceiver comm8(T_VALID,3);
+#else
+FRTTCommunicationPartner partners1[5];
+FRTTCommunicationPartner partners2[5];
+FRTTCommunicationPartner partners3[2];
+FRTTCommunicationPartner partners4[3];
+FRTTCommunicationPartner partners5[2];
+FRTTCommunicationPartner partners6[1];
+FRTTCommunicationPartner partners7[1];
+FRTTCommunicationPartner partners8[3];
+
+FRTTransceiver comm1(T_VALID,&partners1[0],5);
+FRTTransceiver comm2(T_VALID,&partners2[0],5);  
+FRTTransceiver comm3(T_VALID,&partners3[0],2);                
+FRTTransceiver comm4(T_VALID,&partners4[0],3);               
+FRTTransceiver comm5(T_VALID,&partners5[0],2);
+FRTTransceiver comm6(T_VALID2,&partners6[0],1);
+FRTTransceiver comm7(T_VALID3,&partners7[0],1);
+FRTTransceiver comm8(T_VALID,&partners8[0],3);
+#endif
+
+uint8_t u8SharedFrees = 0;
+
+test(twoOutOfFourTxQueuesDB)
+{   
+    comm1.addDataAllocateCallback(dataAllocator);
+    comm1.addDataFreeCallback(destroyer);
+
+    uint8_t u8Data = 15;
+
+    assertEqual(comm1.addCommPartner(T_VALID,nullptr,0,nullptr,Q_VALID,1,S_VALID,"1"),true);                    /* TX QUEUE ADDED */
+    assertEqual(comm1.addCommPartner(T_VALID2,nullptr,0,nullptr,Q_VALID2,1,S_VALID2,"2"),true);                 /* TX QUEUE ADDED */
+
+    assertEqual(comm1.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,nullptr,0,nullptr,"RX-1"),true);              /* RX QUEUE ADDED */
+    assertEqual(comm1.addCommPartner(T_VALID4,Q_VALID4,1,S_VALID4,nullptr,0,nullptr,"RX-2"),true);              /* RX QUEUE ADDED */
+
+    assertEqual(comm1.addMultiSenderPartner(Q_VALID5,1,S_VALID5,"MULTI-1"),true);                               /* Multi-Sender-Queue added */
+    assertEqual(comm1.addMultiSenderPartner(Q_VALID5,1,S_VALID6,"MULTI-2"),false);                              /* Multi-Sender-Queue adde, no connetions left, will fail */
+
+    assertEqual(comm1.databroadcast(0,&u8Data,500,500,0),true);             /* broadcast to two tx-queues (500ms waittime for the write operation, 500ms waittime for semaphore) */
+    /* broadcast towards two tx-queues (2ms waittime for the write operation, 2ms waittime for semaphore). Will fail since we already posted data to those queues*/
+    assertEqual(comm1.databroadcast(0,&u8Data,2,2,0),false); 
+}
+
+test(noTxQueuesForDatabroadcast)
+{
+    comm2.addDataAllocateCallback(dataAllocator);
+    comm2.addDataFreeCallback(destroyer);
+
+    uint8_t u8Data = 15;
+
+    assertEqual(comm2.addCommPartner(T_VALID,Q_VALID,1,S_VALID,nullptr,0,nullptr,"RX-1"),true);         /* RX QUEUE ADDED */
+    assertEqual(comm2.addCommPartner(T_VALID2,Q_VALID2,1,S_VALID2,nullptr,0,nullptr,"RX-2"),true);      /* RX QUEUE ADDED */
+
+    assertEqual(comm2.addCommPartner(T_VALID3,Q_VALID3,1,S_VALID3,nullptr,0,nullptr,"RX-3"),true);      /* RX QUEUE ADDED */
+    assertEqual(comm2.addCommPartner(T_VALID4,Q_VALID4,1,S_VALID4,nullptr,0,nullptr,"RX-4"),true);      /* RX QUEUE ADDED */
+
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID5,1,S_VALID5,"MULTI-1"),true);                       /* Multi-Sender-Queue */
+    assertEqual(comm2.addMultiSenderPartner(Q_VALID6,1,S_VALID6,"MULTI-2"),false);                      /* Multi-Sender-Queue, no connections left, will fail */
+
+    assertEqual(comm2.databroadcast(0,&u8Data,500,500,0),false);                                        /* Gonna fail, since we do not have a tx queue */
+    assertEqual(comm2.databroadcast(0,&u8Data,2,2,0),false);                                            /* Gonna fail again, since we still do not have a tx queue */
+}
+
+test(oneOfTwoTxQueuesDB)
+{
+    comm3.addDataAllocateCallback(dataAllocator);
+    comm3.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+    FRTTTaskHandle TASK2 = (FRTTTaskHandle)(T_VALID + 0x6);
+
+    uint8_t u8Data = 15;
+    assertEqual(comm3.addCommPartner(T_VALID,nullptr,0,nullptr,Q_VALID6,1,S_VALID6,"TX-1"),true);          /* TX QUEUE ADDED */
+    assertEqual(comm3.addCommPartner(T_VALID2,Q_VALID,1,S_VALID,nullptr,0,nullptr,"RX-1"),true);        /* RX QUEUE ADDED */
+
+    assertEqual(comm3.databroadcast(0,&u8Data,500,500,0),true); /* One tx queue for databroadcasting available */
+}
+
+test(threeOfThreeTxQueuesDB)
+{
+    comm4.addDataAllocateCallback(dataAllocator);
+    comm4.addDataFreeCallback(destroyer);
+
+    FRTTTaskHandle TASK1 = (FRTTTaskHandle)(T_VALID + 0x1);
+    FRTTTaskHandle TASK2 = (FRTTTaskHandle)(T_VALID + 0x2);
+    FRTTTaskHandle TASK3 = (FRTTTaskHandle)(T_VALID + 0x3);
+
+    uint8_t u8Data = 15;
+    
+    assertEqual(comm4.addCommPartner(TASK1,nullptr,0,nullptr,Q_VALID7,1,S_VALID7,"1"),true);    /* TX QUEUE ADDED */
+    assertEqual(comm4.addCommPartner(TASK2,nullptr,0,nullptr,Q_VALID8,1,S_VALID8,"2"),true);    /* TX QUEUE ADDED */
+    assertEqual(comm4.addCommPartner(TASK3,nullptr,0,nullptr,Q_VALID9,1,S_VALID9,"3"),true);    /* TX QUEUE ADDED */
+
+    assertEqual(comm4.databroadcast(0,&u8Data,500,500,0),true); /* 3 tx queues. everything must pass. */
+}
+
+test(sharedPayloadDB)
+{
+    comm5.addDataAllocateCallback(dataAllocator);
+    comm5.addDataFreeCallback(sharedDestroyer);
+
+    comm6.addDataAllocateCallback(dataAllocator);
+    comm6.addDataFreeCallback(destroyer);
+    comm7.addDataAllocateCallback(dataAllocator);
+    comm7.addDataFreeCallback(destroyer);
+
+    uint8_t * pu8Data = new uint8_t(15);
+
+    assertEqual(comm5.addCommPartner(T_VALID2,nullptr,0,nullptr,Q_VALID10,1,S_VALID10,"TX-1"),true);       /* TX QUEUE ADDED */
+    assertEqual(comm5.addCommPartner(T_VALID3,nullptr,0,nullptr,Q_VALID11,1,S_VALID11,"TX-2"),true);       /* TX QUEUE ADDED */
+    assertEqual(comm6.addCommPartner(T_VALID,Q_VALID10,1,S_VALID10,nullptr,0,nullptr,"RX-1"),true);        /* RX QUEUE ADDED */
+    assertEqual(comm7.addCommPartner(T_VALID,Q_VALID11,1,S_VALID11,nullptr,0,nullptr,"RX-2"),true);        /* RX QUEUE ADDED */
+
+    assertEqual(comm5.databroadcastShared(0,pu8Data,500,500,0),true);      /* One payload, two references */
+
+    assertEqual(comm6.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm7.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    /* Both receivers see the original data, nobody made a copy */
+    assertEqual(comm6.getNewestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data == pu8Data,true);
+    assertEqual(comm7.getNewestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data == pu8Data,true);
+
+    assertEqual(comm6.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(u8SharedFrees,(uint8_t)0);                                 /* Still referenced by the second receiver */
+    assertEqual(comm7.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(u8SharedFrees,(uint8_t)1);                                 /* Last reference gone, freed once */
+
+    #if (DYNAMIC_STRUCTARRAY == 0)
+    assertEqual(partners5[0].txLineContainer[0].data == nullptr,true);    /* The mirror does not keep the freed header */
+    #endif
+
+    assertEqual(comm5.databroadcastShared(0,new uint8_t(16),500,500,0),true);
+    assertEqual(comm6.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(comm7.queueFlush(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,false),true);      /* Flush releases the reference */
+    assertEqual(u8SharedFrees,(uint8_t)1);
+    assertEqual(comm6.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(u8SharedFrees,(uint8_t)2);
+
+    assertEqual(comm5.databroadcastShared(0,new uint8_t(17),500,500,0),true);
+    assertEqual(xSemaphoreTake(S_VALID11,0),pdTRUE);                                                     /* RX SEMAPHORE HELD BY SOMEONE ELSE */
+    assertEqual(comm7.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,0),false);      /* Received but dropped, releases the reference */
+    xSemaphoreGive(S_VALID11);
+    assertEqual(comm6.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,500,500),true);
+    assertEqual(u8SharedFrees,(uint8_t)2);
+    assertEqual(comm6.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(u8SharedFrees,(uint8_t)3);
+}
+
+test(fanOutDB)
+{
+    comm8.addDataAllocateCallback(dataAllocator);
+    comm8.addDataFreeCallback(destroyer);
+
+    uint8_t u8Data = 15;
+
+    assertEqual(comm8.addCommPartner(T_VALID2,nullptr,0,nullptr,Q_VALID12,1,S_VALID12,"TX-1"),true);       /* TX QUEUE ADDED, slot 0 */
+    assertEqual(comm8.addCommPartner(T_VALID3,Q_VALID,1,S_VALID,nullptr,0,nullptr,"RX-1"),true);           /* RX QUEUE ADDED, slot 1 */
+    assertEqual(comm8.addCommPartner(T_VALID4,nullptr,0,nullptr,Q_VALID13,1,S_VALID13,"TX-2"),true);       /* TX QUEUE ADDED, slot 2 */
+
+    assertEqual(comm8.writeToQueue(T_VALID4,0,&u8Data,0,0,0),true);                                        /* TX-2 is full now */
+
+    /* TX-1 is served right away, TX-2 stays full until the deadline (20ms) */
+    assertEqual(comm8.databroadcastFanOut(0,&u8Data,20,0) == (1ull << comm8.getLine(T_VALID2).u8Slot),true);
+    /* Both full */
+    assertEqual(comm8.databroadcastFanOut(0,&u8Data,20,0) == 0,true);
+}
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    while(!Serial);                     
+    log_i("\n\n");
+    
+    Q_VALID = FRTTCreateQueue(1);
+    Q_VALID2 = FRTTCreateQueue(1);
+    Q_VALID3 = FRTTCreateQueue(1);
+    Q_VALID4 = FRTTCreateQueue(1);
+    Q_VALID5 = FRTTCreateQueue(1);
+    Q_VALID6 = FRTTCreateQueue(1);
+    Q_VALID7 = FRTTCreateQueue(1);
+    Q_VALID8 = FRTTCreateQueue(1);
+    Q_VALID9 = FRTTCreateQueue(1);
+    Q_VALID10 = FRTTCreateQueue(1);
+    Q_VALID11 = FRTTCreateQueue(1);
+    Q_VALID12 = FRTTCreateQueue(1);
+    Q_VALID13 = FRTTCreateQueue(1);
+
+    S_VALID = FRTTCreateSemaphore();
+    S_VALID2 = FRTTCreateSemaphore();
+    S_VALID3 = FRTTCreateSemaphore();
+    S_VALID4 = FRTTCreateSemaphore();
+    S_VALID5 = FRTTCreateSemaphore();
+    S_VALID6 = FRTTCreateSemaphore();
+    S_VALID7 = FRTTCreateSemaphore();
+    S_VALID8 = FRTTCreateSemaphore();
+    S_VALID9 = FRTTCreateSemaphore();
+    S_VALID10 = FRTTCreateSemaphore();
+    S_VALID11 = FRTTCreateSemaphore();
+    S_VALID12 = FRTTCreateSemaphore();
+    S_VALID13 = FRTTCreateSemaphore();
+
+
+
+    TestRunner::setTimeout(0);          // Let the tests run as long as possible (~18Hrs)
+
+    log_i("This test should produce the following:");
+    log_i("6 passed, 0 failed, 0 skipped, 0 timed out, out of 6 test(s).");
+    log_i("----------\n\n");
+
+    
+}
+
+
+void loop()
+{
+    TestRunner::run();
+} 
+
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    temp.data = orig.data;
+    temp.senderAddress = orig.senderAddress;
+    temp.u32AdditionalData = orig.u32AdditionalData;
+    temp.u8DataType = orig.u8DataType;
+}
+void destroyer(FRTTTempDataContainer & temp)
+{
+      /* nothing to do */      
+}
+
+void sharedDestroyer(FRTTTempDataContainer & temp)
+{
+    delete (uint8_t *)temp.data;
+    u8SharedFrees++;
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <AUnit.h>
+#include "PoolTests.h"
+
+using namespace aunit;
+
+FRTTStaticPool<sizeof(Sample),2> samplePool;
+FRTTStaticPool<sizeof(uint8_t),3> bytePool;
+
+#if (DYNAMIC_STRUCTARRAY == 1)
+FRTTransceiver comm(T_VALID,1);
+#else
+FRTTCommunicationPartner partner[1];
+FRTTransceiver comm(T_VALID,&partner[0],1);
+#endif
+
+test(poolAllocateRelease_TEST1)
+{
+    /* Exhaustion and high-water mark are reported, released blocks are reused */
+    void * block1 = samplePool.allocate();
+    void * block2 = samplePool.allocate();
+
+    assertEqual(block1 != nullptr && block2 != nullptr && block1 != block2,true);
+    assertEqual(samplePool.owns(block1),true);
+    assertEqual(samplePool.owns((uint8_t *)block1 + 1),false);
+    assertEqual(samplePool.allocate() == nullptr,true);                                            /* EXHAUSTED */
+
+    FRTTPoolStatistics stats = samplePool.getStatistics();
+    assertEqual(stats.u16InUse,(uint16_t)2);
+    assertEqual(stats.u16HighWater,(uint16_t)2);
+    assertEqual(stats.u32Exhausted,(uint32_t)1);
+
+    samplePool.release(block1);
+    assertEqual(samplePool.allocate() == block1,true);                                             /* O(1) REUSE */
+    samplePool.release(block1);
+    samplePool.release(block2);
+
+    samplePool.resetStatistics();
+    assertEqual(samplePool.getStatistics().u16HighWater,(uint16_t)0);
+    assertEqual(samplePool.getStatistics().u32Exhausted,(uint32_t)0);
+}
+
+test(poolCallbacks_TEST2)
+{
+    /* Ready-made callbacks copy received data into the pool of its datatype */
+    assertEqual(FRTTPoolRegister(eSAMPLE,samplePool,sizeof(Sample) + 1),false);                    /* PAYLOAD BIGGER THAN BLOCK */
+    assertEqual(FRTTPoolRegister(eSAMPLE,samplePool,sizeof(Sample)),true);
+    assertEqual(FRTTPoolRegister(eBYTE,bytePool,sizeof(uint8_t)),true);
+
+    comm.addDataAllocateCallback(FRTTPoolAllocateCallback);
+    comm.addDataFreeCallback(FRTTPoolFreeCallback);
+
+    assertEqual(comm.addCommPartner(T_VALID,QUEUE,3,SMPHR,QUEUE,3,SMPHR,PARTNERNAME),true);
+
+    Sample sample;
+    sample.u32Timestamp = 100;
+    sample.fValue = 1.5f;
+    uint8_t u8Byte = 9;
+
+    assertEqual(comm.writeToQueue(T_VALID,eSAMPLE,&sample,100,100,0),true);
+    assertEqual(comm.writeToQueue(T_VALID,eBYTE,&u8Byte,100,100,0),true);
+    assertEqual(comm.readManyFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,2,100,100),2);
+
+    const FRTTTempDataContainer * t = comm.getOldestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true);
+    assertEqual(samplePool.owns(t->data),true);                                                     /* COPY LIVES IN THE POOL */
+    assertEqual(((Sample *)t->data)->u32Timestamp,(uint32_t)100);
+    assertEqual(*((uint8_t *)comm.getNewestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),(uint8_t)9);
+
+    assertEqual(comm.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(samplePool.getStatistics().u16InUse,(uint16_t)0);
+    assertEqual(bytePool.getStatistics().u16InUse,(uint16_t)0);
+}
+
+test(poolExhausted_TEST3)
+{
+    /* A data package the pool cannot take is dropped, the buffered data stays untouched */
+    assertEqual(FRTTPoolRegister(eSAMPLE,samplePool,sizeof(Sample)),true);
+
+    comm.addDataAllocateCallback(FRTTPoolAllocateCallback);
+    comm.addDataFreeCallback(FRTTPoolFreeCallback);
+
+    Sample samples[3];
+    for(uint8_t u8I = 0;u8I < 3;u8I++)
+    {
+        samples[u8I].u32Timestamp = u8I;
+        samples[u8I].fValue = 0.5f;
+    }
+
+    for(uint8_t u8I = 0;u8I < 3;u8I++)
+    {
+        assertEqual(comm.writeToQueue(T_VALID,eSAMPLE,&samples[u8I],100,100,0),true);
+    }
+    assertEqual(comm.readManyFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,3,100,100),2);           /* POOL HOLDS 2 BLOCKS, THIRD ONE DROPPED */
+    assertEqual(comm.bufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),2);
+    assertEqual(comm.messagesOnQueue(T_VALID,true),0);
+
+    assertEqual(comm.writeToQueue(T_VALID,eSAMPLE + 10,&samples[0],100,100,0),true);                             /* NO POOL FOR THIS DATATYPE */
+    assertEqual(comm.readFromQueue(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,100),false);
+    assertEqual(comm.bufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),2);
+    assertEqual(((Sample *)comm.getNewestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data)->u32Timestamp,(uint32_t)1);
+
+    assertEqual(comm.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(samplePool.getStatistics().u16InUse,(uint16_t)0);
+}
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    while(!Serial);                     
+    log_i("\n\n");
+
+    QUEUE = FRTTCreateQueue(3);
+    SMPHR = FRTTCreateSemaphore();
+
+    TestRunner::setTimeout(0);          // Let the tests run as long as possible (~18Hrs)
+
+    log_i("This test should produce the following:");
+    log_i("3 passed, 0 failed, 0 skipped, 0 timed out, out of 3 test(s).");
+    log_i("----------\n\n");
+}
+
+
+void loop()
+{
+    TestRunner::run();
+} 
@@ -0,0 +1,24 @@
+#include "FRTTransceiver.h"
+
+using namespace FRTT;
+
+#define DYNAMIC_STRUCTARRAY 1
+
+#define PARTNERNAME         ("ABC")
+
+enum Datatypes
+{
+    eSAMPLE = 0,
+    eBYTE
+};
+
+struct Sample
+{
+    uint32_t u32Timestamp;
+    float fValue;
+};
+
+FRTTTaskHandle T_VALID = (FRTTTaskHandle) 0x1;
+
+FRTTQueueHandle QUEUE;
+FRTTSemaphoreHandle SMPHR;
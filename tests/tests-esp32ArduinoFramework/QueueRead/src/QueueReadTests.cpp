@@ -1,219 +1,447 @@
-
-#include <AUnit.h>
-#include "QueueReadTests.h"
-#include <chrono>
-#include "Arduino.h"
-
-using namespace aunit;
-
-#if (DYNAMIC_STRUCTARRAY == 1)
-FRTTransceiver comm1(T_VALID,1);
-FRTTransceiver comm2(T_VALID,1);
-#else
-FRTTCommunicationPartner partners1[1];
-FRTTCommunicationPartner partners2[1];
-FRTTransceiver comm1(T_VALID,&partners1[0],1);
-FRTTransceiver comm2(T_VALID,&partners2[0],1);
-#endif
-
-test(queueRead_TEST1)
-{
-    /*          Some queueRead operations + time measurement 
-     *               - Not 100% accurate because delay() in use by the other task has a 1ms inaccuracy (havent checked the reason)
-     *               - Also..If you give READ6-TEST a blockTimeRead of 1 in the last queueRead() (instead of 2) will let the test finish
-     *                 within 900-1000us (WILL FAIL TEST). Not concerning right now.. Everything works as expected with a blockTimeRead of 2 (300-400us) (havent checked the reason yet)
-     *               - Just to get a first impression that queue-read runs >>almost<< as expected!
-     */
-    while(TASK_SENDER == nullptr) vTaskDelay(pdMS_TO_TICKS(1));
-
-    comm1.addDataAllocateCallback(dataAllocator);
-    comm1.addDataFreeCallback(destroyer);
-    comm1.addCommPartner(TASK_SENDER,QUEUE,3,SMPHR,QUEUE1,3,SMPHR1,"TASK-SENDER");  /* TX QUEUE IS USED TO SYNCHRONIZE WITH OTHER TASK */
-
-    
-    int dummy = 0;
-    uint32_t s;
-    uint32_t ms;
-    uint32_t us;
-    
-    printf("\n########\n\nTEST OUTPUT(Finishes after approx. 30.5s):\n\n");
-
-    // ############################################ TEST1 ############################################ 
-
-    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
-    auto s1 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,2,0),true);   // waits maximal 2ms (waittime for data) and 0ms (waittime to get semaphore)
-    auto e1 = std::chrono::high_resolution_clock::now() - s1;
-    us = std::chrono::duration_cast<std::chrono::microseconds>(e1).count();                 // should be arround 1000us
-    assertLessOrEqual((uint32_t)us,(uint32_t)1200);
-    printf("READ1 waited[%lld us]\n",(unsigned long long)us);
-
-    // ############################################ TEST2 ############################################
-
-    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,true),true);          // for synchronization with other task
-    auto s2 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,FRTTRANSCEIVER_WAITMAX,0),true); // waits a MAXTIME (waittime for data) and 0ms (waittime to get semaphore))
-    auto e2 = std::chrono::high_resolution_clock::now() - s2;
-    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e2).count();                 // should be somewhat around 200ms
-    assertLessOrEqual((uint32_t)ms,(uint32_t)200);
-    printf("READ2 waited[%lld ms]\n",(unsigned long long)ms);
-
-    // ############################################ TEST3 ############################################
-
-    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
-    auto s3 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,2000,0),true);       // waits a max of 2000ms (waittime for data) and 0ms (waittime to get semaphore))
-    auto e3 = std::chrono::high_resolution_clock::now() - s3;
-    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e3).count();                 // should be somewhat around 1750ms
-    assertLessOrEqual((uint32_t)ms,(uint32_t)1750);
-    printf("READ3 waited[%lld ms]\n",(unsigned long long)ms);
-
-    // ############################################ TEST4 ############################################
-
-    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,true),true);          // for synchronization with other task
-    auto s4 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,0),false);       // waits a max of 100ms (waittime for data) and 0ms (waittime to get semaphore))
-    auto e4 = std::chrono::high_resolution_clock::now() - s4;
-    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e4).count();                 // should be around 100ms (will not get data in time)
-    assertLessOrEqual((uint32_t)ms,(uint32_t)100);
-    printf("READ4 waited[%lld ms]\n",(unsigned long long)ms);
-
-
-    // ############################################ TEST5 ############################################
-    delay(400);
-    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),1);                                // We will have one message on queue because we didnt wait long enough (last block)
-    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,false),true);         // Remove last message sent by task 
-    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),0);                                // Zero messages, queue flushed!
-                                                                                            
-    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
-    auto s5 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,9990,0),false);      // waits a max of 9990ms (waittime for data) and 0ms (waittime to get semaphore))
-    auto e5 = std::chrono::high_resolution_clock::now() - s5;
-    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e5).count();                 // should be around 9990ms (will not get data in time)
-    assertLessOrEqual((uint32_t)ms,(uint32_t)9990);
-    printf("READ5 waited[%lld ms]\n",(unsigned long long)ms);
-    
-    // ############################################ TEST6 ############################################
-
-    delay(100);
-    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),1);                                // We will have one message on queue because we didnt wait long enough (last block)
-    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,false),true);         // Remove last message sent by task (we didnt get the message in time)
-    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),0);                                // Zero messages, queue flushed!
-
-    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,true),true);          // for synchronization with other task
-    auto s6 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,1,1),true);          // waits a max of 1ms (waittime for data) and 1ms (waittime to get semaphore))
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,1,1),true);          // waits a max of 1ms (waittime for data) and 1ms (waittime to get semaphore))
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,2,1),true);          // waits a max of 2ms (waittime for data) and 1ms (waittime to get semaphore))
-    //assertEqual(comm1.readFromQueue(TASK_SENDER,eNOMULTIQSELECTED,true,1,1),true);        // >>>>>>>  WILL FAIL THE TEST because of the 1ms blocktime to get permission to read, ALTHOUGH IT SHOULDNT! <<<<<<<<<
-    auto e6 = std::chrono::high_resolution_clock::now() - s6;
-    us = std::chrono::duration_cast<std::chrono::microseconds>(e6).count();                 // should be < 800us for all queue-read operations combined
-    assertLessOrEqual((uint32_t)us,(uint32_t)800);
-    printf("READ6 waited[%lld us]\n",(unsigned long long)us);
-
-    // ############################################ TEST7 ############################################
-
-    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
-    auto s7 = std::chrono::high_resolution_clock::now();
-    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,FRTTRANSCEIVER_WAITMAX,0),true);    // waits a MAXTIME (waittime for data) and 0ms (waittime to get semaphore))
-    auto e7 = std::chrono::high_resolution_clock::now() - s7;
-    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e7).count();                 // should be around 17990ms (will get data in time)
-    assertLessOrEqual((uint32_t)ms,(uint32_t)18000);
-    printf("READ7 waited[%lld ms]\n",(unsigned long long)ms);
-    printf("\n########\n\n");
-}
-void TASKSENDER(void * pvParams)
-{
-
-    comm2.addDataAllocateCallback(dataAllocator);
-    comm2.addDataFreeCallback(destroyer);
-
-    comm2.addCommPartner(T_VALID,QUEUE1,3,SMPHR1,QUEUE,3,SMPHR,"TEST-TASK");        /* RX QUEUE IS USED TO SYNCHRONIZE WITH TEST TASK */
-
-    int a = 15;
-    
-    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
-    
-    delayMicroseconds(1000);                                    // delay(1) did not delay properly for 1ms, other task will max wait 2ms (will receive data)
-    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
-
-    while(comm2.messagesOnQueue(T_VALID,false) > 0);            // sync with test-task
-        
-    delay(200);                                                 // delay for 200ms, other task will max wait 400ms (will receive data)
-    comm2.writeToQueue(T_VALID,0,&a,0,0,0);                 
-    
-    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
-    
-    delay(1750);                                                // delay for 2000ms, other task will max wait 2000ms (will receive data)
-    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
-
-    while(comm2.messagesOnQueue(T_VALID,false) > 0);            // sync with test-task
-
-    delay(500);                                                 // delay for 500ms, other task will max wait 100ms (will NOT receive data)
-    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
-
-    
-    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
-    
-    delay(10000);                                               // delay for 10000ms, other task will max wait 9990ms (will NOT receive data)
-    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
-
-    while(comm2.messagesOnQueue(T_VALID,false) > 0);            // sync with test-task
-
-                                                                // no delay, other task will read each message right away
-    comm2.writeToQueue(T_VALID,0,&a,1,1,0);                     
-    comm2.writeToQueue(T_VALID,0,&a,1,1,0);
-    delayMicroseconds(300);
-    comm2.writeToQueue(T_VALID,0,&a,1,1,0);
-
-    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
-
-    delay(17990);                                               // delay for ~18s, other task will max wait 18s (will receive data)
-    comm2.writeToQueue(T_VALID,0,&a,1,1,0); 
-
-    vTaskDelete(nullptr);
-}
-
-void setup()
-{
-    vTaskDelay(pdMS_TO_TICKS(2500));
-    Serial.begin(115200);               // For the internal printer of TestRunner
-    disableCore0WDT();
-    while(!Serial);                     
-    log_i("\n\n");
-
-    QUEUE = FRTTCreateQueue(3);
-    QUEUE1 = FRTTCreateQueue(3);
-
-    SMPHR = FRTTCreateSemaphore();
-    SMPHR1 = FRTTCreateSemaphore();
-    
-
-    log_i("This test should produce the following:");
-    log_i("1 passed, 0 failed, 0 skipped, 0 timed out, out of 1 test(s).");
-    log_i("----------\n\n");
-
-    xTaskCreatePinnedToCore(TASKSENDER,"task-sender",5000,nullptr,8,&TASK_SENDER,0);
-}
-
-
-
-void loop()
-{
-    TestRunner::run();
-}
-
-
-
-void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
-{
-    temp.data = orig.data;
-    temp.senderAddress = orig.senderAddress;
-    temp.u32AdditionalData = orig.u32AdditionalData;
-    temp.u8DataType = orig.u8DataType;
-}
-void destroyer(FRTTTempDataContainer & temp)
-{
-      /* nothing to do */      
-}
-
+
+#include <AUnit.h>
+#include "QueueReadTests.h"
+#include <chrono>
+#include "Arduino.h"
+
+using namespace aunit;
+
+#if (DYNAMIC_STRUCTARRAY == 1)
+FRTTransceiver comm1(T_VALID,1);
+FRTTransceiver comm2(T_VALID,1);
+FRTTransceiver comm3(T_VALID,2);
+FRTTransceiver comm4(T_VALID2,1);
+FRTTransceiver comm5(T_VALID3,1);
+FRTTransceiver comm6(T_VALID,2);
+FRTTransceiver comm7(T_VALID2,1);
+FRTTransceiver comm8(T_VALID3,1);
+FRTTransceiver comm9(T_VALID,1);
+FRTTransceiver comm10(T_VALID,2);
+FRTTransceiver comm11(T_VALID2,1);
+FRTTransceiver comm12(T_VALID3,1);
+#else
+FRTTCommunicationPartner partners1[1];
+FRTTCommunicationPartner partners2[1];
+FRTTCommunicationPartner partners3[2];
+FRTTCommunicationPartner partners4[1];
+FRTTCommunicationPartner partners5[1];
+FRTTCommunicationPartner partners6[2];
+FRTTCommunicationPartner partners7[1];
+FRTTCommunicationPartner partners8[1];
+FRTTCommunicationPartner partners9[1];
+FRTTCommunicationPartner partners10[2];
+FRTTCommunicationPartner partners11[1];
+FRTTCommunicationPartner partners12[1];
+FRTTransceiver comm1(T_VALID,&partners1[0],1);
+FRTTransceiver comm2(T_VALID,&partners2[0],1);
+FRTTransceiver comm3(T_VALID,&partners3[0],2);
+FRTTransceiver comm4(T_VALID2,&partners4[0],1);
+FRTTransceiver comm5(T_VALID3,&partners5[0],1);
+FRTTransceiver comm6(T_VALID,&partners6[0],2);
+FRTTransceiver comm7(T_VALID2,&partners7[0],1);
+FRTTransceiver comm8(T_VALID3,&partners8[0],1);
+FRTTransceiver comm9(T_VALID,&partners9[0],1);
+FRTTransceiver comm10(T_VALID,&partners10[0],2);
+FRTTransceiver comm11(T_VALID2,&partners11[0],1);
+FRTTransceiver comm12(T_VALID3,&partners12[0],1);
+#endif
+
+test(queueRead_TEST1)
+{
+    /*          Some queueRead operations + time measurement 
+     *               - Not 100% accurate because delay() in use by the other task has a 1ms inaccuracy (havent checked the reason)
+     *               - Also..If you give READ6-TEST a blockTimeRead of 1 in the last queueRead() (instead of 2) will let the test finish
+     *                 within 900-1000us (WILL FAIL TEST). Not concerning right now.. Everything works as expected with a blockTimeRead of 2 (300-400us) (havent checked the reason yet)
+     *               - Just to get a first impression that queue-read runs >>almost<< as expected!
+     */
+    while(TASK_SENDER == nullptr) vTaskDelay(pdMS_TO_TICKS(1));
+
+    comm1.addDataAllocateCallback(dataAllocator);
+    comm1.addDataFreeCallback(destroyer);
+    comm1.addCommPartner(TASK_SENDER,QUEUE,3,SMPHR,QUEUE1,3,SMPHR1,"TASK-SENDER");  /* TX QUEUE IS USED TO SYNCHRONIZE WITH OTHER TASK */
+
+    
+    int dummy = 0;
+    uint32_t s;
+    uint32_t ms;
+    uint32_t us;
+    
+    printf("\n########\n\nTEST OUTPUT(Finishes after approx. 30.5s):\n\n");
+
+    // ############################################ TEST1 ############################################ 
+
+    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
+    auto s1 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,2,0),true);   // waits maximal 2ms (waittime for data) and 0ms (waittime to get semaphore)
+    auto e1 = std::chrono::high_resolution_clock::now() - s1;
+    us = std::chrono::duration_cast<std::chrono::microseconds>(e1).count();                 // should be arround 1000us
+    assertLessOrEqual((uint32_t)us,(uint32_t)1200);
+    printf("READ1 waited[%lld us]\n",(unsigned long long)us);
+
+    // ############################################ TEST2 ############################################
+
+    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,true),true);          // for synchronization with other task
+    auto s2 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,FRTTRANSCEIVER_WAITMAX,0),true); // waits a MAXTIME (waittime for data) and 0ms (waittime to get semaphore))
+    auto e2 = std::chrono::high_resolution_clock::now() - s2;
+    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e2).count();                 // should be somewhat around 200ms
+    assertLessOrEqual((uint32_t)ms,(uint32_t)200);
+    printf("READ2 waited[%lld ms]\n",(unsigned long long)ms);
+
+    // ############################################ TEST3 ############################################
+
+    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
+    auto s3 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,2000,0),true);       // waits a max of 2000ms (waittime for data) and 0ms (waittime to get semaphore))
+    auto e3 = std::chrono::high_resolution_clock::now() - s3;
+    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e3).count();                 // should be somewhat around 1750ms
+    assertLessOrEqual((uint32_t)ms,(uint32_t)1750);
+    printf("READ3 waited[%lld ms]\n",(unsigned long long)ms);
+
+    // ############################################ TEST4 ############################################
+
+    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,true),true);          // for synchronization with other task
+    auto s4 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,100,0),false);       // waits a max of 100ms (waittime for data) and 0ms (waittime to get semaphore))
+    auto e4 = std::chrono::high_resolution_clock::now() - s4;
+    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e4).count();                 // should be around 100ms (will not get data in time)
+    assertLessOrEqual((uint32_t)ms,(uint32_t)100);
+    printf("READ4 waited[%lld ms]\n",(unsigned long long)ms);
+
+
+    // ############################################ TEST5 ############################################
+    delay(400);
+    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),1);                                // We will have one message on queue because we didnt wait long enough (last block)
+    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,false),true);         // Remove last message sent by task 
+    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),0);                                // Zero messages, queue flushed!
+                                                                                            
+    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
+    auto s5 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,9990,0),false);      // waits a max of 9990ms (waittime for data) and 0ms (waittime to get semaphore))
+    auto e5 = std::chrono::high_resolution_clock::now() - s5;
+    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e5).count();                 // should be around 9990ms (will not get data in time)
+    assertLessOrEqual((uint32_t)ms,(uint32_t)9990);
+    printf("READ5 waited[%lld ms]\n",(unsigned long long)ms);
+    
+    // ############################################ TEST6 ############################################
+
+    delay(100);
+    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),1);                                // We will have one message on queue because we didnt wait long enough (last block)
+    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,false),true);         // Remove last message sent by task (we didnt get the message in time)
+    assertEqual(comm1.messagesOnQueue(TASK_SENDER,false),0);                                // Zero messages, queue flushed!
+
+    assertEqual(comm1.queueFlush(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,0,true),true);          // for synchronization with other task
+    auto s6 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,1,1),true);          // waits a max of 1ms (waittime for data) and 1ms (waittime to get semaphore))
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,1,1),true);          // waits a max of 1ms (waittime for data) and 1ms (waittime to get semaphore))
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,2,1),true);          // waits a max of 2ms (waittime for data) and 1ms (waittime to get semaphore))
+    //assertEqual(comm1.readFromQueue(TASK_SENDER,eNOMULTIQSELECTED,true,1,1),true);        // >>>>>>>  WILL FAIL THE TEST because of the 1ms blocktime to get permission to read, ALTHOUGH IT SHOULDNT! <<<<<<<<<
+    auto e6 = std::chrono::high_resolution_clock::now() - s6;
+    us = std::chrono::duration_cast<std::chrono::microseconds>(e6).count();                 // should be < 800us for all queue-read operations combined
+    assertLessOrEqual((uint32_t)us,(uint32_t)800);
+    printf("READ6 waited[%lld us]\n",(unsigned long long)us);
+
+    // ############################################ TEST7 ############################################
+
+    assertEqual(comm1.writeToQueue(TASK_SENDER,0,&dummy,0,0,0),true);                       // for synchronization with other task
+    auto s7 = std::chrono::high_resolution_clock::now();
+    assertEqual(comm1.readFromQueue(TASK_SENDER,eMultiSenderQueue::eNOMULTIQSELECTED,true,FRTTRANSCEIVER_WAITMAX,0),true);    // waits a MAXTIME (waittime for data) and 0ms (waittime to get semaphore))
+    auto e7 = std::chrono::high_resolution_clock::now() - s7;
+    ms = std::chrono::duration_cast<std::chrono::milliseconds>(e7).count();                 // should be around 17990ms (will get data in time)
+    assertLessOrEqual((uint32_t)ms,(uint32_t)18000);
+    printf("READ7 waited[%lld ms]\n",(unsigned long long)ms);
+    printf("\n########\n\n");
+}
+
+test(readFromAny_TEST2)
+{
+    /*          comm3 blocks on the rx queues of two partners at once (comm4, comm5 are the senders, all in this task) */
+    comm3.addDataAllocateCallback(dataAllocator);
+    comm3.addDataFreeCallback(destroyer);
+    comm4.addDataAllocateCallback(dataAllocator);
+    comm4.addDataFreeCallback(destroyer);
+    comm5.addDataAllocateCallback(dataAllocator);
+    comm5.addDataFreeCallback(destroyer);
+
+    assertEqual(comm3.addCommPartner(T_VALID2,QUEUE2,3,SMPHR2,nullptr,0,nullptr,"PARTNER2"),true);
+    assertEqual(comm3.addCommPartner(T_VALID3,QUEUE3,3,SMPHR3,nullptr,0,nullptr,"PARTNER3"),true);
+    assertEqual(comm4.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE2,3,SMPHR2,"ANY"),true);
+    assertEqual(comm5.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE3,3,SMPHR3,"ANY"),true);
+
+    FRTTLine line2 = comm3.getLine(T_VALID2);
+    FRTTLine line3 = comm3.getLine(T_VALID3);
+    int dummy = 0;
+
+    // nothing on any queue, waits the block-time
+    uint32_t start = millis();
+    assertEqual(comm3.readFromAny(50,0).u8Slot,(uint8_t)FRTTRANSCEIVER_INVALIDLINE);
+    assertMoreOrEqual((uint32_t)(millis() - start),(uint32_t)40);
+
+    // first line with data wins, data packages are taken in the order they arrived
+    assertEqual(comm5.writeToQueue(T_VALID,5,&dummy,0,0,0),true);
+    assertEqual(comm4.writeToQueue(T_VALID,4,&dummy,0,0,0),true);
+    assertEqual(comm5.writeToQueue(T_VALID,6,&dummy,0,0,0),true);
+
+    assertTrue(comm3.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == line3);
+    assertEqual(comm3.getNewestBufferedDataFrom(T_VALID3,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u8DataType,(uint8_t)5);
+    assertTrue(comm3.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == line2);
+    assertEqual(comm3.getNewestBufferedDataFrom(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u8DataType,(uint8_t)4);
+    assertTrue(comm3.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == line3);
+    assertEqual(comm3.getNewestBufferedDataFrom(T_VALID3,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u8DataType,(uint8_t)6);
+    assertEqual(comm3.readFromAny(0,0).u8Slot,(uint8_t)FRTTRANSCEIVER_INVALIDLINE);
+}
+
+test(serviceLines_TEST3)
+{
+    /*          comm6 services the rx queues of two partners (comm7, comm8 are the senders, all in this task) */
+    comm6.addDataAllocateCallback(dataAllocator);
+    comm6.addDataFreeCallback(destroyer);
+    comm7.addDataAllocateCallback(dataAllocator);
+    comm7.addDataFreeCallback(destroyer);
+    comm8.addDataAllocateCallback(dataAllocator);
+    comm8.addDataFreeCallback(destroyer);
+
+    assertEqual(comm6.addCommPartner(T_VALID2,QUEUE4,3,SMPHR4,nullptr,0,nullptr,"PARTNER2"),true);
+    assertEqual(comm6.addCommPartner(T_VALID3,QUEUE5,3,SMPHR5,nullptr,0,nullptr,"PARTNER3"),true);
+    assertEqual(comm7.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE4,3,SMPHR4,"SERVICE"),true);
+    assertEqual(comm8.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE5,3,SMPHR5,"SERVICE"),true);
+
+    FRTTLine line2 = comm6.getLine(T_VALID2);
+    FRTTLine line3 = comm6.getLine(T_VALID3);
+    int dummy = 0;
+
+    // nothing to read, weight 0 is not allowed
+    assertEqual(comm6.serviceLines(5,0),0);
+    assertEqual(comm6.setLineScheduling(line2,0,0),false);
+
+    // weighted round-robin (default): line2 gets two data packages per turn, line3 one
+    assertEqual(comm6.setLineScheduling(line2,0,2),true);
+    assertEqual(comm6.setLineScheduling(line3,1,1),true);
+    for(uint8_t u8I = 0; u8I < 3; u8I++)
+    {
+        assertEqual(comm7.writeToQueue(T_VALID,2,&dummy,0,0,0),true);
+        assertEqual(comm8.writeToQueue(T_VALID,3,&dummy,0,0,0),true);
+    }
+    assertEqual(comm6.serviceLines(3,0),3);
+    assertEqual(comm6.getServiceCount(line2),(uint32_t)2);
+    assertEqual(comm6.getServiceCount(line3),(uint32_t)1);
+    assertEqual(comm6.serviceLines(10,0),3);
+    assertEqual(comm6.getServiceCount(line2),(uint32_t)3);
+    assertEqual(comm6.getServiceCount(line3),(uint32_t)3);
+
+    // both buffers are full now, release them so nothing has to be skipped
+    assertEqual(comm6.delAllDatabuffForLine(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm6.delAllDatabuffForLine(T_VALID3,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+
+    // strict priority: line3 is emptied before line2 is read
+    comm6.resetServiceCounts();
+    comm6.setSchedulingPolicy(eFRTTSchedulingPolicy::e_STRICTPRIORITY);
+    for(uint8_t u8I = 0; u8I < 3; u8I++)
+    {
+        assertEqual(comm7.writeToQueue(T_VALID,2,&dummy,0,0,0),true);
+        assertEqual(comm8.writeToQueue(T_VALID,3,&dummy,0,0,0),true);
+    }
+    assertEqual(comm6.serviceLines(4,0),4);
+    assertEqual(comm6.getServiceCount(line3),(uint32_t)3);
+    assertEqual(comm6.getServiceCount(line2),(uint32_t)1);
+    assertEqual(comm6.serviceLines(4,0),2);
+    assertEqual(comm6.serviceLines(4,0),0);
+}
+
+test(serviceLinesFullBuffer_TEST4)
+{
+    /*          a budget bigger than the internal buffer must not release data that was not consumed yet */
+    comm9.addDataAllocateCallback(dataAllocator);
+    comm9.addDataFreeCallback(destroyer);
+
+    assertEqual(comm9.addCommPartner(T_VALID,QUEUE6,3,SMPHR6,QUEUE6,3,SMPHR6,"ECHO"),true);
+
+    int values[6] = {0,1,2,3,4,5};
+
+    for(uint8_t u8I = 0; u8I < 3; u8I++)
+    {
+        assertEqual(comm9.writeToQueue(T_VALID,0,&values[u8I],0,0,0),true);
+    }
+    assertEqual(comm9.serviceLines(10,0),3);
+    for(uint8_t u8I = 3; u8I < 6; u8I++)
+    {
+        assertEqual(comm9.writeToQueue(T_VALID,0,&values[u8I],0,0,0),true);
+    }
+
+    // buffer full: the line is skipped by both policies, the data stays on the queue
+    assertEqual(comm9.serviceLines(10,0),0);
+    comm9.setSchedulingPolicy(eFRTTSchedulingPolicy::e_STRICTPRIORITY);
+    assertEqual(comm9.serviceLines(10,0),0);
+    assertEqual(comm9.messagesOnQueue(T_VALID,false),3);
+    assertEqual(*((int *)comm9.getOldestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),0);
+
+    // one entry consumed, one data package read
+    assertEqual(comm9.delOldestDatabuffForLine(T_VALID),true);
+    assertEqual(comm9.serviceLines(10,0),1);
+    assertEqual(*((int *)comm9.getOldestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),1);
+    assertEqual(*((int *)comm9.getNewestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),3);
+
+    comm9.setSchedulingPolicy(eFRTTSchedulingPolicy::e_WEIGHTEDROUNDROBIN);
+    assertEqual(comm9.delAllDatabuffForLine(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+    assertEqual(comm9.serviceLines(10,0),2);
+    assertEqual(*((int *)comm9.getOldestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),4);
+    assertEqual(*((int *)comm9.getNewestBufferedDataFrom(T_VALID,eMultiSenderQueue::eNOMULTIQSELECTED,true)->data),5);
+    assertEqual(comm9.messagesOnQueue(T_VALID,false),0);
+}
+
+test(readFromAnyRing_TEST5)
+{
+    /*          comm10 blocks on a ring (comm11 writes) and on a queue (comm12 writes) that can only be read once the allocate callback is added */
+    comm10.addDataFreeCallback(destroyer);
+    comm11.addDataAllocateCallback(dataAllocator);
+    comm11.addDataFreeCallback(destroyer);
+    comm12.addDataAllocateCallback(dataAllocator);
+    comm12.addDataFreeCallback(destroyer);
+
+    assertEqual(comm10.addCommPartner(T_VALID2,RING,nullptr,"RING"),true);
+    assertEqual(comm10.addCommPartner(T_VALID3,QUEUE7,3,SMPHR7,nullptr,0,nullptr,"PARTNER3"),true);
+    assertEqual(comm11.addCommPartner(T_VALID,nullptr,RING,"ANY"),true);
+    assertEqual(comm12.addCommPartner(T_VALID,nullptr,0,nullptr,QUEUE7,3,SMPHR7,"ANY"),true);
+
+    FRTTLine lineRing = comm10.getLine(T_VALID2);
+    FRTTLine lineQueue = comm10.getLine(T_VALID3);
+    int dummy = 0;
+    uint32_t start;
+
+    // no line can be read: there is no queue set, the block-time is kept anyway
+    start = millis();
+    assertEqual(comm10.readFromAny(50,0).u8Slot,(uint8_t)FRTTRANSCEIVER_INVALIDLINE);
+    assertMoreOrEqual((uint32_t)(millis() - start),(uint32_t)40);
+
+    // the ring takes over the data of comm11 (no allocate callback needed): its signal is the only member of the queue set
+    assertEqual(comm10.setOwnershipTransfer(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true,true),true);
+    start = millis();
+    assertEqual(comm10.readFromAny(50,0).u8Slot,(uint8_t)FRTTRANSCEIVER_INVALIDLINE);
+    assertMoreOrEqual((uint32_t)(millis() - start),(uint32_t)40);
+    assertEqual(comm11.writeToQueue(T_VALID,1,&dummy,0,0,0),true);
+    assertTrue(comm10.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == lineRing);
+    assertEqual(comm10.delAllDatabuffForLine(T_VALID2,eMultiSenderQueue::eNOMULTIQSELECTED,true),true);
+
+    // data on the queue stays there until the allocate callback is added (queue set is rebuilt)
+    assertEqual(comm12.writeToQueue(T_VALID,2,&dummy,0,0,0),true);
+    assertEqual(comm10.readFromAny(10,0).u8Slot,(uint8_t)FRTTRANSCEIVER_INVALIDLINE);
+    comm10.addDataAllocateCallback(dataAllocator);
+    assertTrue(comm10.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == lineQueue);
+    assertEqual(comm10.getNewestBufferedDataFrom(T_VALID3,eMultiSenderQueue::eNOMULTIQSELECTED,true)->u8DataType,(uint8_t)2);
+
+    // both lines are members now
+    assertEqual(comm11.writeToQueue(T_VALID,3,&dummy,0,0,0),true);
+    assertTrue(comm10.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == lineRing);
+    assertEqual(comm12.writeToQueue(T_VALID,4,&dummy,0,0,0),true);
+    assertTrue(comm10.readFromAny(FRTTRANSCEIVER_WAITMAX,0) == lineQueue);
+    assertEqual(comm10.readFromAny(0,0).u8Slot,(uint8_t)FRTTRANSCEIVER_INVALIDLINE);
+}
+void TASKSENDER(void * pvParams)
+{
+
+    comm2.addDataAllocateCallback(dataAllocator);
+    comm2.addDataFreeCallback(destroyer);
+
+    comm2.addCommPartner(T_VALID,QUEUE1,3,SMPHR1,QUEUE,3,SMPHR,"TEST-TASK");        /* RX QUEUE IS USED TO SYNCHRONIZE WITH TEST TASK */
+
+    int a = 15;
+    
+    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
+    
+    delayMicroseconds(1000);                                    // delay(1) did not delay properly for 1ms, other task will max wait 2ms (will receive data)
+    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
+
+    while(comm2.messagesOnQueue(T_VALID,false) > 0);            // sync with test-task
+        
+    delay(200);                                                 // delay for 200ms, other task will max wait 400ms (will receive data)
+    comm2.writeToQueue(T_VALID,0,&a,0,0,0);                 
+    
+    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
+    
+    delay(1750);                                                // delay for 2000ms, other task will max wait 2000ms (will receive data)
+    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
+
+    while(comm2.messagesOnQueue(T_VALID,false) > 0);            // sync with test-task
+
+    delay(500);                                                 // delay for 500ms, other task will max wait 100ms (will NOT receive data)
+    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
+
+    
+    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
+    
+    delay(10000);                                               // delay for 10000ms, other task will max wait 9990ms (will NOT receive data)
+    comm2.writeToQueue(T_VALID,0,&a,0,0,0);
+
+    while(comm2.messagesOnQueue(T_VALID,false) > 0);            // sync with test-task
+
+                                                                // no delay, other task will read each message right away
+    comm2.writeToQueue(T_VALID,0,&a,1,1,0);                     
+    comm2.writeToQueue(T_VALID,0,&a,1,1,0);
+    delayMicroseconds(300);
+    comm2.writeToQueue(T_VALID,0,&a,1,1,0);
+
+    while(comm2.messagesOnQueue(T_VALID,false) == 0);           // sync with test-task
+
+    delay(17990);                                               // delay for ~18s, other task will max wait 18s (will receive data)
+    comm2.writeToQueue(T_VALID,0,&a,1,1,0); 
+
+    vTaskDelete(nullptr);
+}
+
+void setup()
+{
+    vTaskDelay(pdMS_TO_TICKS(2500));
+    Serial.begin(115200);               // For the internal printer of TestRunner
+    disableCore0WDT();
+    while(!Serial);                     
+    log_i("\n\n");
+
+    QUEUE = FRTTCreateQueue(3);
+    QUEUE1 = FRTTCreateQueue(3);
+
+    QUEUE2 = FRTTCreateQueue(3);
+    QUEUE3 = FRTTCreateQueue(3);
+    QUEUE4 = FRTTCreateQueue(3);
+    QUEUE5 = FRTTCreateQueue(3);
+    QUEUE6 = FRTTCreateQueue(3);
+    QUEUE7 = FRTTCreateQueue(3);
+    RING = FRTTCreateSpscRing(3);
+
+    SMPHR = FRTTCreateSemaphore();
+    SMPHR1 = FRTTCreateSemaphore();
+    SMPHR2 = FRTTCreateSemaphore();
+    SMPHR3 = FRTTCreateSemaphore();
+    SMPHR4 = FRTTCreateSemaphore();
+    SMPHR5 = FRTTCreateSemaphore();
+    SMPHR6 = FRTTCreateSemaphore();
+    SMPHR7 = FRTTCreateSemaphore();
+    
+
+    log_i("This test should produce the following:");
+    log_i("5 passed, 0 failed, 0 skipped, 0 timed out, out of 5 test(s).");
+    log_i("----------\n\n");
+
+    xTaskCreatePinnedToCore(TASKSENDER,"task-sender",5000,nullptr,8,&TASK_SENDER,0);
+}
+
+
+
+void loop()
+{
+    TestRunner::run();
+}
+
+
+
+void dataAllocator(const FRTTDataContainerOnQueue & orig, FRTTTempDataContainer & temp)
+{
+    temp.data = orig.data;
+    temp.senderAddress = orig.senderAddress;
+    temp.u32AdditionalData = orig.u32AdditionalData;
+    temp.u8DataType = orig.u8DataType;
+}
+void destroyer(FRTTTempDataContainer & temp)
+{
+      /* nothing to do */      
+}
+